@@ -26,7 +26,8 @@ ADDL_DEFINES =
 BUILD_DEFINES = -DAMDT_PUBLIC -DAMDT_BUILD_SUFFIX=\"\"
 PLATFORM_DEFINES = -DAMDT_PLATFORM_SUFFIX=\"\"
 DEBUG_DEFINES = -DAMDT_DEBUG_SUFFIX=\"\"
-DEFINES = $(BASE_DEFINES) $(BUILD_DEFINES) $(PLATFORM_DEFINES) $(DEBUG_DEFINES) $(ADDL_DEFINES)
+RELEASE_DEFINES = -DGPA_DISABLE_TRACE_FUNCTIONS
+DEFINES = $(BASE_DEFINES) $(BUILD_DEFINES) $(PLATFORM_DEFINES) $(DEBUG_DEFINES) $(RELEASE_DEFINES) $(ADDL_DEFINES)
 
 GPASRC_DIR=$(DEPTH)/Src
 GPACG_DIR = $(GPASRC_DIR)/GPUPerfAPICounterGenerator
@@ -61,7 +62,7 @@ STANDARD_LIBS = -ldl -lpthread
 # Build target overrides
 X86_OVERRIDES = "PLATFORM_CFLAG = -m32 -msse2" "PLATFORM_LFLAG = -m32" "PLATFORM_DEFINES = -DX86 -DAMDT_PLATFORM_SUFFIX=\\\"32\\\"" "CODEXL_OUTPUT_DIR = Output_x86" "PLATFORM_DIR = x86" "GLES_PLATFORM_DIR = Linx86"
 INTERNAL_OVERRIDES = "BUILD_DEFINES = -DAMDT_INTERNAL -DAMDT_BUILD_SUFFIX=\\\"-Internal\\\"" "INTERNAL_PUBLIC = _Internal"
-DEBUG_OVERRIDES = "OPTIMIZE = $(DEBUG_CFLAGS)" "DEBUG_RELEASE = debug" "DEBUG_DEFINES = -DAMDT_DEBUG_SUFFIX=\\\"-d\\\""
+DEBUG_OVERRIDES = "OPTIMIZE = $(DEBUG_CFLAGS)" "DEBUG_RELEASE = debug" "DEBUG_DEFINES = -DAMDT_DEBUG_SUFFIX=\\\"-d\\\"" "RELEASE_DEFINES ="
 
 BUILD_X86_OVERRIDES = "TARGET_SUFFIX = 32" "AMD_LIB_PATH = Bin/Linx86/" "AMD_LIB_SUFFIX = 32" $(X86_OVERRIDES)
 BUILD_INTERNAL_OVERRIDES = "TARGET_SUFFIX = -Internal" "AMD_LIB_PATH = Bin-Internal/Linx64/" "AMD_LIB_SUFFIX = -Internal" $(INTERNAL_OVERRIDES)
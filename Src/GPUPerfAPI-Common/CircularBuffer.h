@@ -56,6 +56,7 @@ public:
         m_tailIndex = obj.getTailIndex();
         m_size = obj.getSize();         // maximum number of elements in the buffer at any one time
         m_count = obj.getCount();       // current number of elements in the buffer
+        m_addedCount = obj.getAddedCount(); // number of elements ever added to the buffer
     }
 
     /// Equal operator
@@ -93,6 +94,7 @@ public:
         m_tailIndex = 0;
         m_size = 0;
         m_count = 0;
+        m_addedCount = 0;
     }
 
     /// Sets the size of the circular buffer.
@@ -157,6 +159,7 @@ public:
 
         circularIncrement(m_tailIndex);
         m_count++;
+        m_addedCount++;
         return true;
     }
 
@@ -174,6 +177,15 @@ public:
         return m_size;
     }
 
+    /// Gets the number of items which have been added to the circular buffer since it was initialized,
+    /// including those which have since been removed or overwritten.
+    /// This is also the add index that the next added item will have.
+    /// \return the number of items ever added to the buffer.
+    unsigned int getAddedCount() const
+    {
+        return m_addedCount;
+    }
+
     /// Indicates whether or not the buffer is full.
     /// \return True if the buffer is full; false if it is not.
     bool full() const
@@ -224,6 +236,8 @@ public:
         m_pArray[m_tailIndex] = item;
         circularIncrement(m_tailIndex);
         m_count++;
+        m_addedCount++;
+        return true;
     }
 
     /// Gets a reference to the item at the head of the buffer.
@@ -285,6 +299,24 @@ public:
         return m_pArray[index];
     }
 
+    /// Gets an item by the order in which it was added to the buffer, in constant time.
+    /// The first item added after the buffer was initialized has add index zero.
+    /// \param addIndex the add index of the item to get.
+    /// \return A pointer to the item, or nullptr if it has not been added yet or is no longer in the buffer.
+    T* getByAddIndex(unsigned int addIndex) const
+    {
+        // how far back from the tail the item is; unsigned arithmetic keeps this correct when the add count wraps around
+        unsigned int distanceFromTail = m_addedCount - addIndex;
+
+        if (0 == distanceFromTail || distanceFromTail > m_count)
+        {
+            return nullptr;
+        }
+
+        unsigned int index = (m_tailIndex + m_size - distanceFromTail) % m_size;
+        return &m_pArray[index];
+    }
+
     /// Gets the most recently added item from the buffer.
     /// \return A reference to the item most recently added to the buffer.
     T& getLastAdded()
@@ -361,6 +393,7 @@ protected:
     unsigned int m_tailIndex;  ///< index of the tail (insertion index)
     unsigned int m_size;       ///< maximum number of elements in the buffer at any one time
     unsigned int m_count;      ///< current number of elements in the buffer
+    unsigned int m_addedCount; ///< number of elements added to the buffer since it was initialized, used as the add index of the next element
 };
 
 #endif //_GPA_CIRCULAR_BUFFER_H_
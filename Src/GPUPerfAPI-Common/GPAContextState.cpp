@@ -6,14 +6,27 @@
 //==============================================================================
 
 #include "GPAContextState.h"
+#include <chrono>
+
+/// The time the background result collection thread waits before polling outstanding data requests again, in microseconds
+static const gpa_uint32 RESULT_COLLECTOR_POLL_INTERVAL_MICROSECONDS = 250;
 
 GPA_ContextState::GPA_ContextState()
+    : m_stopResultCollector(false),
+      m_isResultCollectorNotified(false)
 {
     Init();
 }
 
 GPA_ContextState::~GPA_ContextState()
 {
+    StopResultCollector();
+
+    // the sessions return their requests to the pool, so they must be destroyed first
+    m_profileSessions.clear();
+    ClearDataRequestPool();
+
+    delete m_pCounterScheduler;
 }
 
 void GPA_ContextState::Init()
@@ -29,88 +42,279 @@ void GPA_ContextState::Init()
     m_firstPassSampleCount = 0;
     m_maxSessions = 0;
     m_pCurrentSessionRequests = nullptr;
+    m_dataRequestPoolSelectionID = 0;
+    m_resultCollectionMode = GPA_RESULT_COLLECTION_APPLICATION_THREAD;
+    m_flushWaitPolicy = GPA_FLUSH_WAIT_SPIN_THEN_YIELD;
+    m_flushTimeout = 0;
     m_pCounterScheduler = nullptr;
     m_pCounterAccessor = nullptr;
 }
 
 GPA_DataRequest* GPA_ContextState::GetDataRequest(gpa_uint32 passNumber)
 {
-    UNREFERENCED_PARAMETER(passNumber);
-    //if ( m_expiredRequests.m_requests.size() > passNumber )
-    //{
-    //   // try and reuse an expired request
-    //   std::map<gpa_uint32, GPA_DataRequest*>* pExpiredPassRequests = &(m_expiredRequests.m_requests[passNumber]);
-    //   if (pExpiredPassRequests->size() > 0)
-    //   {
-    //      GPA_DataRequest* expiredRequest = pExpiredPassRequests->begin()->second;
-    //      pExpiredPassRequests->erase(pExpiredPassRequests->begin()->first);
-    //      return expiredRequest;
-    //   }
-
-    //   // otherwise search thru all passes and take the first found
-    //   for (std::vector<std::map<gpa_uint32, GPA_DataRequest*> >::iterator requestIter = m_expiredRequests.m_requests.begin(); requestIter != m_expiredRequests.m_requests.end(); ++requestIter)
-    //   {
-    //      if ( requestIter->size() > 0 )
-    //      {
-    //         GPA_DataRequest* expiredRequest = requestIter->begin()->second;
-    //         requestIter->erase(requestIter->begin()->first);
-    //         return expiredRequest;
-    //      }
-    //   }
-    //}
+    std::lock_guard<std::mutex> lock(m_dataRequestPoolMutex);
+
+    if (m_dataRequestPoolSelectionID != m_selectionID)
+    {
+        // the counter selection has changed, so the pooled requests would have to be set up again anyway
+        DeletePooledDataRequests();
+        m_dataRequestPoolSelectionID = m_selectionID;
+    }
+
+    if (passNumber < m_dataRequestPool.size() && !m_dataRequestPool[passNumber].empty())
+    {
+        // reuse an expired request of the pass, it already enables the counters of the pass
+        GPA_DataRequest* pExpiredRequest = m_dataRequestPool[passNumber].back();
+        m_dataRequestPool[passNumber].pop_back();
+        return pExpiredRequest;
+    }
 
     // none available, need to create a new request
     return GPA_IMP_CreateDataRequest();
 }
 
+void GPA_ContextState::ReleaseDataRequest(gpa_uint32 passNumber, GPA_DataRequest* pRequest)
+{
+    if (nullptr == pRequest)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_dataRequestPoolMutex);
+
+    // this may be called by the background result collection thread, so the request is compared with the selection of the pool,
+    // which GetDataRequest keeps up to date, rather than with the current selection
+    if (pRequest->GetCounterSelectionID() != m_dataRequestPoolSelectionID || pRequest->IsRequestActive())
+    {
+        // the request can't be reused for the current counter selection
+        delete pRequest;
+        return;
+    }
+
+    if (m_dataRequestPool.size() <= passNumber)
+    {
+        m_dataRequestPool.resize(passNumber + 1);
+    }
+
+    m_dataRequestPool[passNumber].push_back(pRequest);
+}
+
+void GPA_ContextState::ClearDataRequestPool()
+{
+    std::lock_guard<std::mutex> lock(m_dataRequestPoolMutex);
+
+    DeletePooledDataRequests();
+}
+
+void GPA_ContextState::DeletePooledDataRequests()
+{
+    for (auto& passRequests : m_dataRequestPool)
+    {
+        for (GPA_DataRequest* pRequest : passRequests)
+        {
+            delete pRequest;
+        }
 
-//// called by BeginSession when a newSession is allocated
-//// this session could be brand new, or an existing session which needs to be recycled
-//// m_requests should not contain any objects upon return
-//// m_expiredRequests is used to store expired requests by default
-//// an alternative implementation could be to just delete the expired requests,
-//// and always allocate new
-//void GPA_ContextState::RecycleCurrentSession()
-//{
-//   // assumes from this point all requests in the currentSession have been expired
-//   // remove old requests from session and put them in the context expired requests list
-//   gpa_uint32 numPasses = ( gpa_uint32 )m_currentSessionRequests->m_requests.size();
-//
-//   // make sure expired request vec has enough passes
-//   if ( m_expiredRequests.m_requests.size() < numPasses )
-//   {
-//      m_expiredRequests.m_requests.resize( numPasses );
-//   }
-//
-//   std::map<gpa_uint32, GPA_DataRequest*>* pActivePassRequests = nullptr;
-//   std::map<gpa_uint32, GPA_DataRequest*>* pExpiredPassRequests = nullptr;
-//   for ( gpa_uint32 i = 0 ; i < numPasses ; i++ )
-//   {
-//      pActivePassRequests = &(m_currentSessionRequests->m_requests[i]);
-//      pExpiredPassRequests = &(m_expiredRequests.m_requests[i]);
-//      for (std::map<gpa_uint32, GPA_DataRequest*>::iterator activeRequestIter = pActivePassRequests->begin(); activeRequestIter != pActivePassRequests->end(); ++activeRequestIter)
-//      {
-//         pExpiredPassRequests->insert(pExpiredPassRequests->begin(), *activeRequestIter);
-//      }
-//   }
-//
-//   // clear the request structure
-//   m_currentSessionRequests->m_requests.clear();
-//}
+        passRequests.clear();
+    }
+}
 
 GPA_SessionRequests* GPA_ContextState::FindSession(gpa_uint32 sessionID)
 {
-    for (gpa_uint32 i = 0; i < m_profileSessions.getCount(); i++)
+    if (0 == sessionID)
+    {
+        // session IDs start at one
+        return nullptr;
+    }
+
+    // GPA_BeginSession hands out the IDs in the order the sessions are added to the buffer,
+    // so the session with ID n was the nth one added
+    GPA_SessionRequests* pSession = m_profileSessions.getByAddIndex(sessionID - 1);
+
+    if (nullptr == pSession || pSession->m_sessionID != sessionID)
     {
-        // search from oldest to newest
-        GPA_SessionRequests& checkSession = m_profileSessions.getRelative(i);
+        // the session has not been started or its slot has already been reused by a newer session
+        return nullptr;
+    }
+
+    return pSession;
+}
+
+GPA_SessionRequests* GPA_ContextState::AddSession(gpa_uint32 sessionID, gpa_uint32 passCount)
+{
+    bool lockedOk = false;
+    GPA_SessionRequests* pSession = &m_profileSessions.lockNext(lockedOk);
+    assert(lockedOk == true);
+
+    // make sure all requests of the session about to be reused have completed, and that the background result collection thread
+    // has finished calling its completion callbacks; both may wait for that thread, so they are done before taking its mutex
+    pSession->Flush(false);
+    pSession->WaitForCompletionCallbacks();
+
+    std::lock_guard<std::mutex> lock(m_resultCollectorMutex);
+
+    m_profileSessions.addLockedItem();
 
-        if (checkSession.m_sessionID == sessionID)
+    // completed requests of the session go back to the context to be reused
+    pSession->SetContextState(this);
+    pSession->SetPassCount(passCount);
+    pSession->m_sessionID = sessionID;
+
+    return pSession;
+}
+
+void GPA_ContextState::CheckForCompletedSessions()
+{
+    if (GPA_RESULT_COLLECTION_BACKGROUND_THREAD == m_resultCollectionMode)
+    {
+        return;
+    }
+
+    for (gpa_uint32 i = 0; i < m_profileSessions.getSize(); i++)
+    {
+        GPA_SessionRequests& session = m_profileSessions.get(i);
+
+        if (session.HasCompletionCallbacks())
         {
-            return (&checkSession);
+            session.IsComplete();
         }
     }
+}
 
-    return nullptr;
+void GPA_ContextState::SetFlushWaitPolicy(GPA_Flush_Wait_Policy policy, gpa_uint32 timeoutMilliseconds)
+{
+    m_flushWaitPolicy = policy;
+    m_flushTimeout = timeoutMilliseconds;
+
+    // apply the policy to every session, including those whose results have not been read yet
+    for (gpa_uint32 i = 0; i < m_profileSessions.getSize(); i++)
+    {
+        m_profileSessions.get(i).SetFlushWaitPolicy(policy, timeoutMilliseconds);
+    }
 }
 
+bool GPA_ContextState::SupportsBackgroundResultCollection() const
+{
+    return false;
+}
+
+void GPA_ContextState::SetResultCollectionMode(GPA_Result_Collection_Mode mode)
+{
+    if (mode == m_resultCollectionMode)
+    {
+        return;
+    }
+
+    if (GPA_RESULT_COLLECTION_BACKGROUND_THREAD == mode)
+    {
+        for (gpa_uint32 i = 0; i < m_profileSessions.getSize(); i++)
+        {
+            m_profileSessions.get(i).SetBackgroundResultCollection(true);
+        }
+
+        m_stopResultCollector = false;
+        m_isResultCollectorNotified = false;
+        m_resultCollectorThread = std::thread(&GPA_ContextState::ResultCollectorThreadProc, this);
+    }
+    else
+    {
+        StopResultCollector();
+    }
+
+    m_resultCollectionMode = mode;
+}
+
+void GPA_ContextState::NotifyResultCollector()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_resultCollectorMutex);
+        m_isResultCollectorNotified = true;
+    }
+
+    m_resultCollectorCondition.notify_one();
+}
+
+void GPA_ContextState::StopResultCollector()
+{
+    if (!m_resultCollectorThread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_resultCollectorMutex);
+        m_stopResultCollector = true;
+    }
+
+    m_resultCollectorCondition.notify_one();
+    m_resultCollectorThread.join();
+
+    // the application thread collects the results again from now on
+    for (gpa_uint32 i = 0; i < m_profileSessions.getSize(); i++)
+    {
+        m_profileSessions.get(i).SetBackgroundResultCollection(false);
+    }
+}
+
+void GPA_ContextState::ResultCollectorThreadProc()
+{
+    // the completion callbacks taken from the complete sessions, with the session each of them belongs to
+    std::vector< std::pair< GPA_SessionRequests*, std::vector< std::function<void()> > > > completedSessions;
+
+    std::unique_lock<std::mutex> lock(m_resultCollectorMutex);
+
+    while (!m_stopResultCollector)
+    {
+        // requests which are ended from now on will be picked up by the next iteration
+        m_isResultCollectorNotified = false;
+
+        // the mutex stays locked while the sessions are polled, so that AddSession does not reuse a slot whose results are being collected
+        bool isComplete = true;
+
+        for (gpa_uint32 i = 0; i < m_profileSessions.getSize(); i++)
+        {
+            GPA_SessionRequests& session = m_profileSessions.get(i);
+
+            if (!session.CollectAvailableResults())
+            {
+                isComplete = false;
+            }
+            else if (session.HasCompletionCallbacks())
+            {
+                std::vector< std::function<void()> > callbacks;
+
+                if (session.TakeCompletionCallbacks(callbacks))
+                {
+                    completedSessions.emplace_back(&session, std::move(callbacks));
+                }
+            }
+        }
+
+        if (!completedSessions.empty())
+        {
+            // the callbacks run application code, so they are called without the mutex to let AddSession and NotifyResultCollector proceed;
+            // a session whose callbacks have been taken is not reused until they have been called
+            lock.unlock();
+
+            for (auto& completedSession : completedSessions)
+            {
+                completedSession.first->CallCompletionCallbacks(completedSession.second);
+            }
+
+            completedSessions.clear();
+            lock.lock();
+            continue;
+        }
+
+        if (isComplete)
+        {
+            // nothing is outstanding, so sleep until another request is ended
+            m_resultCollectorCondition.wait(lock, [this] { return m_stopResultCollector || m_isResultCollectorNotified; });
+        }
+        else
+        {
+            // give the GPU some time before polling the outstanding requests again
+            m_resultCollectorCondition.wait_for(lock, std::chrono::microseconds(RESULT_COLLECTOR_POLL_INTERVAL_MICROSECONDS), [this] { return m_stopResultCollector; });
+        }
+    }
+}
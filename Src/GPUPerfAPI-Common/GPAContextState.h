@@ -8,6 +8,9 @@
 #ifndef _GPA_CONTEXT_STATE_H_
 #define _GPA_CONTEXT_STATE_H_
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include "GPADataRequest.h"
 #include "GPASessionRequests.h"
@@ -37,24 +40,55 @@ public:
     virtual void Init();
 
     /// Get a data request for the specified pass number.
-    /// Default implementation recycles expired requests.
+    /// Default implementation reuses a request of the pass whose results have already been collected,
+    /// so that the backend can keep the resources of the current counter selection.
     /// \param passNumber The pass number for which to get a data request.
     /// \return A data request object that can be used for the specified pass.
     virtual GPA_DataRequest* GetDataRequest(gpa_uint32 passNumber);
 
-    ///// called by BeginSampling when a newSession is allocated
-    ///// this session could be brand new, or an existing session which needs to be recycled
-    ///// m_requests should not contain any objects upon return
-    ///// m_expiredRequests is used to store expired requests by default
-    ///// an alternative implementation could be to just delete the expired requests,
-    ///// and always allocate new
-    //virtual void RecycleCurrentSession();
+    /// Returns a data request whose results have been collected so that it can be reused by a later sample of the same pass.
+    /// Requests made for a counter selection other than the current one are deleted instead.
+    /// \param passNumber The pass number for which the request was made.
+    /// \param pRequest The data request to return.
+    virtual void ReleaseDataRequest(gpa_uint32 passNumber, GPA_DataRequest* pRequest);
+
+    /// Deletes all the data requests which are waiting to be reused.
+    void ClearDataRequestPool();
 
     /// Finds the specified session if it is available.
+    /// The session is looked up directly from its ID, so this takes constant time regardless of m_maxSessions.
     /// \param sessionID The ID of the session to find.
     /// \return The specified session if available, otherwise nullptr if not found.
     virtual GPA_SessionRequests* FindSession(gpa_uint32 sessionID);
 
+    /// Prepares the next slot of m_profileSessions for a new session, reusing the oldest session if all the slots are used.
+    /// The slot is reinitialized while the background result collection thread is not walking the sessions.
+    /// \param sessionID The ID of the new session.
+    /// \param passCount The number of passes of the new session.
+    /// \return The new session.
+    GPA_SessionRequests* AddSession(gpa_uint32 sessionID, gpa_uint32 passCount);
+
+    /// Checks the sessions which have completion callbacks waiting, so that the callbacks of those which are complete get called.
+    /// The background result collection thread does this as it collects results, so it is only needed on the application thread.
+    void CheckForCompletedSessions();
+
+    /// Sets how the sessions of this context wait for outstanding results.
+    /// \param policy The wait policy.
+    /// \param timeoutMilliseconds The time after which a wait gives up, or 0 to wait until the results are available.
+    void SetFlushWaitPolicy(GPA_Flush_Wait_Policy policy, gpa_uint32 timeoutMilliseconds);
+
+    /// Indicates whether the data requests of the API can collect their results on a thread other than the application thread.
+    /// APIs which require their calls to be made on the thread of the context must keep the default implementation.
+    /// \return true if the background result collection thread can be used; false otherwise.
+    virtual bool SupportsBackgroundResultCollection() const;
+
+    /// Starts or stops the background result collection thread.
+    /// \param mode The result collection mode.
+    void SetResultCollectionMode(GPA_Result_Collection_Mode mode);
+
+    /// Wakes up the background result collection thread because a data request has been ended.
+    void NotifyResultCollector();
+
     /// The current API-specific context.
     /// It is public to allow access by DLL entry point functions which would usually be part of the class.
     void* m_pContext;
@@ -79,14 +113,51 @@ public:
     CircularBuffer<GPA_SessionRequests> m_profileSessions; ///< The available set of data requests. size is m_maxSessions
     GPA_SessionRequests* m_pCurrentSessionRequests;        ///< Pointer to an element in m_profileSessions, which is the current session
 
+    /// Data requests whose results have been collected, by pass, ready to be reused by GetDataRequest.
+    /// All of them were made for the counter selection m_dataRequestPoolSelectionID.
+    std::vector< std::vector<GPA_DataRequest*> > m_dataRequestPool;
+    gpa_uint32 m_dataRequestPoolSelectionID;               ///< The ID of the counter selection of the requests in m_dataRequestPool
+    std::mutex m_dataRequestPoolMutex;                     ///< Synchronizes the pool, since the background result collection thread returns requests to it
+
+    GPA_Result_Collection_Mode m_resultCollectionMode;     ///< How the results of the data requests are collected
+
+    GPA_Flush_Wait_Policy m_flushWaitPolicy; ///< How the sessions wait for outstanding results
+    gpa_uint32 m_flushTimeout;               ///< The time in milliseconds after which a session gives up waiting for results, or 0 for no timeout
+
     /// structure that stores hardware information
     GPA_HWInfo m_hwInfo;
 
-    /// Counter scheduler
+    // scratch storage of GPA_GetSample, which is reused so that reading the result of a public counter does not allocate memory
+    std::vector<GPA_CounterResults> m_samplePassResults; ///< The counter results of each pass for the sample
+    std::vector<gpa_uint64> m_sampleInternalValues;       ///< The internal results the public counter is computed from
+    std::vector<char*> m_sampleInternalResults;           ///< Pointers to the internal results, in the order the equation of the counter expects them
+    std::vector<GPA_Type> m_sampleInternalTypes;          ///< The type of each internal result
+
+    /// Counter scheduler of this context, which holds its enabled counters and passes. It is owned by the context once GPA_OpenContext succeeds.
     GPA_ICounterScheduler* m_pCounterScheduler;
 
     /// Counter accessor
     GPA_CounterGeneratorBase* m_pCounterAccessor;
+
+private:
+
+    /// Deletes all the data requests which are waiting to be reused.
+    /// The caller must hold m_dataRequestPoolMutex.
+    void DeletePooledDataRequests();
+
+    /// Stops the background result collection thread if it is running, and waits for it to exit.
+    void StopResultCollector();
+
+    /// The entry point of the background result collection thread.
+    /// It polls the sessions while they have outstanding data requests, and sleeps until it is notified otherwise.
+    /// The completion callbacks of the complete sessions are called after m_resultCollectorMutex has been released.
+    void ResultCollectorThreadProc();
+
+    std::thread m_resultCollectorThread;                   ///< The background result collection thread
+    std::mutex m_resultCollectorMutex;                     ///< Protects the state shared with the background result collection thread, and is held while it walks m_profileSessions
+    std::condition_variable m_resultCollectorCondition;    ///< Signals the background result collection thread
+    bool m_stopResultCollector;                            ///< Tells the background result collection thread to exit
+    bool m_isResultCollectorNotified;                      ///< Indicates a data request has been ended since the thread last polled the sessions
 };
 
 #endif //_GPA_CONTEXT_STATE_H_
@@ -33,8 +33,9 @@ struct GPA_CounterResults
 ///
 /// a list of counters to track is specified by calling begin
 /// DataRequest implementations should allow efficient reuse of requests.
-/// By default requests are recycled in a way which means the same set
-/// of active counters will be requested ( regardless of multi-pass ).
+/// Once its results are collected, a request is returned to its context
+/// and reused by a later sample of the same pass, which means the same set
+/// of active counters will be requested as long as the selection does not change.
 ///
 /// A selectionID is used to allow trivial testing to see if this set has changed.
 /// The selectionID is incremented whenever a different counter set is activated.
@@ -94,6 +95,7 @@ public:
 
         if (result)
         {
+            m_counterSelectionID = selectionID;
             m_isRequestStarted = true;
             m_isRequestActive = true;
             m_areResultsCollected = false;
@@ -165,6 +167,16 @@ public:
     /// \return true if the results were collected; false if they are not available.
     virtual bool CollectResults(GPA_CounterResults& resultStorage) = 0;
 
+    /// Blocks on a wait primitive of the API until the results of the request may be available.
+    /// The default implementation has no such primitive and returns immediately.
+    /// \param timeoutMilliseconds The maximum time to wait, if the API's wait primitive supports a timeout.
+    /// \return true if a wait was performed; false if there is nothing to wait on, in which case the request should just be polled.
+    virtual bool WaitForResults(gpa_uint32 timeoutMilliseconds)
+    {
+        UNREFERENCED_PARAMETER(timeoutMilliseconds);
+        return false;
+    }
+
     /// Sets the sample ID.
     /// \param sampleID the ID to assign this data request.
     virtual void SetSampleID(gpa_uint32 sampleID)
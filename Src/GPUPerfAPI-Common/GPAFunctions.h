@@ -47,8 +47,12 @@ GPA_FUNCTION_PREFIX(GPA_DisableCounterStr)
 GPA_FUNCTION_PREFIX(GPA_EnableAllCounters)
 GPA_FUNCTION_PREFIX(GPA_DisableAllCounters)
 GPA_FUNCTION_PREFIX(GPA_GetCounterIndex)
+GPA_FUNCTION_PREFIX(GPA_GetCounterIndices)
 
 GPA_FUNCTION_PREFIX(GPA_GetPassCount)
+GPA_FUNCTION_PREFIX(GPA_GetPassCountForCounters)
+GPA_FUNCTION_PREFIX(GPA_GetCounterPassAffinity)
+GPA_FUNCTION_PREFIX(GPA_EnableCountersWithinPassBudget)
 
 GPA_FUNCTION_PREFIX(GPA_BeginSession)
 GPA_FUNCTION_PREFIX(GPA_EndSession)
@@ -61,12 +65,18 @@ GPA_FUNCTION_PREFIX(GPA_EndSample)
 
 GPA_FUNCTION_PREFIX(GPA_GetSampleCount)
 
+GPA_FUNCTION_PREFIX(GPA_SetFlushWaitPolicy)
+GPA_FUNCTION_PREFIX(GPA_SetResultCollectionMode)
+
 GPA_FUNCTION_PREFIX(GPA_IsSampleReady)
 GPA_FUNCTION_PREFIX(GPA_IsSessionReady)
 GPA_FUNCTION_PREFIX(GPA_GetSampleUInt64)
 GPA_FUNCTION_PREFIX(GPA_GetSampleUInt32)
 GPA_FUNCTION_PREFIX(GPA_GetSampleFloat64)
 GPA_FUNCTION_PREFIX(GPA_GetSampleFloat32)
+GPA_FUNCTION_PREFIX(GPA_GetSampleResults)
+GPA_FUNCTION_PREFIX(GPA_GetSessionResults)
+GPA_FUNCTION_PREFIX(GPA_RequestSessionResultsAsync)
 
 GPA_FUNCTION_PREFIX(GPA_GetDeviceID)
 GPA_FUNCTION_PREFIX(GPA_GetDeviceDesc)
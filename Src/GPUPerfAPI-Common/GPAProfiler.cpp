@@ -11,224 +11,317 @@
 
 #include "assert.h"
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <fstream>
 
+#if defined(_M_IX86) || defined(_M_X64)
+    #include <intrin.h>
+    #define PROFILER_USE_RDTSC
+#elif defined(__i386__) || defined(__x86_64__)
+    #include <x86intrin.h>
+    #define PROFILER_USE_RDTSC
+#else
+    #include <time.h>
+#endif
 
-using namespace std;
-
-
-static DWORD getCPUFreq()
-{
-    DWORD BufSize = sizeof(DWORD);
-    DWORD dwMHz;
-    HKEY hKey;
 
-    // open the key where the proc speed is hidden:
-    long lError = RegOpenKeyExA(HKEY_LOCAL_MACHINE,
-                                "HARDWARE\\DESCRIPTION\\System\\CentralProcessor\\0",
-                                0,
-                                KEY_READ,
-                                &hKey);
+using namespace std;
 
-    assert(lError == ERROR_SUCCESS);
-    UNREFERENCED_PARAMETER(lError);
 
-    // query the key;
-    RegQueryValueExA(hKey, "~MHz", nullptr, nullptr, (LPBYTE) &dwMHz, &BufSize);
+/// The buffer of the calling thread, owned by the profiler so that it survives the thread
+static thread_local ProfilerThreadData* s_pThreadData = nullptr;
 
-    RegCloseKey(hKey);
 
-    return dwMHz;
+gpa_int64 Profiler::GetTimestamp()
+{
+#ifdef PROFILER_USE_RDTSC
+    return static_cast<gpa_int64>(__rdtsc());
+#else
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<gpa_int64>(time.tv_sec) * 1000000000 + time.tv_nsec;
+#endif
 }
 
 
-static __int64 GetRDTSCTicksPerSecond()
+static gpa_int64 GetRDTSCTicksPerSecond()
 {
+#ifdef PROFILER_USE_RDTSC
     // use this to control how much time is spent measuring the high freq clock.
     // Measure for 1 / scaling seconds.
     // Higher numbers mean less time spent measuring but larger potential error range.
-    const __int64 scaling = 4;
+    const gpa_int64 scaling = 4;
 
-    // variables for the clock-cycles:
-    __int64 cyclesStart = 0, cyclesStop = 0;
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now() + std::chrono::microseconds(1000000 / scaling);
 
-    // variables for the High-Res Preformance Counter:
-    unsigned __int64 nCtr = 0, nFreq = 0, nCtrStop = 0;
+    gpa_int64 cyclesStart = Profiler::GetTimestamp();
 
-    // retrieve performance-counter frequency per second:
-    if (!QueryPerformanceFrequency((LARGE_INTEGER*) &nFreq)) { return 0; }
+    while (std::chrono::steady_clock::now() < stop)
+    {
+        // wait until 1 / scaling seconds have gone by
+    }
 
-    // retrieve the current value of the performance counter:
-    QueryPerformanceCounter((LARGE_INTEGER*) &nCtrStop);
+    gpa_int64 cyclesStop = Profiler::GetTimestamp();
+
+    return (cyclesStop - cyclesStart) * scaling;
+#else
+    // clock_gettime returns nanoseconds
+    return 1000000000;
+#endif
+}
 
-    // add the frequency to the counter-value:
-    nCtrStop += nFreq / scaling;
 
-    cyclesStart = __rdtsc();
+ProfilerThreadData::ProfilerThreadData(unsigned int threadIndex)
+    : m_threadIndex(threadIndex),
+      m_generation(0)
+{
+    // most call stacks are shallow, this avoids allocating while profiling
+    m_startedFunctions.reserve(64);
+    Reset(0);
+}
+
+
+void ProfilerThreadData::Reset(unsigned int generation)
+{
+    m_startedFunctions.clear();
 
-    do
+    for (unsigned int i = 0; i < PROFILER_MAX_FUNCTIONS; i++)
     {
-        // retrieve the value of the performance counter
-        // until 1 sec has gone by:
-        QueryPerformanceCounter((LARGE_INTEGER*) &nCtr);
+        m_calls[i].store(0, std::memory_order_relaxed);
+        m_totalTime[i].store(0, std::memory_order_relaxed);
+        m_timeBelow[i].store(0, std::memory_order_relaxed);
     }
-    while (nCtr < nCtrStop);
 
-    cyclesStop = __rdtsc();
+    m_totalTimeInFunctions.store(0, std::memory_order_relaxed);
+    m_timingErrors.store(0, std::memory_order_relaxed);
 
-    return (cyclesStop - cyclesStart) * scaling;
+    // publish the generation last, so that the report does not pick up a partially cleared buffer
+    m_generation.store(generation, std::memory_order_release);
 }
 
 
 // Constructor uses init to determine tick rate on this computer
 Profiler::Profiler()
+    : m_generation(0),
+      m_active(false)
 {
     m_RDTSCTicksPerSecond = 0;
+    m_startTime = 0;
+    m_stopTime = 0;
     Init();
 }
 
 // determine tick rate on this computer
-// also SetThreadAffinityMask to ensure accurate timings since running on same core always
+// the time stamp counter of current CPUs runs at a constant rate and is synchronized across cores,
+// so the threads no longer need to be pinned to a single core
 bool Profiler::Init()
 {
     Reset();
 
-    SetThreadAffinityMask(GetCurrentThread(), 1);
-
     m_RDTSCTicksPerSecond = GetRDTSCTicksPerSecond();
-    DWORD freq = getCPUFreq();
-
-    DWORD freqCompare = DWORD(m_RDTSCTicksPerSecond / 1000000);
-
-    if (freqCompare != freq)
-    {
-        return false;
-    }
 
-    return true;
+    return 0 != m_RDTSCTicksPerSecond;
 }
 
 void Profiler::Reset()
 {
-    m_startedTimestamps.clear();
-    m_totalTimeBelowParent.clear();
-    m_functionMap.clear();
-
-    m_totalTime = 0;
-    m_timingErrors = 0;
+    // the thread buffers may be in use, so each thread clears its own buffer when it sees the new generation
     m_active = false;
+    m_generation++;
 }
 
 
 void Profiler::Start()
 {
     Reset();
+    m_startTime = GetTimestamp();
     m_active = true;
-    m_startTime = __rdtsc();
 }
 
 
 void Profiler::Stop()
 {
-    m_stopTime = __rdtsc();
+    m_stopTime = GetTimestamp();
     m_active = false;
 }
 
 
-bool Profiler::EnterFunction(const char* pFunctionName)
+unsigned int Profiler::RegisterFunction(const char* pFunctionName)
 {
-    UNREFERENCED_PARAMETER(pFunctionName);
+    std::lock_guard<std::mutex> lock(m_mutex);
 
-    __int64 startTimestamp = __rdtsc();
+    std::vector<std::string>::const_iterator it = std::find(m_functionNames.begin(), m_functionNames.end(), pFunctionName);
 
-    // ignore any profiling calls when not active
-    if (!Active())
+    if (it != m_functionNames.end())
     {
-        return true;
+        return static_cast<unsigned int>(it - m_functionNames.begin());
     }
 
-    // add enter timestamp to stack
-    m_startedTimestamps.push_back(startTimestamp);
-    // start time below total at 0
-    m_totalTimeBelowParent.push_back(0);
+    if (m_functionNames.size() >= PROFILER_MAX_FUNCTIONS)
+    {
+        return PROFILER_INVALID_FUNCTION_ID;
+    }
 
-    return true;
+    m_functionNames.push_back(pFunctionName);
+    return static_cast<unsigned int>(m_functionNames.size() - 1);
+}
+
+
+ProfilerThreadData* Profiler::GetThreadData()
+{
+    if (nullptr == s_pThreadData)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        ProfilerThreadData* pThreadData = new(std::nothrow) ProfilerThreadData(static_cast<unsigned int>(m_threadData.size()));
+
+        if (nullptr != pThreadData)
+        {
+            m_threadData.push_back(std::unique_ptr<ProfilerThreadData>(pThreadData));
+            s_pThreadData = pThreadData;
+        }
+    }
+
+    return s_pThreadData;
 }
 
 
-bool Profiler::LeaveFunction(const char* pFunctionName)
+bool Profiler::EnterFunction(unsigned int functionId)
 {
-    __int64 endTimestamp = __rdtsc();
+    gpa_int64 startTimestamp = GetTimestamp();
 
     // ignore any profiling calls when not active
-    if (!Active())
+    if (!Active() || functionId >= PROFILER_MAX_FUNCTIONS)
     {
-        return true;
+        return false;
     }
 
-    // ensure that enter function was called prior to this leave
-    assert(m_startedTimestamps.size() > 0);
+    ProfilerThreadData* pThreadData = GetThreadData();
 
-    if (m_startedTimestamps.size() == 0)
+    if (nullptr == pThreadData)
     {
         return false;
     }
 
-    // pop the start time for the function
-    __int64 startTimestamp = m_startedTimestamps.back();
-    m_startedTimestamps.pop_back();
+    unsigned int generation = m_generation.load(std::memory_order_relaxed);
+
+    if (pThreadData->m_generation.load(std::memory_order_relaxed) != generation)
+    {
+        // profiling was restarted since this thread last recorded a function
+        pThreadData->Reset(generation);
+    }
+
+    // add enter timestamp to stack, and start time below total at 0
+    ProfilerThreadData::StartedFunction startedFunction = { functionId, startTimestamp, 0 };
+    pThreadData->m_startedFunctions.push_back(startedFunction);
 
-    // look up the function info for this function
-    FunctionInfo& fi = m_functionMap[std::string(pFunctionName)];
+    return true;
+}
+
+
+bool Profiler::LeaveFunction(unsigned int functionId)
+{
+    gpa_int64 endTimestamp = GetTimestamp();
 
-    // inc call count
-    fi.calls++;
+    ProfilerThreadData* pThreadData = s_pThreadData;
+
+    // ensure that enter function was called prior to this leave;
+    // it may not have been if profiling was started in between
+    if (nullptr == pThreadData ||
+        pThreadData->m_startedFunctions.empty() ||
+        pThreadData->m_startedFunctions.back().m_functionId != functionId)
+    {
+        return false;
+    }
+
+    // pop the start time for the function
+    ProfilerThreadData::StartedFunction startedFunction = pThreadData->m_startedFunctions.back();
+    pThreadData->m_startedFunctions.pop_back();
+
+    // ignore any profiling calls when not active
+    if (!Active())
+    {
+        return false;
+    }
 
     // compute delta between entering and leaving the function
-    __int64 deltaForThisInvocation = endTimestamp - startTimestamp;
+    gpa_int64 deltaForThisInvocation = endTimestamp - startedFunction.m_startTimestamp;
 
     if (deltaForThisInvocation < 0)
     {
         // problem timing
         deltaForThisInvocation = 0;
-        m_timingErrors++;
-        //try and fix
-        SetThreadAffinityMask(GetCurrentThread(), 1);
+        ProfilerThreadData::Add(pThreadData->m_timingErrors, 1u);
     }
 
-    // inc total time spent in profiled code
-    fi.totalTime += deltaForThisInvocation;
+    // inc call count and total time spent in profiled code
+    ProfilerThreadData::Add(pThreadData->m_calls[functionId], 1u);
+    ProfilerThreadData::Add(pThreadData->m_totalTime[functionId], deltaForThisInvocation);
 
     // retrieve the time below total, which will have been updated by any functions below this one
-    fi.timeBelow += m_totalTimeBelowParent.back();
-    m_totalTimeBelowParent.pop_back();
+    ProfilerThreadData::Add(pThreadData->m_timeBelow[functionId], startedFunction.m_totalTimeBelowParent);
 
     // now contribute to parent of this function if there was one
-    if (m_totalTimeBelowParent.size() > 0)
+    if (!pThreadData->m_startedFunctions.empty())
     {
         // we are below a parent function, so add the time of this function to the time below total
-        m_totalTimeBelowParent[m_totalTimeBelowParent.size() - 1] += deltaForThisInvocation;
+        pThreadData->m_startedFunctions.back().m_totalTimeBelowParent += deltaForThisInvocation;
     }
     else
     {
         // we are now evaluating a top level function call, add it's total time to the total time for profiling
-        m_totalTime += deltaForThisInvocation;
+        ProfilerThreadData::Add(pThreadData->m_totalTimeInFunctions, deltaForThisInvocation);
     }
 
-
     return true;
 }
 
 
-FunctionInfo& Profiler::GetFunctionInfo(const char* pFunctionName)
+void Profiler::AccumulateThreadData(const ProfilerThreadData* pThreadData, std::vector<FunctionInfo>& functionInfos, gpa_int64& totalTime, unsigned int& timingErrors)
+{
+    for (size_t i = 0; i < functionInfos.size(); i++)
+    {
+        functionInfos[i].calls += pThreadData->m_calls[i].load(std::memory_order_relaxed);
+        functionInfos[i].totalTime += pThreadData->m_totalTime[i].load(std::memory_order_relaxed);
+        functionInfos[i].timeBelow += pThreadData->m_timeBelow[i].load(std::memory_order_relaxed);
+    }
+
+    totalTime += pThreadData->m_totalTimeInFunctions.load(std::memory_order_relaxed);
+    timingErrors += pThreadData->m_timingErrors.load(std::memory_order_relaxed);
+}
+
+
+FunctionInfo Profiler::GetFunctionInfo(const char* pFunctionName)
 {
-    FunctionInfo& fi = m_functionMap[std::string(pFunctionName)];
+    FunctionInfo fi = {};
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<std::string>::const_iterator it = std::find(m_functionNames.begin(), m_functionNames.end(), pFunctionName);
+
+    if (it != m_functionNames.end())
+    {
+        size_t functionId = it - m_functionNames.begin();
+        unsigned int generation = m_generation.load(std::memory_order_relaxed);
+
+        for (size_t i = 0; i < m_threadData.size(); i++)
+        {
+            if (m_threadData[i]->m_generation.load(std::memory_order_acquire) == generation)
+            {
+                fi.calls += m_threadData[i]->m_calls[functionId].load(std::memory_order_relaxed);
+                fi.totalTime += m_threadData[i]->m_totalTime[functionId].load(std::memory_order_relaxed);
+                fi.timeBelow += m_threadData[i]->m_timeBelow[functionId].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
     return fi;
 }
 
 
-void Profiler::outputTime(std::stringstream& ss, __int64 time)
+void Profiler::outputTime(std::stringstream& ss, gpa_int64 time)
 {
     double t = (double)time / (double)m_RDTSCTicksPerSecond;
     ss << t;
@@ -239,8 +332,66 @@ void Profiler::outputTime(std::stringstream& ss, __int64 time)
 }
 
 
+void Profiler::outputFunctions(std::stringstream& ss, ProfileReportFormat format, const std::vector<FunctionInfo>& functionInfos, const std::vector<size_t>& functionIds, gpa_int64 totalTime, const std::string& thread)
+{
+    static const char* s_jsonNames[] = { "calls", "inPercentOfTotalTime", "totalPercentOfTotalTime", "totalTime", "timePerCall", "totalTimeIn", "timeInPerCall" };
+    double ticksPerSecond = (double)m_RDTSCTicksPerSecond;
+    bool isFirst = true;
+
+    for (size_t i = 0; i < functionIds.size(); i++)
+    {
+        const FunctionInfo& fi = functionInfos[functionIds[i]];
+
+        if (0 == fi.calls)
+        {
+            continue;
+        }
+
+        gpa_int64 timeIn = fi.totalTime - fi.timeBelow;
+
+        // times are in seconds; the percentages are 0 rather than NaN if nothing was timed, so that the JSON stays valid
+        double values[] =
+        {
+            (double)fi.calls,
+            0 == totalTime ? 0.0 : ((double)timeIn / (double)totalTime) * 100.0,
+            0 == totalTime ? 0.0 : ((double)fi.totalTime / (double)totalTime) * 100.0,
+            (double)fi.totalTime / ticksPerSecond,
+            (double)fi.totalTime / ticksPerSecond / fi.calls,
+            (double)timeIn / ticksPerSecond,
+            (double)timeIn / ticksPerSecond / fi.calls
+        };
+
+        if (PROFILE_REPORT_JSON == format)
+        {
+            ss << (isFirst ? "" : ",") << std::endl;
+            ss << "        { \"function\": \"" << m_functionNames[functionIds[i]] << "\"";
+
+            for (size_t v = 0; v < sizeof(values) / sizeof(values[0]); v++)
+            {
+                ss << ", \"" << s_jsonNames[v] << "\": " << values[v];
+            }
+
+            ss << " }";
+        }
+        else
+        {
+            ss << thread << "," << m_functionNames[functionIds[i]];
+
+            for (size_t v = 0; v < sizeof(values) / sizeof(values[0]); v++)
+            {
+                ss << "," << values[v];
+            }
+
+            ss << std::endl;
+        }
+
+        isFirst = false;
+    }
+}
+
+
 // create a string containing a report of all profiling
-std::string Profiler::GenerateReport()
+std::string Profiler::GenerateReport(ProfileReportFormat format)
 {
     // if profiling, stop
     if (Active())
@@ -248,62 +399,139 @@ std::string Profiler::GenerateReport()
         Stop();
     }
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // merge the buffers of all threads which recorded times since profiling was started
+    unsigned int generation = m_generation.load(std::memory_order_relaxed);
+    std::vector<const ProfilerThreadData*> threads;
+    std::vector<FunctionInfo> functionInfos(m_functionNames.size(), FunctionInfo());
+    gpa_int64 totalTime = 0;
+    unsigned int timingErrors = 0;
+
+    for (size_t i = 0; i < m_threadData.size(); i++)
+    {
+        if (m_threadData[i]->m_generation.load(std::memory_order_acquire) == generation)
+        {
+            threads.push_back(m_threadData[i].get());
+            AccumulateThreadData(m_threadData[i].get(), functionInfos, totalTime, timingErrors);
+        }
+    }
+
+    // list the functions by name
+    std::vector<size_t> functionIds;
+
+    for (size_t i = 0; i < m_functionNames.size(); i++)
+    {
+        functionIds.push_back(i);
+    }
+
+    std::sort(functionIds.begin(), functionIds.end(), [this](size_t a, size_t b)
+    {
+        return m_functionNames[a] < m_functionNames[b];
+    });
+
     //   std::string str;
     std::stringstream str;
+
+    if (PROFILE_REPORT_CSV == format)
+    {
+        // the merged times of all threads first, followed by the times of each thread
+        str << "Thread,Function,# of calls,in % of total time,total % of total time,total time,time per call,total time in,time in per call";
+        str << std::endl;
+        outputFunctions(str, format, functionInfos, functionIds, totalTime, "all");
+
+        for (size_t i = 0; i < threads.size(); i++)
+        {
+            std::vector<FunctionInfo> threadFunctionInfos(m_functionNames.size(), FunctionInfo());
+            gpa_int64 threadTotalTime = 0;
+            unsigned int threadTimingErrors = 0;
+            AccumulateThreadData(threads[i], threadFunctionInfos, threadTotalTime, threadTimingErrors);
+
+            outputFunctions(str, format, threadFunctionInfos, functionIds, threadTotalTime, std::to_string(threads[i]->m_threadIndex));
+        }
+
+        return str.str();
+    }
+
+    if (PROFILE_REPORT_JSON == format)
+    {
+        str << "{" << std::endl;
+        str << "  \"timeProfiling\": " << (double)(m_stopTime - m_startTime) / (double)m_RDTSCTicksPerSecond << "," << std::endl;
+        str << "  \"totalTimeInFunctions\": " << (double)totalTime / (double)m_RDTSCTicksPerSecond << "," << std::endl;
+        str << "  \"timingErrors\": " << timingErrors << "," << std::endl;
+        str << "  \"functions\": [";
+        outputFunctions(str, format, functionInfos, functionIds, totalTime, "all");
+        str << std::endl << "  ]," << std::endl;
+        str << "  \"threads\": [";
+
+        for (size_t i = 0; i < threads.size(); i++)
+        {
+            std::vector<FunctionInfo> threadFunctionInfos(m_functionNames.size(), FunctionInfo());
+            gpa_int64 threadTotalTime = 0;
+            unsigned int threadTimingErrors = 0;
+            AccumulateThreadData(threads[i], threadFunctionInfos, threadTotalTime, threadTimingErrors);
+
+            str << (0 == i ? "" : ",") << std::endl;
+            str << "    { \"thread\": " << threads[i]->m_threadIndex;
+            str << ", \"totalTimeInFunctions\": " << (double)threadTotalTime / (double)m_RDTSCTicksPerSecond;
+            str << ", \"timingErrors\": " << threadTimingErrors << ", \"functions\": [";
+            outputFunctions(str, format, threadFunctionInfos, functionIds, threadTotalTime, std::to_string(threads[i]->m_threadIndex));
+            str << std::endl << "      ] }";
+        }
+
+        str << std::endl << "  ]" << std::endl;
+        str << "}" << std::endl;
+
+        return str.str();
+    }
+
     str << "Time profiling = ";
     outputTime(str, m_stopTime - m_startTime);
     str << std::endl;
 
     str << "Total time in functions = ";
-    outputTime(str, m_totalTime);
+    outputTime(str, totalTime);
     str << std::endl;
 
     str << "% time in functions = ";
-    double pctOfTotal = (double)m_totalTime * 100.0 / (double)(m_stopTime - m_startTime);
+    double pctOfTotal = (double)totalTime * 100.0 / (double)(m_stopTime - m_startTime);
     str << pctOfTotal;
     str << std::endl;
 
     str << "Timing errors = ";
-    str << m_timingErrors;
+    str << timingErrors;
     str << std::endl;
     str << std::endl;
 
     str << "Function, # of calls, in % of total time, total % of total time, total time, time per call, total time in, time in per call";
     str << std::endl;
 
-    for (std::map<std::string, FunctionInfo>::const_iterator it = m_functionMap.begin(); it != m_functionMap.end(); it++)
+    for (size_t i = 0; i < functionIds.size(); i++)
     {
-        //      str << "Function ";
-#if 0
-        str << it->first;
-        str << ":[";
-        str << it->second.calls;
-        str << "] tot: ";
-        outputTime(str, it->second.totalTime);
-        str << ", in: ";
-        outputTime(str, it->second.totalTime - it->second.timeBelow);
-        str << ", %: ";
-        double pct = ((double)(it->second.totalTime - it->second.timeBelow) / (double)m_totalTime) * 100.0;
-        str << pct;
-        str << endl;
-#endif
-        str << it->first;
+        const FunctionInfo& fi = functionInfos[functionIds[i]];
+
+        if (0 == fi.calls)
+        {
+            continue;
+        }
+
+        str << m_functionNames[functionIds[i]];
         str << ", ";
-        str << it->second.calls;
+        str << fi.calls;
         str << ", ";
-        double pct = ((double)(it->second.totalTime - it->second.timeBelow) / (double)m_totalTime) * 100.0;
+        double pct = ((double)(fi.totalTime - fi.timeBelow) / (double)totalTime) * 100.0;
         str << pct;
         str << ", ";
-        double pctTotal = ((double)it->second.totalTime / (double)m_totalTime) * 100.0;
+        double pctTotal = ((double)fi.totalTime / (double)totalTime) * 100.0;
         str << pctTotal;
         str << ", ";
-        outputTime(str, it->second.totalTime);
+        outputTime(str, fi.totalTime);
         str << ", ";
-        outputTime(str, it->second.totalTime / it->second.calls);
+        outputTime(str, fi.totalTime / fi.calls);
         str << ", ";
-        outputTime(str, it->second.totalTime - it->second.timeBelow);
+        outputTime(str, fi.totalTime - fi.timeBelow);
         str << ", ";
-        outputTime(str, (it->second.totalTime - it->second.timeBelow) / it->second.calls);
+        outputTime(str, (fi.totalTime - fi.timeBelow) / fi.calls);
         str << ", ";
         str << endl;
     }
@@ -313,9 +541,9 @@ std::string Profiler::GenerateReport()
 
 
 // generate a profiling report and write it to disk using the specified filename.
-void Profiler::WriteReport(std::string filename)
+void Profiler::WriteReport(std::string filename, ProfileReportFormat format)
 {
-    string s = GenerateReport();
+    string s = GenerateReport(format);
     ofstream file(filename.c_str(), ios::out);
 
     if (file.is_open())
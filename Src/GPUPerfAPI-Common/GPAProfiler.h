@@ -12,10 +12,13 @@
 // giving the name of the function as a parameter at the very beginning of each function to include in profiling.
 // Use START_PROFILING() to begin measurements, and STOP_PROFILING() to finish.
 // Use WRITE_PROFILE_REPORT(filename) to write a text report to the specified filename. a csv extension is a good choice.
+// Use WRITE_PROFILE_REPORT_AS(filename, format) to write the report as CSV or JSON instead (see ProfileReportFormat).
 // Define ENABLE_PROFILING for all projects which reference the profiler.
 
-// note: currently this is written to work for single-threaded apps without access to QueryPerformanceCounter.
-// For multi-threaded apps with access to QPC, a QPC version of the timing code should be added.
+// Profiled functions may be called from any number of threads. Each thread records into its own buffer,
+// and the report merges the buffers of all threads. Timestamps are read from the CPU time stamp counter on x86
+// and x64, and from a monotonic clock elsewhere. Each PROFILE_FUNCTION call site registers its name once and is
+// identified by a small integer from then on, so no name lookup is done while profiling.
 
 // The results will look similar to the following:
 
@@ -33,6 +36,7 @@
 // Description of output:
 
 // all numbers not in brackets are in seconds
+// the times of all threads are added together, so the total time in functions can exceed the time profiling
 
 // Function: name of function profiled
 // # of calls: number of times the function was called
@@ -48,10 +52,12 @@
 
 #ifdef ENABLE_PROFILING
 
-#include "windows.h"
+#include "GPUPerfAPITypes.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <vector>
-#include <map>
 #include <string>
 #include <sstream>
 
@@ -59,13 +65,25 @@
 // these macros refer to a singleton profiling object defined in GPAProfiler.cpp
 
 /// macro to use a scope-bound object to profile a function
-#define PROFILE_FUNCTION(func) ScopeProfile _tempScopeProfileObject(#func)
+#define PROFILE_FUNCTION(func) \
+    static const unsigned int _tempScopeProfileFunctionId = gProfilerSingleton.RegisterFunction(#func); \
+    ScopeProfile _tempScopeProfileObject(_tempScopeProfileFunctionId)
 
 /// macro to begin profiling a section
-#define BEGIN_PROFILE_SECTION(func) (gProfilerSingleton.EnterFunction(#func))
+#define BEGIN_PROFILE_SECTION(func) \
+    do \
+    { \
+        static const unsigned int _tempProfileSectionId = gProfilerSingleton.RegisterFunction(#func); \
+        gProfilerSingleton.EnterFunction(_tempProfileSectionId); \
+    } while (false)
 
 /// macro to end profiling a section
-#define END_PROFILE_SECTION(func) (gProfilerSingleton.LeaveFunction(#func))
+#define END_PROFILE_SECTION(func) \
+    do \
+    { \
+        static const unsigned int _tempProfileSectionId = gProfilerSingleton.RegisterFunction(#func); \
+        gProfilerSingleton.LeaveFunction(_tempProfileSectionId); \
+    } while (false)
 
 /// macro to start profiling
 #define START_PROFILING() (gProfilerSingleton.Start())
@@ -82,12 +100,70 @@
 /// macro to write a profile report
 #define WRITE_PROFILE_REPORT(filename) (gProfilerSingleton.WriteReport(filename))
 
+/// macro to write a profile report in the specified format
+#define WRITE_PROFILE_REPORT_AS(filename, format) (gProfilerSingleton.WriteReport(filename, format))
+
+/// The formats in which a profile report can be generated
+enum ProfileReportFormat
+{
+    PROFILE_REPORT_TEXT, ///< the summary followed by the merged table of all functions, as described above
+    PROFILE_REPORT_CSV,  ///< one header line, then one line per function for all threads and for each thread
+    PROFILE_REPORT_JSON  ///< a JSON object containing the summary, the merged functions, and the functions of each thread
+};
+
+/// The maximum number of functions and sections which can be profiled; further ones are ignored
+static const unsigned int PROFILER_MAX_FUNCTIONS = 512;
+
+/// The function ID returned when no more functions can be registered
+static const unsigned int PROFILER_INVALID_FUNCTION_ID = PROFILER_MAX_FUNCTIONS;
+
 class FunctionInfo
 {
 public:
     unsigned int calls;
-    __int64 totalTime;
-    __int64 timeBelow;
+    gpa_int64 totalTime;
+    gpa_int64 timeBelow;
+};
+
+/// The times recorded by a single thread.
+/// Only the owning thread writes the counters, the report reads them from other threads.
+class ProfilerThreadData
+{
+public:
+
+    /// Constructor
+    /// \param threadIndex the index of the thread in the report
+    ProfilerThreadData(unsigned int threadIndex);
+
+    /// Clears all recorded times; only called by the owning thread
+    /// \param generation the generation of the profiler the times are recorded for
+    void Reset(unsigned int generation);
+
+    /// Adds a value to a counter; only called by the owning thread, so there is no need for an atomic add
+    /// \param counter the counter to update
+    /// \param value the value to add
+    template<typename T>
+    static void Add(std::atomic<T>& counter, T value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    /// A function entered by the thread which has not been left yet
+    struct StartedFunction
+    {
+        unsigned int m_functionId;         ///< the ID of the function
+        gpa_int64 m_startTimestamp;        ///< the timestamp at which the function was entered
+        gpa_int64 m_totalTimeBelowParent;  ///< the time spent in profiled functions called by this one
+    };
+
+    unsigned int m_threadIndex;                                ///< the index of the thread in the report
+    std::atomic<unsigned int> m_generation;                    ///< the profiler generation the recorded times belong to
+    std::vector<StartedFunction> m_startedFunctions;           ///< the stack of functions entered by the thread
+    std::atomic<unsigned int> m_calls[PROFILER_MAX_FUNCTIONS]; ///< the number of calls of each function
+    std::atomic<gpa_int64> m_totalTime[PROFILER_MAX_FUNCTIONS]; ///< the total time spent in each function
+    std::atomic<gpa_int64> m_timeBelow[PROFILER_MAX_FUNCTIONS]; ///< the time spent in profiled functions called by each function
+    std::atomic<gpa_int64> m_totalTimeInFunctions;             ///< the total time spent in top level functions
+    std::atomic<unsigned int> m_timingErrors;                  ///< the number of invocations with a negative duration
 };
 
 
@@ -105,32 +181,68 @@ public:
 
     bool Active()
     {
-        return m_active;
+        return m_active.load(std::memory_order_relaxed);
     }
 
-    bool EnterFunction(const char* pFunctionName);
-    bool LeaveFunction(const char* pFunctionName);
-
-    FunctionInfo& GetFunctionInfo(const char* pFunctionName);
+    /// Returns the ID of a function or section, registering its name if it has not been seen before.
+    /// This is called once per call site, so it can afford to lock and compare names.
+    /// \param pFunctionName the name of the function
+    /// \return the ID of the function, or PROFILER_INVALID_FUNCTION_ID if too many functions have been registered
+    unsigned int RegisterFunction(const char* pFunctionName);
 
-    std::string GenerateReport();
-    void WriteReport(std::string filename);
+    /// Records the entry into a function on the calling thread.
+    /// \param functionId the ID of the function returned by RegisterFunction
+    /// \return true if the entry was recorded, false if profiling is not active
+    bool EnterFunction(unsigned int functionId);
 
-protected:
-    void outputTime(std::stringstream& ss, __int64 time);
+    /// Records the exit from a function on the calling thread.
+    /// \param functionId the ID of the function returned by RegisterFunction
+    /// \return true if the exit was recorded, false if the function was not entered while profiling
+    bool LeaveFunction(unsigned int functionId);
 
-    __int64 m_RDTSCTicksPerSecond;
-    std::vector<__int64> m_startedTimestamps;
-    std::vector<__int64> m_totalTimeBelowParent;
+    FunctionInfo GetFunctionInfo(const char* pFunctionName);
 
-    std::map<std::string, FunctionInfo> m_functionMap;
+    std::string GenerateReport(ProfileReportFormat format = PROFILE_REPORT_TEXT);
+    void WriteReport(std::string filename, ProfileReportFormat format = PROFILE_REPORT_TEXT);
 
-    __int64 m_totalTime;
-    unsigned int m_timingErrors;
+    /// Reads the current timestamp.
+    /// \return the timestamp, in units of GetTicksPerSecond
+    static gpa_int64 GetTimestamp();
 
-    bool m_active;
-    __int64 m_startTime;
-    __int64 m_stopTime;
+protected:
+    void outputTime(std::stringstream& ss, gpa_int64 time);
+
+    /// Gets the buffer of the calling thread, creating it if needed.
+    /// \return the buffer of the calling thread, or nullptr if it could not be allocated
+    ProfilerThreadData* GetThreadData();
+
+    /// Adds the times recorded by a thread to a list of function infos
+    /// \param pThreadData the thread whose times are added
+    /// \param functionInfos the function infos indexed by function ID
+    /// \param[out] totalTime the total time spent in top level functions
+    /// \param[out] timingErrors the number of timing errors
+    void AccumulateThreadData(const ProfilerThreadData* pThreadData, std::vector<FunctionInfo>& functionInfos, gpa_int64& totalTime, unsigned int& timingErrors);
+
+    /// Writes the functions which were called as CSV lines or as the elements of a JSON array
+    /// \param ss the stream to write to
+    /// \param format either PROFILE_REPORT_CSV or PROFILE_REPORT_JSON
+    /// \param functionInfos the function infos indexed by function ID
+    /// \param functionIds the IDs of the functions in the order in which they are written
+    /// \param totalTime the total time in profiled functions the percentages are relative to
+    /// \param thread the value of the thread column of the CSV lines
+    void outputFunctions(std::stringstream& ss, ProfileReportFormat format, const std::vector<FunctionInfo>& functionInfos, const std::vector<size_t>& functionIds, gpa_int64 totalTime, const std::string& thread);
+
+    gpa_int64 m_RDTSCTicksPerSecond;
+
+    std::mutex m_mutex;                                              ///< protects the function names and the list of thread buffers
+    std::vector<std::string> m_functionNames;                       ///< the names of the registered functions, indexed by function ID
+    std::vector<std::unique_ptr<ProfilerThreadData>> m_threadData;   ///< the buffers of all threads which have been profiled
+
+    std::atomic<unsigned int> m_generation;                         ///< incremented by each Start, so that threads clear their buffers lazily
+
+    std::atomic<bool> m_active;
+    gpa_int64 m_startTime;
+    gpa_int64 m_stopTime;
 };
 
 
@@ -140,19 +252,23 @@ extern Profiler gProfilerSingleton;
 class ScopeProfile
 {
 public:
-    ScopeProfile(const char* pFunctionName)
+    ScopeProfile(unsigned int functionId)
     {
-        m_pFunctionName = pFunctionName;
-        gProfilerSingleton.EnterFunction(pFunctionName);
+        m_functionId = functionId;
+        m_entered = gProfilerSingleton.EnterFunction(functionId);
     }
 
     ~ScopeProfile()
     {
-        gProfilerSingleton.LeaveFunction(m_pFunctionName);
+        if (m_entered)
+        {
+            gProfilerSingleton.LeaveFunction(m_functionId);
+        }
     }
 
 protected:
-    const char* m_pFunctionName;
+    unsigned int m_functionId;
+    bool m_entered;
 };
 
 
@@ -182,6 +298,9 @@ protected:
 /// macro to write a profile report
 #define WRITE_PROFILE_REPORT(filename)
 
+/// macro to write a profile report in the specified format
+#define WRITE_PROFILE_REPORT_AS(filename, format)
+
 #endif
 
 #endif // _GPA_PROFILER_H_
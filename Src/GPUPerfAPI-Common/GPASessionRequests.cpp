@@ -6,14 +6,36 @@
 //==============================================================================
 
 #include "GPASessionRequests.h"
+#include "GPAContextState.h"
 #include <assert.h>
-#include <list>
+#include <algorithm>
+#include <chrono>
+#include <thread>
 
-/// define a type which is a pair containing a pass index and a sample id. It is used while identifying if all samples in all passes of a session are complete.
-typedef std::pair<gpa_uint32, gpa_uint32> PassIndexAndSampleIdPair;
+/// define a type which is a pair containing a sample id and the slot which holds it. It is used to order the samples of a session by sample id.
+typedef std::pair<gpa_uint32, gpa_uint32> SampleIdAndSlotPair;
+
+/// The number of times Flush polls the outstanding requests before it starts yielding or sleeping between polls
+static const gpa_uint32 FLUSH_SPIN_COUNT = 64;
+
+/// The longest time GPA_FLUSH_WAIT_BACKOFF_SLEEP sleeps between two polls, in microseconds
+static const gpa_uint32 FLUSH_MAX_SLEEP_MICROSECONDS = 1000;
+
+/// The number of completion callbacks the calling thread is running, they can be nested when a callback requests the results of another session
+static thread_local gpa_uint32 s_completionCallbackDepth = 0;
+
+/// The longest time GPA_FLUSH_WAIT_BACKEND blocks on a request before polling again when there is no timeout, in milliseconds
+static const gpa_uint32 FLUSH_MAX_BACKEND_WAIT_MILLISECONDS = 100;
 
 GPA_SessionRequests::GPA_SessionRequests()
-    : m_sessionID(0)
+    : m_sessionID(0),
+      m_pendingRequestCount(0),
+      m_hasCompletionCallbacks(false),
+      m_runningCompletionCallbacks(0),
+      m_flushWaitPolicy(GPA_FLUSH_WAIT_SPIN_THEN_YIELD),
+      m_flushTimeout(0),
+      m_isBackgroundCollectionEnabled(false),
+      m_pContextState(nullptr)
 {
     TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::CONSTRUCTOR);
 }
@@ -23,35 +45,161 @@ GPA_SessionRequests::~GPA_SessionRequests()
 {
     TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::DESTRUCTOR);
 
-    Flush();
+    Flush(false);
+    WaitForCompletionCallbacks();
 
-    //delete allocated result buffers from Begin()
-    for (auto buffer : m_allocatedResultBuffer)
-    {
-        delete[] buffer;
-    }
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     // clean up the passes
-    for (auto pass : m_passes)
+    for (auto& pass : m_passes)
     {
-        pass.m_samples.clear();
-        pass.m_results.clear();
+        pass.Reset();
     }
-
-    m_allocatedResultBuffer.clear();
 }
 
 //-----------------------------------------------------------------------------
-void GPA_SessionRequests::Flush()
+GPA_Status GPA_SessionRequests::Flush(bool useTimeout)
 {
     TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::Flush);
 
+    gpa_uint32 timeout = useTimeout ? m_flushTimeout : 0;
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    gpa_uint32 pollCount = 0;
+
     // block until the session is complete
     while (IsComplete() == false)
     {
+        gpa_uint32 remainingTime = 0;
+
+        if (0 != timeout)
+        {
+            long long elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+            if (elapsedTime >= timeout)
+            {
+                std::stringstream message;
+                message << "Timed out after " << timeout << " ms waiting for the results of session " << m_sessionID << ".";
+                GPA_LogError(message.str().c_str());
+                return GPA_STATUS_ERROR_TIMEOUT;
+            }
+
+            remainingTime = timeout - static_cast<gpa_uint32>(elapsedTime);
+        }
+
+        WaitForRequests(pollCount, remainingTime);
+        pollCount++;
+    }
+
+    return GPA_STATUS_OK;
+}
+
+//-----------------------------------------------------------------------------
+void GPA_SessionRequests::SetFlushWaitPolicy(GPA_Flush_Wait_Policy policy, gpa_uint32 timeoutMilliseconds)
+{
+    TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::SetFlushWaitPolicy);
+
+    m_flushWaitPolicy = policy;
+    m_flushTimeout = timeoutMilliseconds;
+}
+
+//-----------------------------------------------------------------------------
+void GPA_SessionRequests::SetContextState(GPA_ContextState* pContextState)
+{
+    m_pContextState = pContextState;
+}
+
+//-----------------------------------------------------------------------------
+void GPA_SessionRequests::SetBackgroundResultCollection(bool isEnabled)
+{
+    m_isBackgroundCollectionEnabled = isEnabled;
+}
+
+//-----------------------------------------------------------------------------
+void GPA_SessionRequests::WaitForRequests(gpa_uint32 pollCount, gpa_uint32 timeoutMilliseconds)
+{
+    switch (m_flushWaitPolicy)
+    {
+        case GPA_FLUSH_WAIT_SPIN:
+            break;
+
+        case GPA_FLUSH_WAIT_SPIN_THEN_YIELD:
+            if (pollCount >= FLUSH_SPIN_COUNT)
+            {
+                std::this_thread::yield();
+            }
+
+            break;
+
+        case GPA_FLUSH_WAIT_BACKOFF_SLEEP:
+            if (pollCount >= FLUSH_SPIN_COUNT)
+            {
+                gpa_uint32 doublings = std::min(pollCount - FLUSH_SPIN_COUNT, 31u);
+                gpa_uint32 sleepTime = std::min(1u << doublings, FLUSH_MAX_SLEEP_MICROSECONDS);
+                std::this_thread::sleep_for(std::chrono::microseconds(sleepTime));
+            }
+
+            break;
+
+        case GPA_FLUSH_WAIT_BACKEND:
+        {
+            // the background collection thread may recycle a request as soon as it completes,
+            // so only wait on a request when the results are collected on this thread
+            GPA_DataRequest* pRequest = m_isBackgroundCollectionEnabled ? nullptr : GetOldestPendingRequest();
+
+            gpa_uint32 waitTime = (0 != timeoutMilliseconds) ? std::min(timeoutMilliseconds, FLUSH_MAX_BACKEND_WAIT_MILLISECONDS) : FLUSH_MAX_BACKEND_WAIT_MILLISECONDS;
+
+            if (nullptr == pRequest || !pRequest->WaitForResults(waitTime))
+            {
+                // the API has nothing to wait on for this request, so just poll it again
+                std::this_thread::yield();
+            }
+
+            break;
+        }
+
+        default:
+            assert(false);
+            break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void GPA_SessionRequests::ReleaseRequest(gpa_uint32 passIndex, GPA_DataRequest* pRequest)
+{
+    if (nullptr != m_pContextState)
+    {
+        m_pContextState->ReleaseDataRequest(passIndex, pRequest);
+    }
+    else
+    {
+        delete pRequest;
     }
 }
 
+//-----------------------------------------------------------------------------
+GPA_DataRequest* GPA_SessionRequests::GetOldestPendingRequest()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto& pass : m_passes)
+    {
+        if (0 != pass.m_pendingCount)
+        {
+            for (size_t i = pass.m_firstPendingSlot; i < pass.m_pendingSlots.size(); ++i)
+            {
+                gpa_uint32 slot = pass.m_pendingSlots[i];
+
+                if (GPA_SAMPLE_SLOT_PENDING == pass.m_slotStates[slot])
+                {
+                    return pass.m_requests[slot];
+                }
+            }
+        }
+    }
+
+    return nullptr;
+}
+
 //-----------------------------------------------------------------------------
 void GPA_SessionRequests::CheckForAvailableResults(gpa_uint32 passIndex)
 {
@@ -59,16 +207,51 @@ void GPA_SessionRequests::CheckForAvailableResults(gpa_uint32 passIndex)
 
     UNREFERENCED_PARAMETER(passIndex);
 
+    if (m_isBackgroundCollectionEnabled)
+    {
+        // the background collection thread is already checking for results
+        return;
+    }
+
     // check to see if this session is complete.
     IsComplete();
 }
 
+//-----------------------------------------------------------------------------
+bool GPA_SessionRequests::CollectAvailableResults()
+{
+    TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::CollectAvailableResults);
+
+    if (0 == m_pendingRequestCount)
+    {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return PollPendingRequests();
+}
+
 //-----------------------------------------------------------------------------
 void GPA_SessionRequests::SetPassCount(gpa_uint32 passCount)
 {
     TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::SetPassCount);
-    // resize each of the arrays so that the data isn't continually allocated throughout the profile pass
+
+    // the session may be reused, so drop the samples of its previous use but keep the storage,
+    // so that the data isn't continually allocated throughout the profile pass
+    // (the caller flushes the session first, so none of its requests are still pending)
+    WaitForCompletionCallbacks();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto& pass : m_passes)
+    {
+        pass.Reset();
+    }
+
     m_passes.resize(passCount);
+    m_sampleSlots.clear();
+    m_slotSampleIds.clear();
+    m_pendingRequestCount = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -76,6 +259,8 @@ gpa_uint32 GPA_SessionRequests::GetPassCount()
 {
     TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::GetPassCount);
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     return (gpa_uint32)m_passes.size();
 }
 
@@ -92,6 +277,8 @@ GPA_Status GPA_SessionRequests::GetSampleCount(gpa_uint32* pSamples)
         return GPA_STATUS_ERROR_NULL_POINTER;
     }
 
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     // make sure there is at least one request
     if (m_passes.size() == 0)
     {
@@ -102,7 +289,7 @@ GPA_Status GPA_SessionRequests::GetSampleCount(gpa_uint32* pSamples)
     }
     else
     {
-        *pSamples = (gpa_uint32)(m_passes[0].m_results.size());
+        *pSamples = m_passes[0].m_sampleCount;
     }
 
     return status;
@@ -114,26 +301,51 @@ void GPA_SessionRequests::Begin(gpa_uint32 passIndex, gpa_uint32 sampleId, GPA_D
     TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::Begin);
     assert(nullptr != pRequest);
 
-    GPA_CounterResults result = { 0, nullptr };
-
-    // Prevent memory leak by making sure we clear up all profiler results we allocate.
-    // We will delete all the memory allocated in the destructor.
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     assert(passIndex < m_passes.size());
-    //add the request to the pending requests list
-    m_passes[passIndex].m_samples[sampleId] = pRequest;
-    result.m_numResults    = pRequest->NumActiveCounters();
-    result.m_pResultBuffer = new(std::nothrow) gpa_uint64[result.m_numResults];
+    GPA_PassRequests& pass = m_passes[passIndex];
+
+    // every request in a pass collects the same counters, so the first one determines the size of each slot's results
+    if (0 == pass.m_sampleCount)
+    {
+        pass.m_countersPerSample = pRequest->NumActiveCounters();
+    }
+
+    assert(pass.m_countersPerSample == pRequest->NumActiveCounters());
 
-    if (nullptr == result.m_pResultBuffer)
+    gpa_uint32 slot = AddSampleSlot(sampleId);
+
+    if (slot >= pass.m_slotStates.size())
     {
-        GPA_LogError("Unable to allocate memory for session results");
+        // grow to cover all the slots known so far, which are usually all the samples of the pass
+        size_t slotCount = std::max(static_cast<size_t>(slot) + 1, m_slotSampleIds.size());
+        pass.m_slotStates.resize(slotCount, GPA_SAMPLE_SLOT_EMPTY);
+        pass.m_requests.resize(slotCount, nullptr);
+        pass.m_results.resize(slotCount * pass.m_countersPerSample);
+    }
+
+    if (GPA_SAMPLE_SLOT_EMPTY == pass.m_slotStates[slot])
+    {
+        pass.m_sampleCount++;
+    }
+
+    if (GPA_SAMPLE_SLOT_PENDING == pass.m_slotStates[slot])
+    {
+        // the sample is restarted before the results of its previous request were collected, so only the new request's results are kept;
+        // the previous request may still be in use by the GPU until the requests submitted after it are complete
+        pass.m_supersededRequests.push_back(pass.m_requests[slot]);
     }
     else
     {
-        m_passes[passIndex].m_results[sampleId] = result;
-        m_allocatedResultBuffer.push_back(result.m_pResultBuffer);
+        pass.m_pendingCount++;
+        m_pendingRequestCount++;
     }
+
+    //add the request to the pending requests list
+    pass.m_requests[slot] = pRequest;
+    pass.m_slotStates[slot] = GPA_SAMPLE_SLOT_PENDING;
+    pass.m_pendingSlots.push_back(slot);
 }
 
 //-----------------------------------------------------------------------------
@@ -141,45 +353,77 @@ bool GPA_SessionRequests::End(gpa_uint32 passIndex, gpa_uint32 sampleId)
 {
     TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::End);
 
-    if (ContainsSampleRequest(passIndex, sampleId) == false)
+    bool isEnded = false;
+
     {
-        return false;
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        gpa_uint32 slot = 0;
+
+        if (FindSampleSlot(sampleId, slot) == false || GetSlotState(passIndex, slot) != GPA_SAMPLE_SLOT_PENDING)
+        {
+            return false;
+        }
+
+        isEnded = m_passes[passIndex].m_requests[slot]->End();
     }
 
-    return m_passes[passIndex].m_samples[sampleId]->End();
+    if (isEnded && m_isBackgroundCollectionEnabled && nullptr != m_pContextState)
+    {
+        // let the background collection thread know there is a request to collect
+        m_pContextState->NotifyResultCollector();
+    }
+
+    return isEnded;
 }
 
 //-----------------------------------------------------------------------------
-bool GPA_SessionRequests::ContainsSampleRequest(gpa_uint32 passIndex, gpa_uint32 sampleId)
+bool GPA_SessionRequests::FindSampleSlot(gpa_uint32 sampleId, gpa_uint32& slot) const
 {
-    TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::ContainsSampleRequest);
+    std::unordered_map<gpa_uint32, gpa_uint32>::const_iterator slotIter = m_sampleSlots.find(sampleId);
 
-    if (passIndex >= m_passes.size())
+    if (slotIter == m_sampleSlots.end())
     {
         return false;
     }
 
-    return m_passes[passIndex].m_samples.find(sampleId) != m_passes[passIndex].m_samples.end();
+    slot = slotIter->second;
+    return true;
 }
 
 //-----------------------------------------------------------------------------
-bool GPA_SessionRequests::ContainsSampleResult(gpa_uint32 passIndex, gpa_uint32 sampleId)
+gpa_uint32 GPA_SessionRequests::AddSampleSlot(gpa_uint32 sampleId)
 {
-    TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::ContainsSampleResult);
+    gpa_uint32 newSlot = static_cast<gpa_uint32>(m_slotSampleIds.size());
 
-    if (passIndex >= m_passes.size())
-    {
-        return false;
-    }
+    std::pair<std::unordered_map<gpa_uint32, gpa_uint32>::iterator, bool> insertResult = m_sampleSlots.insert(std::make_pair(sampleId, newSlot));
 
-    if (ContainsSampleRequest(passIndex, sampleId))
+    if (insertResult.second)
     {
-        return false;
+        m_slotSampleIds.push_back(sampleId);
     }
-    else
+
+    return insertResult.first->second;
+}
+
+//-----------------------------------------------------------------------------
+GPA_CounterResults GPA_SessionRequests::GetSlotResults(gpa_uint32 passIndex, gpa_uint32 slot)
+{
+    GPA_PassRequests& pass = m_passes[passIndex];
+
+    GPA_CounterResults results = { pass.m_countersPerSample, pass.m_results.data() + (slot * pass.m_countersPerSample) };
+    return results;
+}
+
+//-----------------------------------------------------------------------------
+gpa_uint8 GPA_SessionRequests::GetSlotState(gpa_uint32 passIndex, gpa_uint32 slot) const
+{
+    if (passIndex >= m_passes.size() || slot >= m_passes[passIndex].m_slotStates.size())
     {
-        return m_passes[passIndex].m_results.find(sampleId) != m_passes[passIndex].m_results.end();
+        return GPA_SAMPLE_SLOT_EMPTY;
     }
+
+    return m_passes[passIndex].m_slotStates[slot];
 }
 
 //-----------------------------------------------------------------------------
@@ -200,15 +444,22 @@ GPA_Status GPA_SessionRequests::IsSampleReady(gpa_uint32 sampleId, bool* pIsSamp
 
         IsComplete();
 
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        gpa_uint32 slot = 0;
+        bool slotFound = FindSampleSlot(sampleId, slot);
+
         for (gpa_uint32 passIndex = 0; passIndex < m_passes.size(); ++passIndex)
         {
-            if (ContainsSampleResult(passIndex, sampleId) == false)
+            gpa_uint8 slotState = slotFound ? GetSlotState(passIndex, slot) : static_cast<gpa_uint8>(GPA_SAMPLE_SLOT_EMPTY);
+
+            if (GPA_SAMPLE_SLOT_COMPLETE != slotState)
             {
                 // the result was not ready for this pass / sample.
                 *pIsSampleReady = false;
 
                 // make sure the request is available
-                if (ContainsSampleRequest(passIndex, sampleId) == false)
+                if (GPA_SAMPLE_SLOT_PENDING != slotState)
                 {
                     // request was not available
                     status = GPA_STATUS_ERROR_SAMPLE_NOT_FOUND_IN_ALL_PASSES;
@@ -227,58 +478,186 @@ bool GPA_SessionRequests::IsComplete()
 {
     TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::IsComplete);
 
-    bool result = true;
+    bool isComplete = false;
+
+    if (0 == m_pendingRequestCount)
+    {
+        // nothing is outstanding, so there is nothing to poll
+        isComplete = true;
+    }
+    else if (m_isBackgroundCollectionEnabled)
+    {
+        // the background collection thread polls the requests, the count drops to zero once it has collected them all
+        return false;
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        isComplete = PollPendingRequests();
+    }
+
+    if (isComplete && m_hasCompletionCallbacks)
+    {
+        RunCompletionCallbacks();
+    }
+
+    return isComplete;
+}
+
+//-----------------------------------------------------------------------------
+void GPA_SessionRequests::AddCompletionCallback(const std::function<void()>& callback)
+{
+    TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::AddCompletionCallback);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_completionCallbacks.push_back(callback);
+        m_hasCompletionCallbacks = true;
+    }
+
+    // the session may already be complete, in which case nothing else would find it complete again
+    IsComplete();
+}
+
+//-----------------------------------------------------------------------------
+bool GPA_SessionRequests::HasCompletionCallbacks() const
+{
+    return m_hasCompletionCallbacks;
+}
+
+//-----------------------------------------------------------------------------
+void GPA_SessionRequests::RunCompletionCallbacks()
+{
+    std::vector< std::function<void()> > callbacks;
+
+    if (TakeCompletionCallbacks(callbacks))
+    {
+        CallCompletionCallbacks(callbacks);
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool GPA_SessionRequests::TakeCompletionCallbacks(std::vector< std::function<void()> >& callbacks)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // a request may have been started since the caller found the session complete
+    if (0 != m_pendingRequestCount || m_completionCallbacks.empty())
+    {
+        return false;
+    }
+
+    callbacks.swap(m_completionCallbacks);
+    m_completionCallbacks.clear();
+    m_hasCompletionCallbacks = false;
+
+    // counted while the mutex is held, so a thread which finds no callbacks left also sees these ones running
+    m_runningCompletionCallbacks++;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void GPA_SessionRequests::CallCompletionCallbacks(const std::vector< std::function<void()> >& callbacks)
+{
+    // the callbacks read the results of the session, so they are called without holding the mutex
+    s_completionCallbackDepth++;
 
+    for (auto& callback : callbacks)
+    {
+        callback();
+    }
+
+    s_completionCallbackDepth--;
 
-    // this will contain the pass index and sample id of the results which became available and got copied into the
-    // results buffer. This list is then used to remove the requests so that they are not checked the next time this
-    // function is called.
-    std::list<PassIndexAndSampleIdPair> completedSamples;
+    // notified while the mutex is held, since a waiting thread may destroy the session as soon as it can lock it
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_runningCompletionCallbacks--;
+
+    if (0 == m_runningCompletionCallbacks)
+    {
+        m_completionCallbacksCondition.notify_all();
+    }
+}
 
-    gpa_uint32 passIndex = 0;
+//-----------------------------------------------------------------------------
+bool GPA_SessionRequests::IsInCompletionCallback()
+{
+    return 0 != s_completionCallbackDepth;
+}
+
+//-----------------------------------------------------------------------------
+void GPA_SessionRequests::WaitForCompletionCallbacks()
+{
+    // the entry points which reuse or destroy sessions reject calls from a callback, which could be waiting for itself here
+    assert(!IsInCompletionCallback());
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_completionCallbacksCondition.wait(lock, [this] { return 0 == m_runningCompletionCallbacks; });
+}
+
+//-----------------------------------------------------------------------------
+bool GPA_SessionRequests::PollPendingRequests()
+{
+    if (0 == m_pendingRequestCount)
+    {
+        return true;
+    }
 
-    for (std::vector<GPA_PassRequests>::iterator passIter = m_passes.begin(); passIter != m_passes.end(); ++passIter)
+    for (gpa_uint32 passIndex = 0; passIndex < m_passes.size(); ++passIndex)
     {
-        for (std::map<gpa_uint32, GPA_DataRequest*>::iterator requestIter = passIter->m_samples.begin(); requestIter != passIter->m_samples.end(); ++requestIter)
+        GPA_PassRequests& pass = m_passes[passIndex];
+
+        if (0 == pass.m_pendingCount)
+        {
+            continue;
+        }
+
+        while (pass.m_firstPendingSlot < pass.m_pendingSlots.size())
         {
-            gpa_uint32 sampleId = requestIter->first;
+            gpa_uint32 slot = pass.m_pendingSlots[pass.m_firstPendingSlot];
 
-            // only need to check to see if it is complete if the result is not already back.
-            if (ContainsSampleResult(passIndex, sampleId) == false)
+            // a slot is queued again if its sample is restarted within the pass, whichever entry comes second finds it complete
+            if (GPA_SAMPLE_SLOT_PENDING == pass.m_slotStates[slot])
             {
+                GPA_CounterResults slotResults = GetSlotResults(passIndex, slot);
+
                 // check sample within the pass
-                if (!requestIter->second->IsRequestComplete(passIter->m_results[sampleId]))
+                if (!pass.m_requests[slot]->IsRequestComplete(slotResults))
                 {
-                    result = false;
+                    // the requests after this one were submitted later, so they are not expected to be complete either
+                    break;
                 }
-                else
-                {
-                    // The request is complete and the results are available.
 
-                    // Now mark the data request to be removed.
-                    PassIndexAndSampleIdPair pair;
-                    pair.first = passIndex;
-                    pair.second = sampleId;
-                    completedSamples.push_back(pair);
-                }
+                // since the results are backed up, now the data request can be reused by another sample
+                ReleaseRequest(passIndex, pass.m_requests[slot]);
+                pass.m_requests[slot] = nullptr;
+                pass.m_slotStates[slot] = GPA_SAMPLE_SLOT_COMPLETE;
+
+                pass.m_pendingCount--;
+                m_pendingRequestCount--;
             }
+
+            pass.m_firstPendingSlot++;
         }
 
-        ++passIndex;
-    }
+        if (pass.m_firstPendingSlot == pass.m_pendingSlots.size())
+        {
+            // everything in the FIFO has been completed, so its storage can be reused
+            pass.m_pendingSlots.clear();
+            pass.m_firstPendingSlot = 0;
 
-    // remove the completed samples
-    for (std::list<PassIndexAndSampleIdPair>::iterator iter = completedSamples.begin(); iter != completedSamples.end(); ++iter)
-    {
-        // since the results are backed up, now we can delete the data request
-        delete m_passes[iter->first].m_samples[iter->second];
-        m_passes[iter->first].m_samples[iter->second] = nullptr;
-        m_passes[iter->first].m_samples.erase(iter->second);
-    }
+            // the requests which were superseded were submitted before those, so they are complete as well
+            for (GPA_DataRequest* pSupersededRequest : pass.m_supersededRequests)
+            {
+                ReleaseRequest(passIndex, pSupersededRequest);
+            }
 
-    completedSamples.clear();
+            pass.m_supersededRequests.clear();
+        }
+    }
 
-    return result;
+    return 0 == m_pendingRequestCount;
 }
 
 //-----------------------------------------------------------------------------
@@ -293,36 +672,36 @@ GPA_Status GPA_SessionRequests::GetResult(gpa_uint32 passIndex, gpa_uint32 sampl
     }
 
     // ensure counter pass is valid
-    if (passIndex >= m_passes.size())
+    if (passIndex >= GetPassCount())
     {
         std::stringstream message;
-        message << "'passIndex' is " << passIndex << " but must be less than the number of pass requests (" << m_passes.size() << ").";
+        message << "'passIndex' is " << passIndex << " but must be less than the number of pass requests (" << GetPassCount() << ").";
         GPA_LogDebugError(message.str().c_str());
         return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
     }
 
     // block until results are available
-    Flush();
+    GPA_Status flushStatus = Flush();
+
+    if (GPA_STATUS_OK != flushStatus)
+    {
+        return flushStatus;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     // first look for the existing result
-    if (ContainsSampleResult(passIndex, sampleId))
+    gpa_uint32 slot = 0;
+
+    if (FindSampleSlot(sampleId, slot) && GetSlotState(passIndex, slot) == GPA_SAMPLE_SLOT_COMPLETE)
     {
         // already have the result, return it
-        GPA_CounterResults& counterResults = m_passes[passIndex].m_results[sampleId];
+        GPA_PassRequests& pass = m_passes[passIndex];
 
-        if (counterOffset < counterResults.m_numResults)
+        if (counterOffset < pass.m_countersPerSample)
         {
             gpa_uint64* pBuf = (gpa_uint64*)pResult;
-            assert(nullptr != counterResults.m_pResultBuffer);
-
-            if (nullptr != counterResults.m_pResultBuffer)
-            {
-                *pBuf = counterResults.m_pResultBuffer[counterOffset];
-            }
-            else
-            {
-                *pBuf = 0;
-            }
+            *pBuf = pass.m_results[(slot * pass.m_countersPerSample) + counterOffset];
         }
         else
         {
@@ -342,3 +721,117 @@ GPA_Status GPA_SessionRequests::GetResult(gpa_uint32 passIndex, gpa_uint32 sampl
 
     return GPA_STATUS_OK;
 }
+
+//-----------------------------------------------------------------------------
+GPA_Status GPA_SessionRequests::GetSampleResults(gpa_uint32 sampleId, std::vector<GPA_CounterResults>& passResults)
+{
+    TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::GetSampleResults);
+
+    // block until results are available
+    GPA_Status flushStatus = Flush();
+
+    if (GPA_STATUS_OK != flushStatus)
+    {
+        return flushStatus;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    passResults.resize(m_passes.size());
+
+    gpa_uint32 slot = 0;
+    bool slotFound = FindSampleSlot(sampleId, slot);
+
+    for (gpa_uint32 passIndex = 0; passIndex < m_passes.size(); ++passIndex)
+    {
+        if (!slotFound || GetSlotState(passIndex, slot) != GPA_SAMPLE_SLOT_COMPLETE)
+        {
+            std::stringstream message;
+            message << "Pass " << passIndex << " does not contain a result for sample ID " << sampleId << ".";
+            GPA_LogDebugError(message.str().c_str());
+            return GPA_STATUS_ERROR_SAMPLE_NOT_FOUND;
+        }
+
+        passResults[passIndex] = GetSlotResults(passIndex, slot);
+    }
+
+    return GPA_STATUS_OK;
+}
+
+//-----------------------------------------------------------------------------
+GPA_Status GPA_SessionRequests::GetSessionResults(std::vector<gpa_uint32>& sampleIds, std::vector<GPA_CounterResults>& sampleResults)
+{
+    TRACE_PRIVATE_FUNCTION(GPA_SessionRequests::GetSessionResults);
+
+    sampleIds.clear();
+    sampleResults.clear();
+
+    if (GetPassCount() == 0)
+    {
+        std::stringstream message;
+        message << "No counters were enabled in session " << m_sessionID << ".";
+        GPA_LogError(message.str().c_str());
+        return GPA_STATUS_ERROR_NOT_FOUND;
+    }
+
+    // block until results are available
+    GPA_Status flushStatus = Flush();
+
+    if (GPA_STATUS_OK != flushStatus)
+    {
+        return flushStatus;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    size_t passCount = m_passes.size();
+    size_t sampleCount = m_passes[0].m_sampleCount;
+
+    // the samples of the first pass, ordered by sample ID
+    std::vector<SampleIdAndSlotPair> samples;
+    samples.reserve(sampleCount);
+
+    for (gpa_uint32 slot = 0; slot < m_passes[0].m_slotStates.size(); ++slot)
+    {
+        if (GPA_SAMPLE_SLOT_EMPTY != m_passes[0].m_slotStates[slot])
+        {
+            samples.push_back(SampleIdAndSlotPair(m_slotSampleIds[slot], slot));
+        }
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    sampleIds.reserve(sampleCount);
+    sampleResults.resize(sampleCount * passCount);
+
+    for (size_t passIndex = 0; passIndex < passCount; ++passIndex)
+    {
+        if (m_passes[passIndex].m_sampleCount != sampleCount)
+        {
+            GPA_LogError("All passes must contain the same number of samples in order for the data to be collected successfully.");
+            return GPA_STATUS_ERROR_VARIABLE_NUMBER_OF_SAMPLES_IN_PASSES;
+        }
+
+        for (size_t sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+        {
+            gpa_uint32 slot = samples[sampleIndex].second;
+
+            if (GetSlotState(static_cast<gpa_uint32>(passIndex), slot) != GPA_SAMPLE_SLOT_COMPLETE)
+            {
+                std::stringstream message;
+                message << "Pass " << passIndex << " does not contain a result for sample ID " << samples[sampleIndex].first << ".";
+                GPA_LogError(message.str().c_str());
+                return GPA_STATUS_ERROR_SAMPLE_NOT_FOUND_IN_ALL_PASSES;
+            }
+
+            sampleResults[(sampleIndex * passCount) + passIndex] = GetSlotResults(static_cast<gpa_uint32>(passIndex), slot);
+        }
+    }
+
+    for (size_t sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+    {
+        sampleIds.push_back(samples[sampleIndex].first);
+    }
+
+    return GPA_STATUS_OK;
+}
@@ -10,23 +10,85 @@
 
 #include "GPUPerfAPITypes.h"
 #include "GPADataRequest.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <map>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
-/// Contains the data requests which are each sample of the profile session.
+/// The state of a sample slot within a pass.
+enum GPA_SampleSlotState
+{
+    GPA_SAMPLE_SLOT_EMPTY,    ///< The sample has not been started in the pass.
+    GPA_SAMPLE_SLOT_PENDING,  ///< The sample's data request has been started but its results have not been collected yet.
+    GPA_SAMPLE_SLOT_COMPLETE, ///< The sample's results have been collected into the pass's result block.
+};
+
+/// Contains the data requests and results of each sample of a pass of the profile session.
+/// Samples are stored in slots which are shared by all the passes of the session, so a sample uses the same slot in every pass.
 struct GPA_PassRequests
 {
-    /// Maps a sample ID to the data request which handled that sample.
-    std::map<gpa_uint32, GPA_DataRequest*> m_samples;
+    /// Initializes a new instance of the GPA_PassRequests struct.
+    GPA_PassRequests()
+        : m_countersPerSample(0),
+          m_sampleCount(0),
+          m_firstPendingSlot(0),
+          m_pendingCount(0)
+    {
+    }
+
+    /// Removes all the samples from the pass, keeping the allocated storage for reuse.
+    void Reset()
+    {
+        m_slotStates.clear();
+        m_requests.clear();
+        m_results.clear();
+        m_countersPerSample = 0;
+        m_sampleCount = 0;
+        m_pendingSlots.clear();
+        m_firstPendingSlot = 0;
+        m_pendingCount = 0;
+        m_supersededRequests.clear();
+    }
+
+    /// The GPA_SampleSlotState of each sample slot.
+    std::vector<gpa_uint8> m_slotStates;
+
+    /// The data request which is handling each pending sample slot, or nullptr if the slot is not pending.
+    std::vector<GPA_DataRequest*> m_requests;
 
-    /// Maps a sample ID to a set of counter results.
+    /// The counter results of every sample slot in one contiguous block; the results of a slot start at slot * m_countersPerSample.
     /// The results will get stored in here after the corresponding GPA_DataRequest::IsComplete() returns true.
-    /// This should allow us to delete the data request and save memory.
-    std::map<gpa_uint32, GPA_CounterResults> m_results;
+    /// This allows us to delete the data request and save memory.
+    std::vector<gpa_uint64> m_results;
+
+    /// The number of counter results of each sample in this pass.
+    size_t m_countersPerSample;
+
+    /// The number of samples which were started in this pass.
+    gpa_uint32 m_sampleCount;
+
+    /// FIFO of the slots whose requests are outstanding, in the order the requests were submitted.
+    /// Entries before m_firstPendingSlot have already been completed.
+    std::vector<gpa_uint32> m_pendingSlots;
+
+    /// The index of the oldest entry of m_pendingSlots which may still be outstanding.
+    size_t m_firstPendingSlot;
+
+    /// The number of requests in this pass whose results have not been collected yet.
+    gpa_uint32 m_pendingCount;
+
+    /// The requests of samples which were restarted in this pass before their results were collected.
+    /// They are released once every request submitted before the end of the pass is complete.
+    std::vector<GPA_DataRequest*> m_supersededRequests;
 };
 
 /// Maintains all the data requests needed for an entire session.
+/// The session may be accessed by the application thread and by the background result collection thread of its context,
+/// so its passes are protected by a mutex.
 class GPA_SessionRequests
 {
 public:
@@ -37,14 +99,54 @@ public:
     /// Destructor which flushes and deletes all tracked requests
     virtual ~GPA_SessionRequests();
 
-    /// Waits for all data requests to be complete (blocking).
-    virtual void Flush();
+    /// Waits for all data requests to be complete (blocking), as directed by the session's flush wait policy.
+    /// \param useTimeout Indicates whether the flush wait policy's timeout applies; if false, this waits until all the requests are complete.
+    /// \return GPA_STATUS_ERROR_TIMEOUT if the timeout elapsed before all the requests were complete; GPA_STATUS_OK otherwise.
+    virtual GPA_Status Flush(bool useTimeout = true);
+
+    /// Sets how Flush waits for outstanding data requests.
+    /// \param policy The wait policy.
+    /// \param timeoutMilliseconds The time after which Flush gives up waiting, or 0 to wait until the requests are complete.
+    void SetFlushWaitPolicy(GPA_Flush_Wait_Policy policy, gpa_uint32 timeoutMilliseconds);
+
+    /// Sets the context which owns the session.
+    /// Once their results are collected, data requests are returned to the context to be reused by later samples;
+    /// if no context is set, they are deleted instead.
+    /// \param pContextState The context which owns the session.
+    void SetContextState(GPA_ContextState* pContextState);
+
+    /// Sets whether the results of the session are collected by the background result collection thread of its context.
+    /// When enabled, IsComplete and CheckForAvailableResults no longer poll the data requests themselves.
+    /// \param isEnabled Indicates whether the background result collection thread is collecting the results.
+    void SetBackgroundResultCollection(bool isEnabled);
+
+    /// Polls the outstanding data requests and stores the results of those which are complete.
+    /// This is what the background result collection thread calls for each session; it does not call the completion callbacks,
+    /// which the thread takes with TakeCompletionCallbacks so that it can call them without holding the mutex of its context.
+    /// \return true if all the samples are complete; false if one or more samples is not complete.
+    bool CollectAvailableResults();
+
+    /// Removes the completion callbacks if the session is complete, so that they can be called later by CallCompletionCallbacks.
+    /// The session counts them as running from now on, so it is not reused or destroyed before they have been called.
+    /// \param[out] callbacks Will contain the completion callbacks of the session.
+    /// \return true if the callbacks were taken and CallCompletionCallbacks must be called with them; false otherwise.
+    bool TakeCompletionCallbacks(std::vector< std::function<void()> >& callbacks);
+
+    /// Calls the completion callbacks which were taken by TakeCompletionCallbacks.
+    /// The caller must not hold m_mutex.
+    /// \param callbacks The completion callbacks of the session.
+    void CallCompletionCallbacks(const std::vector< std::function<void()> >& callbacks);
+
+    /// Waits until no completion callbacks are being called by another thread, so that the samples they read can be dropped.
+    /// It must not be called from a completion callback.
+    void WaitForCompletionCallbacks();
 
     /// Checks each of the data requests in the specified pass to see if their results are available.
     /// \param passIndex The 0-based index of the pass to check for available results.
     void CheckForAvailableResults(gpa_uint32 passIndex);
 
     /// Set the number of passes that will be needed for the session.
+    /// This also removes any samples left over from a previous use of the session.
     /// \param passCount The necessary number of passes.
     void SetPassCount(gpa_uint32 passCount);
 
@@ -78,9 +180,27 @@ public:
     GPA_Status IsSampleReady(gpa_uint32 sampleId, bool* pIsSampleReady);
 
     /// Indicates whether or not all the samples in the session are complete.
+    /// Each pass is polled in submission order, stopping at its first request which is not complete;
+    /// if no requests are outstanding, or the results are collected in the background, this just checks the number of outstanding requests.
     /// \return true if all the samples are complete; false if one or more samples is not complete.
     bool IsComplete();
 
+    /// Adds a function to call once all the data requests of the session are complete.
+    /// It is called on whichever thread finds the session complete, without holding the session's mutex;
+    /// if the session is already complete, it is called before this returns.
+    /// The session must have been ended, otherwise it may be found complete before all its passes have been submitted.
+    /// \param callback The function to call.
+    void AddCompletionCallback(const std::function<void()>& callback);
+
+    /// Indicates whether any completion callbacks are waiting for the session to be complete.
+    /// \return true if one or more completion callbacks have not been called yet; false otherwise.
+    bool HasCompletionCallbacks() const;
+
+    /// Indicates whether the calling thread is inside a completion callback.
+    /// A callback which waited for the sessions to be reused or destroyed would wait for itself, so such calls are rejected.
+    /// \return true if the calling thread is running the completion callbacks of a session; false otherwise.
+    static bool IsInCompletionCallback();
+
     /// Get a specific counter result from within a data request for the specified pass and sample.
     /// \param passIndex The pass index which contains the desired sample.
     /// \param sampleId The sample ID which contains the desired counter result.
@@ -88,40 +208,131 @@ public:
     /// \param[in,out] pResult Will point to the memory which contains the counter result.
     /// \return GPA_STATUS_ERROR_NULL_POINTER if pResult is nullptr;
     ///    GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE if the pass index is not valid;
+    ///    GPA_STATUS_ERROR_TIMEOUT if the result did not become available in time;
     ///    GPA_STATUS_ERROR_SAMPLE_NOT_FOUND if the sample ID is not contained in the pass;
     ///    GPA_STATUS_ERROR_READING_COUNTER_RESULT if an error occurred while attempting to read back the specific counter result;
     ///    GPA_STATUS_OK on success and pResult will point to the counter result.
     GPA_Status GetResult(gpa_uint32 passIndex, gpa_uint32 sampleId, gpa_uint16 counterOffset, void* pResult);
 
+    /// Get the counter results of every pass for the specified sample.
+    /// This blocks until all the results of the session are available, and does so only once for the whole sample.
+    /// \param sampleId The sample ID whose counter results are needed.
+    /// \param[out] passResults Will contain the counter results of each pass, indexed by pass.
+    /// \return GPA_STATUS_ERROR_TIMEOUT if the results did not become available in time;
+    ///    GPA_STATUS_ERROR_SAMPLE_NOT_FOUND if one of the passes does not contain the sample ID;
+    ///    GPA_STATUS_OK on success.
+    GPA_Status GetSampleResults(gpa_uint32 sampleId, std::vector<GPA_CounterResults>& passResults);
+
+    /// Get the counter results of every pass for every sample in the session.
+    /// This blocks until all the results of the session are available.
+    /// \param[out] sampleIds Will contain the ID of each sample in the session, in ascending order.
+    /// \param[out] sampleResults Will contain the counter results of each pass for each sample;
+    ///    the results of pass p for the sample sampleIds[s] are at index (s * GetPassCount()) + p.
+    /// \return GPA_STATUS_ERROR_NOT_FOUND if there are no passes in the session;
+    ///    GPA_STATUS_ERROR_TIMEOUT if the results did not become available in time;
+    ///    GPA_STATUS_ERROR_VARIABLE_NUMBER_OF_SAMPLES_IN_PASSES if the passes do not all contain the same number of samples;
+    ///    GPA_STATUS_ERROR_SAMPLE_NOT_FOUND_IN_ALL_PASSES if a sample ID is not contained in every pass;
+    ///    GPA_STATUS_OK on success.
+    GPA_Status GetSessionResults(std::vector<gpa_uint32>& sampleIds, std::vector<GPA_CounterResults>& sampleResults);
+
     /// The session ID of this session.
     unsigned int m_sessionID;
 
 private:
 
-    /// Checks whether or not the session contains the specified pass and sample request.
-    /// \param passIndex The pass index to check for.
-    /// \param sampleId The sample ID to check for.
-    /// \return true if the session contains the sample in the pass; false otherwise.
-    bool ContainsSampleRequest(gpa_uint32 passIndex, gpa_uint32 sampleId);
+    /// Waits between two polls of the outstanding data requests in Flush.
+    /// \param pollCount The number of times the requests have been polled so far during this flush.
+    /// \param timeoutMilliseconds The time remaining before the flush times out, or 0 if there is no timeout.
+    void WaitForRequests(gpa_uint32 pollCount, gpa_uint32 timeoutMilliseconds);
+
+    /// Polls each pass in submission order, stopping at its first request which is not complete.
+    /// The caller must hold m_mutex.
+    /// \return true if all the samples are complete; false if one or more samples is not complete.
+    bool PollPendingRequests();
+
+    /// Calls and removes the completion callbacks if the session is complete.
+    /// The caller must not hold m_mutex.
+    void RunCompletionCallbacks();
+
+    /// Returns a data request whose results are no longer needed to the context to be reused, or deletes it if the session has no context.
+    /// \param passIndex The pass of the request.
+    /// \param pRequest The request to release.
+    void ReleaseRequest(gpa_uint32 passIndex, GPA_DataRequest* pRequest);
+
+    /// Gets the oldest data request whose results have not been collected.
+    /// \return The oldest outstanding data request, or nullptr if there are none.
+    GPA_DataRequest* GetOldestPendingRequest();
+
+    /// Finds the slot which holds the specified sample.
+    /// \param sampleId The sample ID to look for.
+    /// \param[out] slot Will contain the slot of the sample if it is found.
+    /// \return true if the sample ID has a slot; false otherwise.
+    bool FindSampleSlot(gpa_uint32 sampleId, gpa_uint32& slot) const;
+
+    /// Gets the slot which holds the specified sample, adding a new slot if the sample ID does not have one yet.
+    /// \param sampleId The sample ID whose slot is needed.
+    /// \return The slot of the sample.
+    gpa_uint32 AddSampleSlot(gpa_uint32 sampleId);
+
+    /// Gets the counter results of a sample slot within a pass.
+    /// The returned results point into the pass's result block, so they are only valid until another sample is started in the pass.
+    /// \param passIndex The pass which contains the sample slot.
+    /// \param slot The sample slot whose results are needed.
+    /// \return The counter results of the sample slot.
+    GPA_CounterResults GetSlotResults(gpa_uint32 passIndex, gpa_uint32 slot);
 
-    /// Checks whether or not the session contains the specified pass and sample result.
-    /// \param passIndex The pass index to check for.
-    /// \param sampleId The sample ID to check for.
-    /// \return true if the session contains a result for the sample in the pass; false otherwise.
-    bool ContainsSampleResult(gpa_uint32 passIndex, gpa_uint32 sampleId);
+    /// Gets the state of a sample slot within a pass.
+    /// \param passIndex The pass which contains the sample slot.
+    /// \param slot The sample slot whose state is needed.
+    /// \return The GPA_SampleSlotState of the sample slot, GPA_SAMPLE_SLOT_EMPTY if the pass or slot is out of range.
+    gpa_uint8 GetSlotState(gpa_uint32 passIndex, gpa_uint32 slot) const;
 
-    /// List of passes, which are defined by a list of samples,
+    /// List of passes, which are defined by a list of sample slots,
     /// which are defined by a set of individual counter data requests.
     /// (ie, a 'session' is a set of 'passes' is a set of 'samples' is a set of 'requests').
     /// sorted by pass to allow consecutive session requests on same counters
     /// to reuse resources from a previous request
     /// there should only ever be one "owner" pointer to these requests
-    /// here or in the expired session requests
+    /// here or in the data request pool of the context
     std::vector<GPA_PassRequests> m_passes;
 
-    /// vector to save allocated result.pResultBuffer
-    /// this vector will be used to delete all allocated result.pResultBuffer memory
-    std::vector<gpa_uint64*> m_allocatedResultBuffer;
+    /// Maps a sample ID to the slot which holds that sample in every pass.
+    std::unordered_map<gpa_uint32, gpa_uint32> m_sampleSlots;
+
+    /// The sample ID held by each slot.
+    std::vector<gpa_uint32> m_slotSampleIds;
+
+    /// The number of requests in all passes whose results have not been collected yet.
+    /// It is only modified while m_mutex is held, but it may be read without it to check whether the session is complete.
+    std::atomic<gpa_uint32> m_pendingRequestCount;
+
+    /// Synchronizes access to the passes and samples between the application thread and the background result collection thread.
+    std::mutex m_mutex;
+
+    /// The functions to call once all the data requests of the session are complete. Protected by m_mutex.
+    std::vector< std::function<void()> > m_completionCallbacks;
+
+    /// Indicates whether m_completionCallbacks is not empty, so that it can be checked without locking m_mutex.
+    std::atomic<bool> m_hasCompletionCallbacks;
+
+    /// The number of threads which are calling completion callbacks of the session. Protected by m_mutex.
+    gpa_uint32 m_runningCompletionCallbacks;
+
+    /// Signalled when m_runningCompletionCallbacks drops to zero.
+    std::condition_variable m_completionCallbacksCondition;
+
+    /// How Flush waits for outstanding data requests.
+    GPA_Flush_Wait_Policy m_flushWaitPolicy;
+
+    /// The time in milliseconds after which Flush gives up waiting, or 0 to wait until the requests are complete.
+    gpa_uint32 m_flushTimeout;
+
+    /// Indicates whether the results of this session are collected by the background result collection thread.
+    /// It is atomic because the application thread changes it while the background thread may be running.
+    std::atomic<bool> m_isBackgroundCollectionEnabled;
+
+    /// The context which owns this session and pools its completed data requests.
+    GPA_ContextState* m_pContextState;
 
     /// List of memory references for this session's data requests
     std::vector<void*> m_memoryRefs;
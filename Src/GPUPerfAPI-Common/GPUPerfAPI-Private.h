@@ -42,7 +42,7 @@ GPALIB_DECL GPA_Status GPA_InternalProfileStart();
 
 /// \brief Internal function. Unsupported and may be removed from the API at any time.
 ///
-/// \param pFilename the name of the file to write profile results
+/// \param pFilename the name of the file to write profile results; the results are written as JSON if the name ends with .json
 /// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
 GPALIB_DECL GPA_Status GPA_InternalProfileStop(const char* pFilename);
 
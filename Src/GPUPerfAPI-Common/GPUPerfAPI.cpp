@@ -20,6 +20,8 @@
 #include <sstream>
 #include <cstdio>
 #include <map>
+#include <memory>
+#include <mutex>
 
 #include "Logging.h"
 #include "GPAProfiler.h"
@@ -30,8 +32,26 @@
     #include "..\GPUPerfAPICounterGenerator\GPASwCounterManager.h"
 #endif // WIN32
 
-vector< GPA_ContextState* > g_Contexts;        ///< list of open contexts
-GPA_ContextState* g_pCurrentContext = nullptr; ///< pointer to current context
+/// The list of open contexts
+typedef vector< GPA_ContextState* > GPA_ContextList;
+
+/// List of open contexts.
+/// The list is never modified once published: opening or closing a context publishes a new copy,
+/// so that other threads can look up contexts without taking a lock.
+static std::shared_ptr<const GPA_ContextList> g_pContexts = std::make_shared<const GPA_ContextList>();
+
+/// Serializes the opening and closing of contexts, and so the publishing of g_pContexts
+static std::mutex g_contextsMutex;
+
+thread_local GPA_ContextState* g_pCurrentContext = nullptr; ///< pointer to current context of the calling thread
+
+//-----------------------------------------------------------------------------
+/// Gets the list of open contexts
+/// \return the list of open contexts at the time of the call
+static std::shared_ptr<const GPA_ContextList> GetContexts()
+{
+    return std::atomic_load(&g_pContexts);
+}
 
 //-----------------------------------------------------------------------------
 /// Lookup context
@@ -39,7 +59,9 @@ GPA_ContextState* g_pCurrentContext = nullptr; ///< pointer to current context
 /// \return the found ContextState or nullptr if not found
 GPA_ContextState* lookupContext(void* pContext)
 {
-    for (std::vector<GPA_ContextState*>::iterator contextIter = g_Contexts.begin(); contextIter != g_Contexts.end(); ++contextIter)
+    std::shared_ptr<const GPA_ContextList> pContexts = GetContexts();
+
+    for (GPA_ContextList::const_iterator contextIter = pContexts->begin(); contextIter != pContexts->end(); ++contextIter)
     {
         if ((*contextIter)->m_pContext == pContext)
         {
@@ -56,11 +78,12 @@ GPA_ContextState* lookupContext(void* pContext)
 /// \return the index of the found ContextState or -1 if not found
 int lookupContextState(GPA_ContextState* pContextState)
 {
-    int contextCount = static_cast<int>(g_Contexts.size());
+    std::shared_ptr<const GPA_ContextList> pContexts = GetContexts();
+    int contextCount = static_cast<int>(pContexts->size());
 
     for (int i = 0 ; i < contextCount ; i++)
     {
-        if (g_Contexts[i] == pContextState)
+        if ((*pContexts)[i] == pContextState)
         {
             return i;
         }
@@ -252,6 +275,9 @@ GPALIB_DECL GPA_Status GPA_Destroy()
 
     GPA_Status retStatus = GPA_IMP_Destroy();
 
+    // the logging thread is stopped here rather than by the destructor of the logger, which may run while the library is unloaded
+    g_loggerSingleton.StopLogging();
+
     return retStatus;
 }
 
@@ -273,6 +299,9 @@ GPALIB_DECL GPA_Status GPA_OpenContext(void* pContext)
         return GPA_STATUS_ERROR_NULL_POINTER;
     }
 
+    // only one thread at a time can open or close a context, so the same context can't be opened twice
+    std::lock_guard<std::mutex> lock(g_contextsMutex);
+
     // see if context already exists
     GPA_ContextState* pRetrievedContext = lookupContext(pContext);
 
@@ -306,6 +335,25 @@ GPALIB_DECL GPA_Status GPA_OpenContext(void* pContext)
         return GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED;
     }
 
+    // the open contexts share the generated counters, which would be generated again for another hardware generation
+    GDT_HW_GENERATION newGeneration = GDT_HW_GENERATION_NONE;
+    pNewContextState->m_hwInfo.GetHWGeneration(newGeneration);
+    std::shared_ptr<const GPA_ContextList> pContexts = GetContexts();
+
+    for (GPA_ContextList::const_iterator contextIter = pContexts->begin(); contextIter != pContexts->end(); ++contextIter)
+    {
+        GDT_HW_GENERATION openGeneration = GDT_HW_GENERATION_NONE;
+        (*contextIter)->m_hwInfo.GetHWGeneration(openGeneration);
+
+        if (openGeneration != newGeneration)
+        {
+            GPA_LogError("Another context is open on a different hardware generation. The contexts which are open at the same time must be on the same hardware generation.");
+            delete pNewContextState;
+            g_pCurrentContext = pOldContextState;
+            return GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED;
+        }
+    }
+
     // initialize context
     pNewContextState->m_pContext = pContext;
     pNewContextState->m_maxSessions = GPA_IMP_GetDefaultMaxSessions();
@@ -315,6 +363,8 @@ GPALIB_DECL GPA_Status GPA_OpenContext(void* pContext)
     if (!isSizeSet)
     {
         GPA_LogError("Error setting size of sessions.");
+        delete pNewContextState;
+        g_pCurrentContext = pOldContextState;
         return GPA_STATUS_ERROR_FAILED;
     }
 
@@ -322,13 +372,32 @@ GPALIB_DECL GPA_Status GPA_OpenContext(void* pContext)
 
     if (status != GPA_STATUS_OK)
     {
-        g_pCurrentContext = nullptr;
+        // the scheduler returned by the backend is shared by the contexts, so it must not be deleted with this one
+        pNewContextState->m_pCounterScheduler = nullptr;
         delete pNewContextState;
+        g_pCurrentContext = pOldContextState;
         return status;
     }
 
+    // each context enables counters and computes passes with its own scheduler, so that contexts do not change each other's counter selection
+    GPA_ICounterScheduler* pContextScheduler = pNewContextState->m_pCounterScheduler->CreateContextScheduler();
+
+    if (nullptr == pContextScheduler)
+    {
+        GPA_LogError("Unable to create the counter scheduler of the context.");
+        GPA_IMP_CloseContext();
+        pNewContextState->m_pCounterScheduler = nullptr;
+        delete pNewContextState;
+        g_pCurrentContext = pOldContextState;
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    pNewContextState->m_pCounterScheduler = pContextScheduler;
+
     // now that the counters could be opened, add the context
-    g_Contexts.push_back(pNewContextState);
+    std::shared_ptr<GPA_ContextList> pNewContexts = std::make_shared<GPA_ContextList>(*GetContexts());
+    pNewContexts->push_back(pNewContextState);
+    std::atomic_store(&g_pContexts, std::shared_ptr<const GPA_ContextList>(pNewContexts));
 
     gpa_uint32 vendorId = 0;
     g_pCurrentContext->m_hwInfo.GetVendorID(vendorId);
@@ -380,37 +449,63 @@ GPALIB_DECL GPA_Status GPA_CloseContext()
     PROFILE_FUNCTION(GPA_CloseContext);
     TRACE_FUNCTION(GPA_CloseContext);
 
+    if (GPA_SessionRequests::IsInCompletionCallback())
+    {
+        GPA_LogError("GPA_CloseContext cannot be called from a GPA_RequestSessionResultsAsync callback.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
     if (!g_pCurrentContext)
     {
         GPA_LogError("Please call GPA_OpenContext before GPA_CloseContext.");
         return GPA_STATUS_ERROR_COUNTERS_NOT_OPEN;
     }
 
+    std::lock_guard<std::mutex> lock(g_contextsMutex);
+
+    // another thread may have closed this thread's current context, in which case it must not be accessed
+    int currentContextIndex = lookupContextState(g_pCurrentContext);
+
+    if (-1 == currentContextIndex)
+    {
+        GPA_LogError("The current context has already been closed.");
+        g_pCurrentContext = nullptr;
+        return GPA_STATUS_ERROR_COUNTERS_NOT_OPEN;
+    }
+
     if (g_pCurrentContext->m_samplingStarted)
     {
         GPA_LogError("Please call GPA_EndSession before GPA_CloseContext.");
         return GPA_STATUS_ERROR_SAMPLING_NOT_ENDED;
     }
 
+    // remove the context first, so that no other thread can select it while it is being closed
+    std::shared_ptr<GPA_ContextList> pNewContexts = std::make_shared<GPA_ContextList>(*GetContexts());
+    pNewContexts->erase(pNewContexts->begin() + currentContextIndex);
+    std::atomic_store(&g_pContexts, std::shared_ptr<const GPA_ContextList>(pNewContexts));
+
     GPA_LogDebugMessage("GPA_CloseContext 0x%08x", g_pCurrentContext->m_pContext);
 
     g_pCurrentContext->m_pCounterScheduler->Reset();
 
-    GPA_Status retStatus = GPA_IMP_CloseContext();
+    // stop collecting results before the API objects are released
+    g_pCurrentContext->SetResultCollectionMode(GPA_RESULT_COLLECTION_APPLICATION_THREAD);
 
-    // erase all profile sessions
+    // erase all profile sessions, their data requests and completion callbacks still need the API objects
     g_pCurrentContext->m_profileSessions.clear();
 
+    // and the data requests they returned for reuse
+    g_pCurrentContext->ClearDataRequestPool();
+
+    GPA_Status retStatus = GPA_IMP_CloseContext();
+
     // delete the context that's currently open
-    int currentContextIndex = lookupContextState(g_pCurrentContext);
-    assert(currentContextIndex != -1);
-    g_Contexts.erase(g_Contexts.begin() + currentContextIndex);
     delete g_pCurrentContext;
 
-    // reassign the current context
-    if (g_Contexts.size() > 0)
+    // reassign the current context of this thread
+    if (pNewContexts->size() > 0)
     {
-        g_pCurrentContext = g_Contexts[0];
+        g_pCurrentContext = (*pNewContexts)[0];
     }
     else
     {
@@ -832,6 +927,59 @@ GPALIB_DECL GPA_Status GPA_GetCounterIndex(const char* pCounter, gpa_uint32* pIn
     return GPA_STATUS_OK;
 }
 
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetCounterIndices(const char** ppCounters, gpa_uint32 counterCount, gpa_uint32* pIndices)
+{
+    PROFILE_FUNCTION(GPA_GetCounterIndices);
+    TRACE_FUNCTION(GPA_GetCounterIndices);
+
+    if (nullptr == ppCounters)
+    {
+        GPA_LogError("Parameter 'ppCounters' is NULL.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    if (nullptr == pIndices)
+    {
+        GPA_LogError("Parameter 'pIndices' is NULL.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    if (nullptr == g_pCurrentContext)
+    {
+        GPA_LogError("GPA_OpenContext must return successfully before calling GPA_GetCounterIndices.");
+        return GPA_STATUS_ERROR_COUNTERS_NOT_OPEN;
+    }
+
+    if (nullptr == g_pCurrentContext->m_pCounterAccessor)
+    {
+        GPA_LogError("GPA_OpenContext must return successfully before calling GPA_GetCounterIndices.");
+        return GPA_STATUS_ERROR_COUNTERS_NOT_OPEN;
+    }
+
+    GPA_Status status = GPA_STATUS_OK;
+
+    for (gpa_uint32 i = 0; i < counterCount; i++)
+    {
+        if (nullptr == ppCounters[i])
+        {
+            GPA_LogError("A counter name in parameter 'ppCounters' is NULL.");
+            return GPA_STATUS_ERROR_NULL_POINTER;
+        }
+
+        if (!g_pCurrentContext->m_pCounterAccessor->GetCounterIndex(ppCounters[i], &pIndices[i]))
+        {
+            std::string message = "Specified counter '";
+            message += ppCounters[i];
+            message += "' was not found. Please check spelling or availability.";
+            GPA_LogError(message.c_str());
+            status = GPA_STATUS_ERROR_NOT_FOUND;
+        }
+    }
+
+    return status;
+}
+
 //-----------------------------------------------------------------------------
 GPALIB_DECL GPA_Status GPA_EnableCounterStr(const char* pCounter)
 {
@@ -891,12 +1039,99 @@ GPALIB_DECL GPA_Status GPA_GetPassCount(gpa_uint32* pNumPasses)
     return g_pCurrentContext->m_pCounterScheduler->GetNumRequiredPasses(pNumPasses);
 }
 
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetPassCountForCounters(const gpa_uint32* pCounterIndices, gpa_uint32 counterCount, gpa_uint32* pNumPasses)
+{
+    PROFILE_FUNCTION(GPA_GetPassCountForCounters);
+    TRACE_FUNCTION(GPA_GetPassCountForCounters);
+
+    if (nullptr == pCounterIndices && 0 < counterCount)
+    {
+        GPA_LogError("Parameter 'pCounterIndices' is NULL.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    if (nullptr == pNumPasses)
+    {
+        GPA_LogError("Parameter 'pNumPasses' is NULL.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    if (nullptr == g_pCurrentContext)
+    {
+        GPA_LogError("Please call GPA_OpenContext before GPA_GetPassCountForCounters.");
+        return GPA_STATUS_ERROR_COUNTERS_NOT_OPEN;
+    }
+
+    return g_pCurrentContext->m_pCounterScheduler->GetNumRequiredPassesForCounters(pCounterIndices, counterCount, pNumPasses);
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetCounterPassAffinity(gpa_uint32 counterIndex, gpa_uint8* pPasses, gpa_uint32 passCount)
+{
+    PROFILE_FUNCTION(GPA_GetCounterPassAffinity);
+    TRACE_FUNCTION(GPA_GetCounterPassAffinity);
+
+    if (nullptr == pPasses)
+    {
+        GPA_LogError("Parameter 'pPasses' is NULL.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    if (nullptr == g_pCurrentContext)
+    {
+        GPA_LogError("Please call GPA_OpenContext before GPA_GetCounterPassAffinity.");
+        return GPA_STATUS_ERROR_COUNTERS_NOT_OPEN;
+    }
+
+    return g_pCurrentContext->m_pCounterScheduler->GetCounterPassAffinity(counterIndex, pPasses, passCount);
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_EnableCountersWithinPassBudget(const gpa_uint32* pCounterIndices, gpa_uint32 counterCount, gpa_uint32 maxPasses, gpa_uint32* pNumEnabled)
+{
+    PROFILE_FUNCTION(GPA_EnableCountersWithinPassBudget);
+    TRACE_FUNCTION(GPA_EnableCountersWithinPassBudget);
+
+    if (nullptr == pCounterIndices && 0 < counterCount)
+    {
+        GPA_LogError("Parameter 'pCounterIndices' is NULL.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    if (nullptr == pNumEnabled)
+    {
+        GPA_LogError("Parameter 'pNumEnabled' is NULL.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    if (nullptr == g_pCurrentContext)
+    {
+        GPA_LogError("Please call GPA_OpenContext before GPA_EnableCountersWithinPassBudget.");
+        return GPA_STATUS_ERROR_COUNTERS_NOT_OPEN;
+    }
+
+    if (g_pCurrentContext->m_samplingStarted)
+    {
+        GPA_LogError("Call GPA_EndSession before trying to change the enabled counters with GPA_EnableCountersWithinPassBudget.");
+        return GPA_STATUS_ERROR_CANNOT_CHANGE_COUNTERS_WHEN_SAMPLING;
+    }
+
+    return g_pCurrentContext->m_pCounterScheduler->EnableCountersWithinPassBudget(pCounterIndices, counterCount, maxPasses, pNumEnabled);
+}
+
 //-----------------------------------------------------------------------------
 GPALIB_DECL GPA_Status GPA_BeginSession(gpa_uint32* pSessionID)
 {
     PROFILE_FUNCTION(GPA_BeginSession);
     TRACE_FUNCTION(GPA_BeginSession);
 
+    if (GPA_SessionRequests::IsInCompletionCallback())
+    {
+        GPA_LogError("GPA_BeginSession cannot be called from a GPA_RequestSessionResultsAsync callback.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
     if (nullptr == g_pCurrentContext)
     {
         GPA_LogError("Please call GPA_OpenContext before GPA_BeginSession.");
@@ -931,7 +1166,7 @@ GPALIB_DECL GPA_Status GPA_BeginSession(gpa_uint32* pSessionID)
         return GPA_STATUS_ERROR_SAMPLING_ALREADY_STARTED;
     }
 
-    // inc selectionID if counter selection got changed since last sampling session
+    // inc selectionID if the passes changed since the last session, so that the data requests made for the previous passes are not reused
     bool selectionChanged = g_pCurrentContext->m_pCounterScheduler->GetCounterSelectionChanged();
 
     if (selectionChanged)
@@ -939,6 +1174,9 @@ GPALIB_DECL GPA_Status GPA_BeginSession(gpa_uint32* pSessionID)
         g_pCurrentContext->m_selectionID++;
     }
 
+    // the results of the session are computed from the expanded public counters, possibly on the result collection thread
+    g_pCurrentContext->m_pCounterAccessor->ExpandPublicCounters();
+
     // reset pass count
     g_pCurrentContext->m_pCounterScheduler->BeginProfile();
     g_pCurrentContext->m_currentPass = 0;
@@ -948,20 +1186,8 @@ GPALIB_DECL GPA_Status GPA_BeginSession(gpa_uint32* pSessionID)
     (*pSessionID) = g_pCurrentContext->m_sessionID;
     g_pCurrentContext->m_samplingStarted = true;
 
-    // Allocate the next session
-    bool lockedOk = false;
-    g_pCurrentContext->m_pCurrentSessionRequests = &g_pCurrentContext->m_profileSessions.lockNext(lockedOk);
-
-    // make sure all requests of the session about to be reused have completed
-    g_pCurrentContext->m_pCurrentSessionRequests->Flush();
-    assert(lockedOk == true);
-    g_pCurrentContext->m_profileSessions.addLockedItem();
-
-    //   g_pCurrentContext->RecycleCurrentSession();
-    g_pCurrentContext->m_pCurrentSessionRequests->SetPassCount(passCount);
-
-    // prepare the current session for data requests
-    g_pCurrentContext->m_pCurrentSessionRequests->m_sessionID = (*pSessionID);
+    // Allocate the next session and prepare it for data requests
+    g_pCurrentContext->m_pCurrentSessionRequests = g_pCurrentContext->AddSession(*pSessionID, passCount);
 
     status = GPA_IMP_BeginSession(pSessionID, selectionChanged);
 
@@ -974,6 +1200,12 @@ GPALIB_DECL GPA_Status GPA_EndSession()
     PROFILE_FUNCTION(GPA_EndSession);
     TRACE_FUNCTION(GPA_EndSession);
 
+    if (GPA_SessionRequests::IsInCompletionCallback())
+    {
+        GPA_LogError("GPA_EndSession cannot be called from a GPA_RequestSessionResultsAsync callback.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
     GPA_Status returnStatus = GPA_STATUS_OK;
 
     if (nullptr == g_pCurrentContext)
@@ -1006,6 +1238,9 @@ GPALIB_DECL GPA_Status GPA_EndSession()
 
     GPA_Status impStatus = GPA_IMP_EndSession();
 
+    // deliver the results of any earlier sessions which have completed meanwhile
+    g_pCurrentContext->CheckForCompletedSessions();
+
     if (GPA_STATUS_OK == returnStatus)
     {
         // return implementation EndPass status since we didn't have an error
@@ -1178,6 +1413,7 @@ GPALIB_DECL GPA_Status GPA_BeginSample(gpa_uint32 sampleID)
 
         if (!requestOk)
         {
+            delete pRequest;
             return GPA_STATUS_ERROR_FAILED;
         }
 
@@ -1257,6 +1493,9 @@ GPALIB_DECL GPA_Status GPA_EndSample()
     if ((preferredCheckResultFrequency > 0) && g_pCurrentContext->m_currentSample % preferredCheckResultFrequency == 0)
     {
         g_pCurrentContext->m_pCurrentSessionRequests->CheckForAvailableResults(g_pCurrentContext->m_currentPass - 1);
+
+        // earlier sessions may be waiting to deliver their results
+        g_pCurrentContext->CheckForCompletedSessions();
     }
 
     return status;
@@ -1477,6 +1716,29 @@ static GPA_Status GetCounterSize(gpa_uint32 counterIndex, GPA_Type& type, gpa_ui
     return GPA_STATUS_OK;
 }
 
+//-----------------------------------------------------------------------------
+/// Reads an internal counter result from the counter results of a sample
+/// \param pPassResults the counter results of each pass for the sample
+/// \param passCount the number of entries in pPassResults
+/// \param entry the gather plan entry of the internal counter result
+/// \param[out] value will contain the internal counter result
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+static inline GPA_Status ReadCounterResult(const GPA_CounterResults* pPassResults, size_t passCount, const GPA_CounterGatherEntry& entry, gpa_uint64& value)
+{
+    if (entry.m_pass >= passCount || entry.m_offset >= pPassResults[entry.m_pass].m_numResults)
+    {
+        std::stringstream message;
+        message << "Counter results do not contain a result for counter index " << entry.m_offset << " in pass " << entry.m_pass << ".";
+        GPA_LogDebugError(message.str().c_str());
+        return GPA_STATUS_ERROR_READING_COUNTER_RESULT;
+    }
+
+    const gpa_uint64* pResultBuffer = pPassResults[entry.m_pass].m_pResultBuffer;
+    value = (nullptr != pResultBuffer) ? pResultBuffer[entry.m_offset] : 0;
+
+    return GPA_STATUS_OK;
+}
+
 //-----------------------------------------------------------------------------
 /// Template function to get counter sample result
 /// \param sessionID the session ID whose sample data is needed
@@ -1507,22 +1769,27 @@ static GPA_Status GPA_GetSample(gpa_uint32 sessionID, gpa_uint32 sampleID, gpa_u
 
     if (!checkSession)
     {
-        std::stringstream message;
-        message << "Parameter 'sessionID' (" << sessionID << ") is not one of the existing sessions.";
-        GPA_LogError(message.str().c_str());
+        GPA_LogErrorFormat("Parameter 'sessionID' (%u) is not one of the existing sessions.", sessionID);
         return GPA_STATUS_ERROR_SESSION_NOT_FOUND;
     }
 
     if (GPA_IsCounterEnabled(counterIndex) != GPA_STATUS_OK)
     {
-        std::stringstream message;
-        message << "Parameter 'counterIndex' (" << counterIndex << ") does not identify an enabled counter.";
-        GPA_LogError(message.str().c_str());
+        GPA_LogErrorFormat("Parameter 'counterIndex' (%u) does not identify an enabled counter.", counterIndex);
         return GPA_STATUS_ERROR_NOT_ENABLED;
     }
 
     gpa_uint32 numPublicCounters = g_pCurrentContext->m_pCounterAccessor->GetNumPublicCounters();
 
+    // the gather plan of the counter was fixed when its passes were computed
+    const GPA_CounterGatherPlan* pGatherPlan = g_pCurrentContext->m_pCounterScheduler->GetCounterGatherPlan(counterIndex);
+
+    if (nullptr == pGatherPlan)
+    {
+        GPA_LogError("Could not find required counter among the results.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
     if (counterIndex < numPublicCounters) // AMD public counter
     {
         // need to compute the result from the internal counters
@@ -1530,109 +1797,56 @@ static GPA_Status GPA_GetSample(gpa_uint32 sessionID, gpa_uint32 sampleID, gpa_u
 
         BEGIN_PROFILE_SECTION(GPA_GetSample::CalcPublicCounters);
 
-        // counterIndex is the public counter index
-        GPA_Status status;
-
-        vector<char*> results;
-        vector<GPA_Type> types;
-        vector<gpa_uint32> internalCountersRequired = g_pCurrentContext->m_pCounterAccessor->GetInternalCountersRequired(counterIndex);
-
-        size_t requiredCount = internalCountersRequired.size();
-        results.reserve(requiredCount);
-        types.reserve(requiredCount);
+        // block once for the results of every pass, rather than once for each internal counter;
+        // the scratch storage of the context is reused, so that no memory is allocated once it is large enough
+        vector<GPA_CounterResults>& passResults = g_pCurrentContext->m_samplePassResults;
+        GPA_Status status = checkSession->GetSampleResults(sampleID, passResults);
 
-        char* pAllResults = new(std::nothrow) char[requiredCount * 8];
-
-        if (nullptr == pAllResults)
+        if (status != GPA_STATUS_OK)
         {
-            GPA_LogError("Unable to allocate memory for results");
-            return GPA_STATUS_ERROR_FAILED;
+            return status;
         }
 
-        CounterResultLocationMap* pResultLocations = g_pCurrentContext->m_pCounterScheduler->GetCounterResultLocations(counterIndex);
+        vector<gpa_uint64>& internalValues = g_pCurrentContext->m_sampleInternalValues;
+        vector<char*>& results = g_pCurrentContext->m_sampleInternalResults;
+        vector<GPA_Type>& types = g_pCurrentContext->m_sampleInternalTypes;
+        internalValues.resize(pGatherPlan->m_numEntries);
+        results.clear();
+        types.clear();
 
-        unsigned int resultIndex = 0;
-
-        for (std::vector<gpa_uint32>::iterator requiredCounterIter = internalCountersRequired.begin(); requiredCounterIter != internalCountersRequired.end(); ++requiredCounterIter)
+        for (gpa_uint32 i = 0; i < pGatherPlan->m_numEntries; ++i)
         {
-            // Gather each individual hardware counter result that is needed to calculate the public counter result and put them into a buffer
-            GPA_Type type;
-            gpa_uint32 typeSize;
-            status = GetCounterSize(*requiredCounterIter, type, typeSize);
+            // Gather each individual hardware counter result that is needed to calculate the public counter result
+            const GPA_CounterGatherEntry& entry = pGatherPlan->m_pEntries[i];
+            status = ReadCounterResult(passResults.data(), passResults.size(), entry, internalValues[i]);
 
             if (status != GPA_STATUS_OK)
             {
-                delete[] pAllResults;
                 return status;
             }
 
-            char* pResultBuffer = &(pAllResults[resultIndex]);
-            resultIndex += 8;
-            results.push_back(pResultBuffer);
-            types.push_back(type);
-
-            std::map<unsigned int, GPA_CounterResultLocation>::iterator resultLocationIter = pResultLocations->find(*requiredCounterIter);
-
-            if (resultLocationIter == pResultLocations->end())
-            {
-                GPA_LogError("Could not find required counter among the results.");
-                return GPA_STATUS_ERROR_FAILED;
-            }
-
-            status = checkSession->GetResult(resultLocationIter->second.m_pass, sampleID, resultLocationIter->second.m_offset, pResultBuffer);
+            results.push_back(reinterpret_cast<char*>(&internalValues[i]));
+            types.push_back(entry.m_type);
+        }
 
 #ifdef AMDT_INTERNAL
-            const char* pInternalName = g_pCurrentContext->m_pCounterAccessor->GetCounterName(numPublicCounters + *requiredCounterIter);
-            const char* pPublicName = g_pCurrentContext->m_pCounterAccessor->GetCounterName(counterIndex);
-
-            std::stringstream message;
-            message << "Session " << sessionID << ", sample " << sampleID << ", pubCounter '" << pPublicName << "', iCounter: '" << pInternalName << "', [" << *requiredCounterIter << "] = ";
-
-            if (type == GPA_TYPE_UINT32)
-            {
-                gpa_uint32* pValue = (gpa_uint32*)pResultBuffer;
-
-                message << *pValue;
-            }
-            else if (type == GPA_TYPE_UINT64)
-            {
-                gpa_uint64* pValue = (gpa_uint64*)pResultBuffer;
-
-                message << *pValue;
-            }
-            else if (type == GPA_TYPE_FLOAT32)
-            {
-                gpa_float32* pValue = (gpa_float32*)pResultBuffer;
-
-                message << *pValue;
-            }
-            else if (type == GPA_TYPE_FLOAT64)
-            {
-                gpa_float64* pValue = reinterpret_cast<gpa_float64*>(pResultBuffer);
+        vector<gpa_uint32> internalCountersRequired = g_pCurrentContext->m_pCounterAccessor->GetInternalCountersRequired(counterIndex);
+        const char* pPublicName = g_pCurrentContext->m_pCounterAccessor->GetCounterName(counterIndex);
 
-                message << *pValue;
-            }
-            else
-            {
-                // case not covered
-                assert(false);
-            }
+        for (size_t i = 0; i < internalCountersRequired.size() && i < internalValues.size(); ++i)
+        {
+            const char* pInternalName = g_pCurrentContext->m_pCounterAccessor->GetCounterName(numPublicCounters + internalCountersRequired[i]);
 
+            std::stringstream message;
+            message << "Session " << sessionID << ", sample " << sampleID << ", pubCounter '" << pPublicName << "', iCounter: '" << pInternalName << "', [" << internalCountersRequired[i] << "] = " << internalValues[i];
             GPA_LogDebugCounterDefs(message.str().c_str());
-#endif
-
-            if (status != GPA_STATUS_OK)
-            {
-                delete[] pAllResults;
-                return status;
-            }
         }
 
+#endif
+
         // compute using supplied function. value order is as defined when registered
         g_pCurrentContext->m_pCounterAccessor->ComputePublicCounterValue(counterIndex, results, types, pResult, &(g_pCurrentContext->m_hwInfo));
 
-        delete[] pAllResults;
-
         END_PROFILE_SECTION(GPA_GetSample::CalcPublicCounters);
 
         return GPA_STATUS_OK;
@@ -1641,16 +1855,12 @@ static GPA_Status GPA_GetSample(gpa_uint32 sessionID, gpa_uint32 sampleID, gpa_u
     {
         GPA_Status status = GPA_STATUS_OK;
 
-        CounterResultLocationMap* const pLocations = g_pCurrentContext->m_pCounterScheduler->GetCounterResultLocations(counterIndex);
-
         gpa_uint32 numAMDCounters = g_pCurrentContext->m_pCounterAccessor->GetNumAMDCounters();
+        const GPA_CounterGatherEntry& entry = pGatherPlan->m_pEntries[0];
 
         if (counterIndex < numAMDCounters) // internal counter
         {
-            gpa_uint32 hardwareCounterIndex = counterIndex - numPublicCounters;
-            gpa_uint16 counterResultPass = (*pLocations)[hardwareCounterIndex].m_pass;
-            gpa_uint16 counterResultOffset = (*pLocations)[hardwareCounterIndex].m_offset;
-            status = checkSession->GetResult(counterResultPass, sampleID, counterResultOffset, pResult);
+            status = checkSession->GetResult(entry.m_pass, sampleID, entry.m_offset, pResult);
         }
 
 #if defined(WIN32)
@@ -1658,11 +1868,8 @@ static GPA_Status GPA_GetSample(gpa_uint32 sessionID, gpa_uint32 sampleID, gpa_u
         {
             counterIndex -= numAMDCounters;
             gpa_uint64 buf = 0;
-            auto iter = pLocations->begin();
-            gpa_uint16 counterResultOffset = iter->second.m_offset;
-            gpa_uint16 counterResultPass = iter->second.m_pass;
 
-            status = checkSession->GetResult(counterResultPass, sampleID, counterResultOffset, &buf);
+            status = checkSession->GetResult(entry.m_pass, sampleID, entry.m_offset, &buf);
 
             // compute using supplied function. value order is as defined when registered
             g_pCurrentContext->m_pCounterAccessor->ComputeSWCounterValue(counterIndex, buf, pResult, &(g_pCurrentContext->m_hwInfo));
@@ -1675,61 +1882,123 @@ static GPA_Status GPA_GetSample(gpa_uint32 sessionID, gpa_uint32 sampleID, gpa_u
 }
 
 //-----------------------------------------------------------------------------
-GPALIB_DECL GPA_Status GPA_GetSampleCount(gpa_uint32 sessionID, gpa_uint32* pSamples)
+GPALIB_DECL GPA_Status GPA_SetFlushWaitPolicy(GPA_Flush_Wait_Policy policy, gpa_uint32 timeoutMilliseconds)
 {
-    PROFILE_FUNCTION(GPA_GetSampleCount);
-    TRACE_FUNCTION(GPA_GetSampleCount);
+    PROFILE_FUNCTION(GPA_SetFlushWaitPolicy);
+    TRACE_FUNCTION(GPA_SetFlushWaitPolicy);
 
-    if (nullptr == pSamples)
+    if (nullptr == g_pCurrentContext)
     {
-        GPA_LogError("Parameter 'pSamples' is NULL.");
-        return GPA_STATUS_ERROR_NULL_POINTER;
+        GPA_LogError("Please call GPA_OpenContext before GPA_SetFlushWaitPolicy.");
+        return GPA_STATUS_ERROR_COUNTERS_NOT_OPEN;
     }
 
-    GPA_SessionRequests* checkSession = g_pCurrentContext->FindSession(sessionID);
-
-    if (nullptr == checkSession)
+    if (policy >= GPA_FLUSH_WAIT__LAST)
     {
         std::stringstream message;
-        message << "Parameter 'sessionID' (" << sessionID << ") is not one of the existing sessions.";
+        message << "Parameter 'policy' (" << policy << ") is not a valid flush wait policy.";
         GPA_LogError(message.str().c_str());
-        return GPA_STATUS_ERROR_SESSION_NOT_FOUND;
+        return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
     }
 
-    GPA_Status status = checkSession->GetSampleCount(pSamples);
-    return status;
+    g_pCurrentContext->SetFlushWaitPolicy(policy, timeoutMilliseconds);
+
+    return GPA_STATUS_OK;
 }
 
 //-----------------------------------------------------------------------------
-// maybe just have get samples - all counters for a sample, problem with different types then.
-// maybe can only do for same type
-// in counterID order
-GPALIB_DECL GPA_Status GPA_GetSampleUInt64(gpa_uint32 sessionID, gpa_uint32 sampleID, gpa_uint32 counterIndex, gpa_uint64* pResult)
+GPALIB_DECL GPA_Status GPA_SetResultCollectionMode(GPA_Result_Collection_Mode mode)
 {
-    PROFILE_FUNCTION(GPA_GetSampleUInt64);
-    TRACE_FUNCTION(GPA_GetSampleUInt64);
+    PROFILE_FUNCTION(GPA_SetResultCollectionMode);
+    TRACE_FUNCTION(GPA_SetResultCollectionMode);
 
-    if (nullptr == pResult)
+    if (GPA_SessionRequests::IsInCompletionCallback())
     {
-        GPA_LogError("Parameter 'pResult' cannot be NULL");
-        return GPA_STATUS_ERROR_NULL_POINTER;
+        GPA_LogError("GPA_SetResultCollectionMode cannot be called from a GPA_RequestSessionResultsAsync callback.");
+        return GPA_STATUS_ERROR_FAILED;
     }
 
-    // verify type ( and index )
-    GPA_Type counterType;
-    GPA_Status status = GPA_GetCounterDataType(counterIndex, &counterType);
-
-    if (GPA_STATUS_OK != status)
+    if (nullptr == g_pCurrentContext)
     {
-        return status;
+        GPA_LogError("Please call GPA_OpenContext before GPA_SetResultCollectionMode.");
+        return GPA_STATUS_ERROR_COUNTERS_NOT_OPEN;
     }
 
-    if (GPA_TYPE_UINT64 != counterType)
+    if (mode >= GPA_RESULT_COLLECTION__LAST)
     {
         std::stringstream message;
-        message << "Counter identified by 'counterIndex' (" << counterIndex << ") is not of type UInt64.";
+        message << "Parameter 'mode' (" << mode << ") is not a valid result collection mode.";
         GPA_LogError(message.str().c_str());
-        return GPA_STATUS_ERROR_COUNTER_NOT_OF_SPECIFIED_TYPE;
+        return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
+    }
+
+    if (GPA_RESULT_COLLECTION_BACKGROUND_THREAD == mode && !g_pCurrentContext->SupportsBackgroundResultCollection())
+    {
+        GPA_LogError("The results of this API can only be collected on the application thread.");
+        return GPA_STATUS_ERROR_API_NOT_SUPPORTED;
+    }
+
+    g_pCurrentContext->SetResultCollectionMode(mode);
+
+    return GPA_STATUS_OK;
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetSampleCount(gpa_uint32 sessionID, gpa_uint32* pSamples)
+{
+    PROFILE_FUNCTION(GPA_GetSampleCount);
+    TRACE_FUNCTION(GPA_GetSampleCount);
+
+    if (nullptr == pSamples)
+    {
+        GPA_LogError("Parameter 'pSamples' is NULL.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    GPA_SessionRequests* checkSession = g_pCurrentContext->FindSession(sessionID);
+
+    if (nullptr == checkSession)
+    {
+        std::stringstream message;
+        message << "Parameter 'sessionID' (" << sessionID << ") is not one of the existing sessions.";
+        GPA_LogError(message.str().c_str());
+        return GPA_STATUS_ERROR_SESSION_NOT_FOUND;
+    }
+
+    GPA_Status status = checkSession->GetSampleCount(pSamples);
+    return status;
+}
+
+//-----------------------------------------------------------------------------
+// maybe just have get samples - all counters for a sample, problem with different types then.
+// maybe can only do for same type
+// in counterID order
+GPALIB_DECL GPA_Status GPA_GetSampleUInt64(gpa_uint32 sessionID, gpa_uint32 sampleID, gpa_uint32 counterIndex, gpa_uint64* pResult)
+{
+    PROFILE_FUNCTION(GPA_GetSampleUInt64);
+    TRACE_FUNCTION(GPA_GetSampleUInt64);
+
+    if (nullptr == pResult)
+    {
+        GPA_LogError("Parameter 'pResult' cannot be NULL");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    // verify type ( and index )
+    GPA_Type counterType;
+    GPA_Status status = GPA_GetCounterDataType(counterIndex, &counterType);
+
+    if (GPA_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    if (GPA_TYPE_UINT64 != counterType)
+    {
+        std::stringstream message;
+        message << "Counter identified by 'counterIndex' (" << counterIndex << ") is not of type UInt64.";
+        GPA_LogError(message.str().c_str());
+        return GPA_STATUS_ERROR_COUNTER_NOT_OF_SPECIFIED_TYPE;
     }
 
     status = GPA_GetSample< gpa_uint64 >(sessionID, sampleID, counterIndex, pResult);
@@ -1839,6 +2108,503 @@ GPALIB_DECL GPA_Status GPA_GetSampleFloat64(gpa_uint32 sessionID, gpa_uint32 sam
     return status;
 }
 
+//-----------------------------------------------------------------------------
+/// Describes how the result of an enabled counter is gathered from the counter results of a sample
+struct GPA_CounterGatherInfo
+{
+    gpa_uint32 m_counterIndex;                    ///< the index of the enabled counter
+    gpa_uint32 m_size;                            ///< the size of the counter result in bytes
+    const GPA_CounterGatherPlan* m_pGatherPlan;   ///< the location and type of each internal result needed to compute the counter, owned by the counter scheduler
+};
+
+//-----------------------------------------------------------------------------
+/// Resolves, for each enabled counter, where its internal results are located in the passes of a session
+/// \param[out] gatherInfo will contain the gather information of each enabled counter, in enabled index order
+/// \param[out] maxInternalCounters will contain the largest number of internal results needed by a single counter
+/// \param[out] resultSize will contain the number of bytes needed to store one result of each enabled counter
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+static GPA_Status GetEnabledCounterGatherInfo(std::vector<GPA_CounterGatherInfo>& gatherInfo, size_t& maxInternalCounters, size_t& resultSize)
+{
+    GPA_CounterGeneratorBase* pCounterAccessor = g_pCurrentContext->m_pCounterAccessor;
+    GPA_ICounterScheduler* pCounterScheduler = g_pCurrentContext->m_pCounterScheduler;
+
+    gpa_uint32 numPublicCounters = pCounterAccessor->GetNumPublicCounters();
+    gpa_uint32 numEnabledCounters = pCounterScheduler->GetNumEnabledCounters();
+
+    gatherInfo.resize(numEnabledCounters);
+    maxInternalCounters = 1;
+    resultSize = 0;
+
+    for (gpa_uint32 enabledIndex = 0; enabledIndex < numEnabledCounters; ++enabledIndex)
+    {
+        GPA_CounterGatherInfo& info = gatherInfo[enabledIndex];
+
+        GPA_Status status = pCounterScheduler->GetEnabledIndex(enabledIndex, &info.m_counterIndex);
+
+        if (GPA_STATUS_OK != status)
+        {
+            return status;
+        }
+
+        GPA_Type counterType;
+        status = GetCounterSize(info.m_counterIndex, counterType, info.m_size);
+
+        if (GPA_STATUS_OK != status)
+        {
+            return status;
+        }
+
+        resultSize += info.m_size;
+
+        // the plan is only valid until the passes change
+        info.m_pGatherPlan = pCounterScheduler->GetCounterGatherPlan(info.m_counterIndex);
+
+        if (nullptr == info.m_pGatherPlan)
+        {
+            GPA_LogError("Could not find required counter among the results.");
+            return GPA_STATUS_ERROR_FAILED;
+        }
+
+        if (info.m_counterIndex < numPublicCounters && info.m_pGatherPlan->m_numEntries > maxInternalCounters) // AMD public counter
+        {
+            maxInternalCounters = info.m_pGatherPlan->m_numEntries;
+        }
+    }
+
+    return GPA_STATUS_OK;
+}
+
+//-----------------------------------------------------------------------------
+/// Gets the type of each internal result needed to compute an enabled counter, as its equation expects them
+/// \param info the gather information of the counter
+/// \param[out] types will contain the type of each internal result, reusing its storage
+static void GetInternalCounterTypes(const GPA_CounterGatherInfo& info, std::vector<GPA_Type>& types)
+{
+    types.clear();
+
+    for (gpa_uint32 i = 0; i < info.m_pGatherPlan->m_numEntries; ++i)
+    {
+        types.push_back(info.m_pGatherPlan->m_pEntries[i].m_type);
+    }
+}
+
+//-----------------------------------------------------------------------------
+/// Computes the result of an enabled counter from the counter results of a sample
+/// \param pContextState the context which owns the counters
+/// \param info the gather information of the counter
+/// \param pPassResults the counter results of each pass for the sample
+/// \param passCount the number of entries in pPassResults
+/// \param internalValues scratch storage for the internal results, sized for the largest counter
+/// \param results scratch vector for the pointers to the internal results, reserved for the largest counter
+/// \param types the type of each internal result of the counter, as returned by GetInternalCounterTypes
+/// \param[out] pResult will contain the counter result at its native width
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+static GPA_Status ComputeCounterResult(GPA_ContextState* pContextState, const GPA_CounterGatherInfo& info, const GPA_CounterResults* pPassResults, size_t passCount,
+                                       std::vector<gpa_uint64>& internalValues, std::vector<char*>& results, std::vector<GPA_Type>& types, void* pResult)
+{
+    gpa_uint32 numPublicCounters = pContextState->m_pCounterAccessor->GetNumPublicCounters();
+    size_t numLocations = info.m_pGatherPlan->m_numEntries;
+
+    assert(numLocations <= internalValues.size());
+
+    for (size_t i = 0; i < numLocations; ++i)
+    {
+        GPA_Status status = ReadCounterResult(pPassResults, passCount, info.m_pGatherPlan->m_pEntries[i], internalValues[i]);
+
+        if (GPA_STATUS_OK != status)
+        {
+            return status;
+        }
+    }
+
+    // an 8-byte value is large enough and suitably aligned for every counter type
+    gpa_uint64 value = 0;
+
+    if (info.m_counterIndex < numPublicCounters) // AMD public counter
+    {
+        results.clear();
+
+        for (size_t i = 0; i < numLocations; ++i)
+        {
+            results.push_back(reinterpret_cast<char*>(&internalValues[i]));
+        }
+
+        // compute using supplied function. value order is as defined when registered
+        pContextState->m_pCounterAccessor->ComputePublicCounterValue(info.m_counterIndex, results, types, &value, &(pContextState->m_hwInfo));
+    }
+    else if (info.m_counterIndex < pContextState->m_pCounterAccessor->GetNumAMDCounters()) // internal counter
+    {
+        value = internalValues[0];
+    }
+
+#if defined(WIN32)
+    else // SW counter
+    {
+        gpa_uint32 swCounterIndex = info.m_counterIndex - pContextState->m_pCounterAccessor->GetNumAMDCounters();
+
+        // compute using supplied function. value order is as defined when registered
+        pContextState->m_pCounterAccessor->ComputeSWCounterValue(swCounterIndex, internalValues[0], &value, &(pContextState->m_hwInfo));
+    }
+
+#endif // WIN32
+
+    memcpy(pResult, &value, info.m_size);
+
+    return GPA_STATUS_OK;
+}
+
+//-----------------------------------------------------------------------------
+/// Computes the results of the enabled counters for every sample of a session
+/// \param pContextState the context which owns the counters
+/// \param gatherInfo the gather information of each enabled counter
+/// \param maxInternalCounters the largest number of internal results needed by a single counter
+/// \param rowSize the number of bytes needed to store one result of each enabled counter
+/// \param layout the layout of the results in the buffer
+/// \param sampleResults the counter results of each pass for each sample, as returned by GPA_SessionRequests::GetSessionResults
+/// \param sampleCount the number of samples in sampleResults
+/// \param passCount the number of passes of each sample in sampleResults
+/// \param[out] pBuffer will contain the results; it must hold at least sampleCount * rowSize bytes
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+static GPA_Status ComputeSessionResults(GPA_ContextState* pContextState, const std::vector<GPA_CounterGatherInfo>& gatherInfo, size_t maxInternalCounters, size_t rowSize, GPA_Result_Layout layout,
+                                        const std::vector<GPA_CounterResults>& sampleResults, size_t sampleCount, size_t passCount, void* pBuffer)
+{
+    std::vector<gpa_uint64> internalValues(maxInternalCounters);
+    std::vector<char*> results;
+    results.reserve(maxInternalCounters);
+    std::vector<GPA_Type> types;
+    types.reserve(maxInternalCounters);
+
+    // offset of the current counter within a row, or of its column when the layout is column-major
+    size_t counterOffset = 0;
+
+    for (std::vector<GPA_CounterGatherInfo>::const_iterator infoIter = gatherInfo.begin(); infoIter != gatherInfo.end(); ++infoIter)
+    {
+        GetInternalCounterTypes(*infoIter, types);
+
+        char* pResult = static_cast<char*>(pBuffer) + counterOffset;
+        size_t resultStride = rowSize;
+
+        if (GPA_RESULT_LAYOUT_COLUMN_MAJOR == layout)
+        {
+            pResult = static_cast<char*>(pBuffer) + (counterOffset * sampleCount);
+            resultStride = infoIter->m_size;
+        }
+
+        // evaluate this counter for every sample before moving on to the next one
+        const GPA_CounterResults* pPassResults = sampleResults.data();
+
+        for (size_t sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+        {
+            GPA_Status status = ComputeCounterResult(pContextState, *infoIter, pPassResults, passCount, internalValues, results, types, pResult);
+
+            if (GPA_STATUS_OK != status)
+            {
+                return status;
+            }
+
+            pPassResults += passCount;
+            pResult += resultStride;
+        }
+
+        counterOffset += infoIter->m_size;
+    }
+
+    return GPA_STATUS_OK;
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetSampleResults(gpa_uint32 sessionID, gpa_uint32 sampleID, void* pBuffer, size_t bufferSize)
+{
+    PROFILE_FUNCTION(GPA_GetSampleResults);
+    TRACE_FUNCTION(GPA_GetSampleResults);
+
+    if (nullptr == g_pCurrentContext)
+    {
+        GPA_LogError("Please call GPA_OpenContext before GPA_GetSampleResults.");
+        return GPA_STATUS_ERROR_COUNTERS_NOT_OPEN;
+    }
+
+    if (nullptr == pBuffer)
+    {
+        GPA_LogError("Parameter 'pBuffer' is NULL.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    // locate session
+    GPA_SessionRequests* checkSession = g_pCurrentContext->FindSession(sessionID);
+
+    if (nullptr == checkSession)
+    {
+        std::stringstream message;
+        message << "Parameter 'sessionID' (" << sessionID << ") is not one of the existing sessions.";
+        GPA_LogError(message.str().c_str());
+        return GPA_STATUS_ERROR_SESSION_NOT_FOUND;
+    }
+
+    std::vector<GPA_CounterGatherInfo> gatherInfo;
+    size_t maxInternalCounters = 0;
+    size_t resultSize = 0;
+
+    GPA_Status status = GetEnabledCounterGatherInfo(gatherInfo, maxInternalCounters, resultSize);
+
+    if (GPA_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    if (bufferSize < resultSize)
+    {
+        std::stringstream message;
+        message << "Parameter 'bufferSize' (" << bufferSize << ") is smaller than the " << resultSize << " bytes needed to hold the results of the enabled counters.";
+        GPA_LogError(message.str().c_str());
+        return GPA_STATUS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    std::vector<GPA_CounterResults> passResults;
+    status = checkSession->GetSampleResults(sampleID, passResults);
+
+    if (GPA_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    std::vector<gpa_uint64> internalValues(maxInternalCounters);
+    std::vector<char*> results;
+    results.reserve(maxInternalCounters);
+    std::vector<GPA_Type> types;
+    types.reserve(maxInternalCounters);
+
+    char* pResult = static_cast<char*>(pBuffer);
+
+    for (std::vector<GPA_CounterGatherInfo>::const_iterator infoIter = gatherInfo.begin(); infoIter != gatherInfo.end(); ++infoIter)
+    {
+        GetInternalCounterTypes(*infoIter, types);
+        status = ComputeCounterResult(g_pCurrentContext, *infoIter, passResults.data(), passResults.size(), internalValues, results, types, pResult);
+
+        if (GPA_STATUS_OK != status)
+        {
+            return status;
+        }
+
+        pResult += infoIter->m_size;
+    }
+
+    return GPA_STATUS_OK;
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_GetSessionResults(gpa_uint32 sessionID, GPA_Result_Layout layout, void* pBuffer, size_t bufferSize)
+{
+    PROFILE_FUNCTION(GPA_GetSessionResults);
+    TRACE_FUNCTION(GPA_GetSessionResults);
+
+    if (nullptr == g_pCurrentContext)
+    {
+        GPA_LogError("Please call GPA_OpenContext before GPA_GetSessionResults.");
+        return GPA_STATUS_ERROR_COUNTERS_NOT_OPEN;
+    }
+
+    if (nullptr == pBuffer)
+    {
+        GPA_LogError("Parameter 'pBuffer' is NULL.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    if (GPA_RESULT_LAYOUT_ROW_MAJOR != layout && GPA_RESULT_LAYOUT_COLUMN_MAJOR != layout)
+    {
+        std::stringstream message;
+        message << "Parameter 'layout' (" << layout << ") is not a valid result layout.";
+        GPA_LogError(message.str().c_str());
+        return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
+    }
+
+    // locate session
+    GPA_SessionRequests* checkSession = g_pCurrentContext->FindSession(sessionID);
+
+    if (nullptr == checkSession)
+    {
+        std::stringstream message;
+        message << "Parameter 'sessionID' (" << sessionID << ") is not one of the existing sessions.";
+        GPA_LogError(message.str().c_str());
+        return GPA_STATUS_ERROR_SESSION_NOT_FOUND;
+    }
+
+    std::vector<GPA_CounterGatherInfo> gatherInfo;
+    size_t maxInternalCounters = 0;
+    size_t rowSize = 0;
+
+    GPA_Status status = GetEnabledCounterGatherInfo(gatherInfo, maxInternalCounters, rowSize);
+
+    if (GPA_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    std::vector<gpa_uint32> sampleIds;
+    std::vector<GPA_CounterResults> sampleResults;
+    status = checkSession->GetSessionResults(sampleIds, sampleResults);
+
+    if (GPA_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    size_t sampleCount = sampleIds.size();
+
+    if (bufferSize < sampleCount * rowSize)
+    {
+        std::stringstream message;
+        message << "Parameter 'bufferSize' (" << bufferSize << ") is smaller than the " << sampleCount * rowSize << " bytes needed to hold the results of the enabled counters for " << sampleCount << " samples.";
+        GPA_LogError(message.str().c_str());
+        return GPA_STATUS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    return ComputeSessionResults(g_pCurrentContext, gatherInfo, maxInternalCounters, rowSize, layout, sampleResults, sampleCount, checkSession->GetPassCount(), pBuffer);
+}
+
+//-----------------------------------------------------------------------------
+/// The state of a GPA_RequestSessionResultsAsync request, which is kept until its callback has been called
+struct GPA_AsyncSessionResultsRequest
+{
+    GPA_ContextState* m_pContextState;                ///< the context which owns the session
+    GPA_SessionRequests* m_pSession;                  ///< the session whose results were requested
+    gpa_uint32 m_sessionID;                           ///< the ID of the session
+    std::vector<GPA_CounterGatherInfo> m_gatherInfo;  ///< the gather information of each counter enabled at the time of the request, which points to m_gatherPlans
+    std::vector<GPA_CounterGatherPlan> m_gatherPlans; ///< copies of the gather plans of the counters, which point to m_gatherEntries
+    std::vector<GPA_CounterGatherEntry> m_gatherEntries; ///< copies of the gather entries of the counters
+    size_t m_maxInternalCounters;                     ///< the largest number of internal results needed by a single counter
+    size_t m_rowSize;                                 ///< the number of bytes needed to store one result of each counter
+    GPA_SessionResultsCallback m_callback;            ///< the function which receives the results
+    void* m_pUserData;                                ///< the user data passed to the callback
+};
+
+//-----------------------------------------------------------------------------
+/// Computes the results of a session whose data requests are complete and passes them to the callback of the request
+/// \param request the request whose results to deliver
+static void DeliverSessionResults(GPA_AsyncSessionResultsRequest& request)
+{
+    std::vector<gpa_uint32> sampleIds;
+    std::vector<GPA_CounterResults> sampleResults;
+    GPA_Status status = request.m_pSession->GetSessionResults(sampleIds, sampleResults);
+
+    if (GPA_STATUS_OK != status)
+    {
+        request.m_callback(request.m_sessionID, status, nullptr, request.m_pUserData);
+        return;
+    }
+
+    size_t sampleCount = sampleIds.size();
+    std::vector<char> resultBuffer(sampleCount * request.m_rowSize);
+
+    status = ComputeSessionResults(request.m_pContextState, request.m_gatherInfo, request.m_maxInternalCounters, request.m_rowSize, GPA_RESULT_LAYOUT_ROW_MAJOR,
+                                   sampleResults, sampleCount, request.m_pSession->GetPassCount(), resultBuffer.data());
+
+    if (GPA_STATUS_OK != status)
+    {
+        request.m_callback(request.m_sessionID, status, nullptr, request.m_pUserData);
+        return;
+    }
+
+    std::vector<gpa_uint32> counterIndices;
+    counterIndices.reserve(request.m_gatherInfo.size());
+
+    for (std::vector<GPA_CounterGatherInfo>::const_iterator infoIter = request.m_gatherInfo.begin(); infoIter != request.m_gatherInfo.end(); ++infoIter)
+    {
+        counterIndices.push_back(infoIter->m_counterIndex);
+    }
+
+    GPA_SessionResultsView view;
+    view.m_sampleCount = static_cast<gpa_uint32>(sampleCount);
+    view.m_pSampleIds = sampleIds.data();
+    view.m_counterCount = static_cast<gpa_uint32>(counterIndices.size());
+    view.m_pCounterIndices = counterIndices.data();
+    view.m_rowSize = request.m_rowSize;
+    view.m_pResults = resultBuffer.data();
+
+    request.m_callback(request.m_sessionID, GPA_STATUS_OK, &view, request.m_pUserData);
+}
+
+//-----------------------------------------------------------------------------
+GPALIB_DECL GPA_Status GPA_RequestSessionResultsAsync(gpa_uint32 sessionID, GPA_SessionResultsCallback callback, void* pUserData)
+{
+    PROFILE_FUNCTION(GPA_RequestSessionResultsAsync);
+    TRACE_FUNCTION(GPA_RequestSessionResultsAsync);
+
+    if (nullptr == g_pCurrentContext)
+    {
+        GPA_LogError("Please call GPA_OpenContext before GPA_RequestSessionResultsAsync.");
+        return GPA_STATUS_ERROR_COUNTERS_NOT_OPEN;
+    }
+
+    if (nullptr == callback)
+    {
+        GPA_LogError("Parameter 'callback' is NULL.");
+        return GPA_STATUS_ERROR_NULL_POINTER;
+    }
+
+    // locate session
+    GPA_SessionRequests* checkSession = g_pCurrentContext->FindSession(sessionID);
+
+    if (nullptr == checkSession)
+    {
+        std::stringstream message;
+        message << "Parameter 'sessionID' (" << sessionID << ") is not one of the existing sessions.";
+        GPA_LogError(message.str().c_str());
+        return GPA_STATUS_ERROR_SESSION_NOT_FOUND;
+    }
+
+    if (g_pCurrentContext->m_samplingStarted && checkSession == g_pCurrentContext->m_pCurrentSessionRequests)
+    {
+        // the session would be found complete as soon as the submitted passes are, before the remaining passes are submitted
+        std::stringstream message;
+        message << "Session " << sessionID << " has not been ended. Please call GPA_EndSession before requesting its results.";
+        GPA_LogError(message.str().c_str());
+        return GPA_STATUS_ERROR_SAMPLING_NOT_ENDED;
+    }
+
+    std::shared_ptr<GPA_AsyncSessionResultsRequest> pRequest = std::make_shared<GPA_AsyncSessionResultsRequest>();
+    pRequest->m_pContextState = g_pCurrentContext;
+    pRequest->m_pSession = checkSession;
+    pRequest->m_sessionID = sessionID;
+    pRequest->m_callback = callback;
+    pRequest->m_pUserData = pUserData;
+
+    // the counters enabled now are the ones whose results are delivered, even if the selection changes before the session is complete
+    GPA_Status status = GetEnabledCounterGatherInfo(pRequest->m_gatherInfo, pRequest->m_maxInternalCounters, pRequest->m_rowSize);
+
+    if (GPA_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    // the plans of the scheduler are rebuilt when the passes change, which may happen before the session is complete, so the request keeps its own copy
+    pRequest->m_gatherPlans.resize(pRequest->m_gatherInfo.size());
+
+    for (std::vector<GPA_CounterGatherInfo>::const_iterator infoIter = pRequest->m_gatherInfo.begin(); infoIter != pRequest->m_gatherInfo.end(); ++infoIter)
+    {
+        pRequest->m_gatherEntries.insert(pRequest->m_gatherEntries.end(), infoIter->m_pGatherPlan->m_pEntries, infoIter->m_pGatherPlan->m_pEntries + infoIter->m_pGatherPlan->m_numEntries);
+    }
+
+    size_t firstEntry = 0;
+
+    for (size_t i = 0; i < pRequest->m_gatherInfo.size(); ++i)
+    {
+        GPA_CounterGatherPlan& plan = pRequest->m_gatherPlans[i];
+        plan.m_numEntries = pRequest->m_gatherInfo[i].m_pGatherPlan->m_numEntries;
+        plan.m_pEntries = pRequest->m_gatherEntries.data() + firstEntry;
+        firstEntry += plan.m_numEntries;
+
+        pRequest->m_gatherInfo[i].m_pGatherPlan = &plan;
+    }
+
+    checkSession->AddCompletionCallback([pRequest]()
+    {
+        DeliverSessionResults(*pRequest);
+    });
+
+    return GPA_STATUS_OK;
+}
+
 //-----------------------------------------------------------------------------
 GPALIB_DECL const char* GPA_GetStatusAsStr(GPA_Status status)
 {
@@ -1931,6 +2697,15 @@ GPALIB_DECL const char* GPA_GetStatusAsStr(GPA_Status status)
         case GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED:
             return "Hardware Not Supported";
 
+        case GPA_STATUS_ERROR_BUFFER_TOO_SMALL:
+            return "Buffer Too Small";
+
+        case GPA_STATUS_ERROR_TIMEOUT:
+            return "Timeout";
+
+        case GPA_STATUS_ERROR_API_NOT_SUPPORTED:
+            return "API Not Supported";
+
         default:
             break;
     }
@@ -1953,7 +2728,21 @@ GPALIB_DECL GPA_Status GPA_InternalProfileStop(const char* pFilename)
 {
     TRACE_FUNCTION(GPA_InternalProfileStop);
 
-    WRITE_PROFILE_REPORT(pFilename);
+#ifdef ENABLE_PROFILING
+    std::string filename(nullptr == pFilename ? "" : pFilename);
+    static const std::string s_jsonExtension(".json");
+
+    if (filename.size() >= s_jsonExtension.size() &&
+        0 == filename.compare(filename.size() - s_jsonExtension.size(), s_jsonExtension.size(), s_jsonExtension))
+    {
+        WRITE_PROFILE_REPORT_AS(filename, PROFILE_REPORT_JSON);
+    }
+    else
+    {
+        WRITE_PROFILE_REPORT(filename);
+    }
+
+#endif // ENABLE_PROFILING
     UNREFERENCED_PARAMETER(pFilename);
 
     return GPA_STATUS_OK;
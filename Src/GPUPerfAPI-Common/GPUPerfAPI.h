@@ -36,6 +36,10 @@
 /// to handle the different types of messages. A parameter to the callback function will
 /// indicate the message type being received. Messages will not contain a newline character
 /// at the end of the message.
+/// Messages are passed to the callback function by a thread owned by GPUPerfAPI shortly after they are logged,
+/// so the callback function must be thread safe. If messages are logged faster than the callback function handles them,
+/// the oldest ones are dropped and an error message reports how many were dropped.
+/// Only debug builds of GPUPerfAPI trace the GPUPerfAPI calls, release builds don't log any GPA_LOGGING_TRACE messages.
 /// \param loggingType Identifies the type of messages to receive callbacks for.
 /// \param pCallbackFuncPtr Pointer to the callback function
 /// \return GPA_STATUS_OK, unless the callbackFuncPtr is nullptr and the loggingType is not
@@ -61,6 +65,9 @@ GPALIB_DECL GPA_Status GPA_Destroy();
 /// \brief Opens the counters in the specified context for reading.
 ///
 /// This function must be called before any other GPA functions.
+/// The opened context becomes the currently active context of the calling thread.
+/// Each context has its own enabled counters and passes. The contexts which are open at the same time must be on the same hardware generation,
+/// since they share the available counters; GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED is returned for a context on another hardware generation.
 /// \param pContext The context to open counters for. Typically a device pointer. Refer to GPA API specific documentation for further details.
 /// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
 GPALIB_DECL GPA_Status GPA_OpenContext(void* pContext);
@@ -68,13 +75,16 @@ GPALIB_DECL GPA_Status GPA_OpenContext(void* pContext);
 /// \brief Closes the counters in the currently active context.
 ///
 /// GPA functions should not be called again until the counters are reopened with GPA_OpenContext.
+/// The context must not be in use by another thread when it is closed.
 /// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
 GPALIB_DECL GPA_Status GPA_CloseContext();
 
 /// \brief Select another context to be the currently active context.
 ///
 /// The selected context must have previously been opened with a call to GPA_OpenContext.
-/// If the call is successful, all GPA functions will act on the currently selected context.
+/// If the call is successful, all GPA functions called from the calling thread will act on the currently selected context.
+/// Each thread has its own currently active context, so different threads can profile different contexts at the same time;
+/// a context should only be used by one thread at a time.
 /// \param pContext The context to select. The same value that was passed to GPA_OpenContext.
 /// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
 GPALIB_DECL GPA_Status GPA_SelectContext(void* pContext);
@@ -218,6 +228,16 @@ GPALIB_DECL GPA_Status GPA_DisableAllCounters();
 GPALIB_DECL GPA_Status GPA_GetCounterIndex(const char* pCounter, gpa_uint32* pIndex);
 
 
+/// \brief Get the indices of several counters given their names (case insensitive).
+///
+/// Every name is looked up, and each one that is not found is reported in the log.
+/// \param ppCounters The names of the counters to get the indices for.
+/// \param counterCount The number of names in ppCounters.
+/// \param pIndices The indices of the requested counters, in the order of ppCounters. Must have room for counterCount values. The index of a counter that is not found is left unchanged.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if every counter is found, GPA_STATUS_ERROR_NOT_FOUND if any counter is not found.
+GPALIB_DECL GPA_Status GPA_GetCounterIndices(const char** ppCounters, gpa_uint32 counterCount, gpa_uint32* pIndices);
+
+
 /// \brief Get the number of passes required for the currently enabled set of counters.
 ///
 /// This represents the number of times the same sequence must be repeated to capture the counter data.
@@ -227,6 +247,40 @@ GPALIB_DECL GPA_Status GPA_GetCounterIndex(const char* pCounter, gpa_uint32* pIn
 GPALIB_DECL GPA_Status GPA_GetPassCount(gpa_uint32* pNumPasses);
 
 
+/// \brief Get the number of passes that would be required for a set of counters, without enabling them.
+///
+/// The counters are split into passes as if they were the only enabled counters, and enabled in the order given.
+/// Neither the enabled counters nor their passes are changed, so this can be used to choose a set of counters that fits in a number of passes.
+/// \param pCounterIndices The indices of the counters. Each must lie between 0 and (GPA_GetNumCounters result - 1).
+/// \param counterCount The number of counter indices in pCounterIndices.
+/// \param pNumPasses The value that will be set to the number of passes.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_GetPassCountForCounters(const gpa_uint32* pCounterIndices, gpa_uint32 counterCount, gpa_uint32* pNumPasses);
+
+
+/// \brief Get the passes in which an enabled counter is collected.
+///
+/// Two enabled counters share a pass when both of them are collected in it.
+/// \param counterIndex The index of the counter. The counter must be enabled.
+/// \param pPasses The array that will be set to 1 for each pass in which the counter is collected, and to 0 for the other passes.
+/// \param passCount The number of elements in pPasses. Must be at least the GPA_GetPassCount result.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_GetCounterPassAffinity(gpa_uint32 counterIndex, gpa_uint8* pPasses, gpa_uint32 passCount);
+
+
+/// \brief Enable the highest priority counters that can be collected within a number of passes.
+///
+/// All counters are disabled first. The counters are then considered in the order given, highest priority first:
+/// each counter is enabled if it can be collected together with the counters enabled before it within maxPasses passes, and skipped otherwise.
+/// GPA_GetPassCount returns at most maxPasses afterwards, which bounds the number of times a workload is replayed.
+/// \param pCounterIndices The indices of the counters, highest priority first. Each must lie between 0 and (GPA_GetNumCounters result - 1).
+/// \param counterCount The number of counter indices in pCounterIndices.
+/// \param maxPasses The maximum number of passes. Must be at least 1, GPA_STATUS_ERROR_FAILED is returned otherwise.
+/// \param pNumEnabled The value that will be set to the number of counters that were enabled.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_EnableCountersWithinPassBudget(const gpa_uint32* pCounterIndices, gpa_uint32 counterCount, gpa_uint32 maxPasses, gpa_uint32* pNumEnabled);
+
+
 /// \brief Begin sampling with the currently enabled set of counters.
 ///
 /// This must be called to begin the counter sampling process.
@@ -293,6 +347,28 @@ GPALIB_DECL GPA_Status GPA_EndSample();
 GPALIB_DECL GPA_Status GPA_GetSampleCount(gpa_uint32 sessionID, gpa_uint32* pSamples);
 
 
+/// \brief Set how the current context waits for counter results which are not available yet.
+///
+/// Functions which return counter results block until the results are available. By default they poll for the results,
+/// yielding the rest of the thread's time slice between polls once the results have been polled a number of times.
+/// The policy applies to every session of the current context.
+/// \param policy How to wait between polls of the outstanding results.
+/// \param timeoutMilliseconds The time after which a blocking function gives up and returns GPA_STATUS_ERROR_TIMEOUT, or 0 to wait until the results are available.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_SetFlushWaitPolicy(GPA_Flush_Wait_Policy policy, gpa_uint32 timeoutMilliseconds);
+
+
+/// \brief Set which thread collects the counter results of the current context from the API.
+///
+/// By default results are collected on the application thread, every few samples and whenever results are requested.
+/// In background mode a thread owned by GPUPerfAPI collects the results as soon as they are available,
+/// so GPA_IsSessionReady and GPA_IsSampleReady no longer query the driver.
+/// Background collection is only available for APIs whose calls can be made from any thread (currently OpenCL and HSA).
+/// \param mode The result collection mode.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_SetResultCollectionMode(GPA_Result_Collection_Mode mode);
+
+
 /// \brief Determine if an individual sample result is available.
 ///
 /// After a sampling session results may be available immediately or take a certain amount of time to become available.
@@ -367,6 +443,53 @@ GPALIB_DECL GPA_Status GPA_GetSampleFloat64(gpa_uint32 sessionID, gpa_uint32 sam
 GPALIB_DECL GPA_Status GPA_GetSampleFloat32(gpa_uint32 sessionID, gpa_uint32 sampleID, gpa_uint32 counterIndex, gpa_float32* pResult);
 
 
+/// \brief Get the results of all the enabled counters for a sample.
+///
+/// The buffer is filled with the result of each enabled counter, in the order given by GPA_GetEnabledIndex,
+/// with each result packed at the native width of its counter's data type (see GPA_GetCounterDataType).
+/// This function will block until the values are available.
+/// Use GPA_IsSampleReady if you do not wish to block.
+/// \param sessionID The session identifier with the sample you wish to retrieve the results of.
+/// \param sampleID The identifier of the sample to get the results for.
+/// \param pBuffer The buffer which will contain the counter results upon successful execution.
+/// \param bufferSize The size of pBuffer in bytes. It must be at least the sum of the sizes of the enabled counters' data types.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_GetSampleResults(gpa_uint32 sessionID, gpa_uint32 sampleID, void* pBuffer, size_t bufferSize);
+
+
+/// \brief Get the results of all the enabled counters for every sample of a session.
+///
+/// The buffer is filled with a dense table of GPA_GetSampleCount rows by GPA_GetEnabledCount columns.
+/// Rows are ordered by ascending sample ID and columns follow the order given by GPA_GetEnabledIndex.
+/// Each result is stored at the native width of its counter's data type (see GPA_GetCounterDataType).
+/// With GPA_RESULT_LAYOUT_ROW_MAJOR, each row holds one sample's results, packed as with GPA_GetSampleResults.
+/// With GPA_RESULT_LAYOUT_COLUMN_MAJOR, each column is a contiguous array of one counter's results for every sample,
+/// and the columns are stored one after another.
+/// This function will block until the values are available.
+/// Use GPA_IsSessionReady if you do not wish to block.
+/// \param sessionID The session identifier with the samples you wish to retrieve the results of.
+/// \param layout The layout of the results in the buffer.
+/// \param pBuffer The buffer which will contain the counter results upon successful execution.
+/// \param bufferSize The size of pBuffer in bytes. It must be at least the number of samples times the sum of the sizes of the enabled counters' data types.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_GetSessionResults(gpa_uint32 sessionID, GPA_Result_Layout layout, void* pBuffer, size_t bufferSize);
+
+
+/// \brief Request the results of every sample of a session without blocking.
+///
+/// The callback is called once all the passes of the session have landed, with the results laid out as GPA_GetSessionResults would store them with GPA_RESULT_LAYOUT_ROW_MAJOR.
+/// The results are computed for the counters which are enabled when this function is called.
+/// If the session is already complete, the callback is called before this function returns.
+/// Otherwise it is called by the background result collection thread (see GPA_SetResultCollectionMode),
+/// or, when results are collected on the application thread, by whichever GPUPerfAPI call finds the session complete.
+/// The callback must not call back into GPUPerfAPI; GPA_BeginSession, GPA_EndSession, GPA_SetResultCollectionMode and GPA_CloseContext fail with GPA_STATUS_ERROR_FAILED if it does.
+/// \param sessionID The session identifier with the samples you wish to retrieve the results of. The session must have been ended.
+/// \param callback The function which receives the results.
+/// \param pUserData A value which is passed to the callback.
+/// \return The GPA result status of the operation. GPA_STATUS_OK is returned if the operation is successful.
+GPALIB_DECL GPA_Status GPA_RequestSessionResultsAsync(gpa_uint32 sessionID, GPA_SessionResultsCallback callback, void* pUserData);
+
+
 /// \brief Get a string translation of a GPA status value.
 ///
 /// Provides a simple method to convert a status enum value into a string which can be used to display log messages.
@@ -49,8 +49,12 @@ typedef GPA_Status(*GPA_DisableCounterStrPtrType)(const char* pCounter);  ///< T
 typedef GPA_Status(*GPA_EnableAllCountersPtrType)();  ///< Typedef for a function pointer for GPA_EnableAllCounters
 typedef GPA_Status(*GPA_DisableAllCountersPtrType)();  ///< Typedef for a function pointer for GPA_DisableAllCounters
 typedef GPA_Status(*GPA_GetCounterIndexPtrType)(const char* pCounter, gpa_uint32* pIndex);  ///< Typedef for a function pointer for GPA_GetCounterIndex
+typedef GPA_Status(*GPA_GetCounterIndicesPtrType)(const char** ppCounters, gpa_uint32 counterCount, gpa_uint32* pIndices);  ///< Typedef for a function pointer for GPA_GetCounterIndices
 
 typedef GPA_Status(*GPA_GetPassCountPtrType)(gpa_uint32* pNumPasses);  ///< Typedef for a function pointer for GPA_GetPassCount
+typedef GPA_Status(*GPA_GetPassCountForCountersPtrType)(const gpa_uint32* pCounterIndices, gpa_uint32 counterCount, gpa_uint32* pNumPasses);  ///< Typedef for a function pointer for GPA_GetPassCountForCounters
+typedef GPA_Status(*GPA_GetCounterPassAffinityPtrType)(gpa_uint32 counterIndex, gpa_uint8* pPasses, gpa_uint32 passCount);  ///< Typedef for a function pointer for GPA_GetCounterPassAffinity
+typedef GPA_Status(*GPA_EnableCountersWithinPassBudgetPtrType)(const gpa_uint32* pCounterIndices, gpa_uint32 counterCount, gpa_uint32 maxPasses, gpa_uint32* pNumEnabled);  ///< Typedef for a function pointer for GPA_EnableCountersWithinPassBudget
 
 typedef GPA_Status(*GPA_BeginSessionPtrType)(gpa_uint32* pSessionID);  ///< Typedef for a function pointer for GPA_BeginSession
 typedef GPA_Status(*GPA_EndSessionPtrType)();  ///< Typedef for a function pointer for GPA_EndSession
@@ -63,12 +67,18 @@ typedef GPA_Status(*GPA_EndSamplePtrType)();  ///< Typedef for a function pointe
 
 typedef GPA_Status(*GPA_GetSampleCountPtrType)(gpa_uint32 sessionID, gpa_uint32* pSamples);  ///< Typedef for a function pointer for GPA_GetSampleCount
 
+typedef GPA_Status(*GPA_SetFlushWaitPolicyPtrType)(GPA_Flush_Wait_Policy policy, gpa_uint32 timeoutMilliseconds);  ///< Typedef for a function pointer for GPA_SetFlushWaitPolicy
+typedef GPA_Status(*GPA_SetResultCollectionModePtrType)(GPA_Result_Collection_Mode mode);  ///< Typedef for a function pointer for GPA_SetResultCollectionMode
+
 typedef GPA_Status(*GPA_IsSampleReadyPtrType)(bool* pReadyResult, gpa_uint32 sessionID, gpa_uint32 sampleID);  ///< Typedef for a function pointer for GPA_IsSampleReady
 typedef GPA_Status(*GPA_IsSessionReadyPtrType)(bool* pReadyResult, gpa_uint32 sessionID);  ///< Typedef for a function pointer for GPA_IsSessionReady
 typedef GPA_Status(*GPA_GetSampleUInt64PtrType)(gpa_uint32 sessionID, gpa_uint32 sampleID, gpa_uint32 counterID, gpa_uint64* pResult);  ///< Typedef for a function pointer for GPA_GetSampleUInt64
 typedef GPA_Status(*GPA_GetSampleUInt32PtrType)(gpa_uint32 sessionID, gpa_uint32 sampleID, gpa_uint32 counterIndex, gpa_uint32* pResult);  ///< Typedef for a function pointer for GPA_GetSampleUInt32
 typedef GPA_Status(*GPA_GetSampleFloat32PtrType)(gpa_uint32 sessionID, gpa_uint32 sampleID, gpa_uint32 counterIndex, gpa_float32* pResult);  ///< Typedef for a function pointer for GPA_GetSampleFloat32
 typedef GPA_Status(*GPA_GetSampleFloat64PtrType)(gpa_uint32 sessionID, gpa_uint32 sampleID, gpa_uint32 counterIndex, gpa_float64* pResult);  ///< Typedef for a function pointer for GPA_GetSampleFloat64
+typedef GPA_Status(*GPA_GetSampleResultsPtrType)(gpa_uint32 sessionID, gpa_uint32 sampleID, void* pBuffer, size_t bufferSize);  ///< Typedef for a function pointer for GPA_GetSampleResults
+typedef GPA_Status(*GPA_GetSessionResultsPtrType)(gpa_uint32 sessionID, GPA_Result_Layout layout, void* pBuffer, size_t bufferSize);  ///< Typedef for a function pointer for GPA_GetSessionResults
+typedef GPA_Status(*GPA_RequestSessionResultsAsyncPtrType)(gpa_uint32 sessionID, GPA_SessionResultsCallback callback, void* pUserData);  ///< Typedef for a function pointer for GPA_RequestSessionResultsAsync
 
 typedef GPA_Status(*GPA_GetDeviceIDPtrType)(gpa_uint32* pDeviceID);  ///< Typedef for a function pointer for GPA_GetDeviceID
 typedef GPA_Status(*GPA_GetDeviceDescPtrType)(const char** ppDesc);  ///< Typedef for a function pointer for GPA_GetDeviceDesc
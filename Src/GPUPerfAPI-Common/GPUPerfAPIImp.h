@@ -28,7 +28,8 @@ GPA_DataRequest* GPA_IMP_CreateDataRequest();
 
 #include "GPAContextState.h"
 
-extern GPA_ContextState* g_pCurrentContext;
+/// The current context of the calling thread
+extern thread_local GPA_ContextState* g_pCurrentContext;
 
 // Functions which a GPA implementation layer must support
 
@@ -11,6 +11,7 @@
 #define _GPUPERFAPI_TYPES_H_
 
 #include <limits.h>
+#include <stddef.h>
 
 // Type definitions
 #ifdef _WIN32
@@ -117,6 +118,9 @@ typedef enum
     GPA_STATUS_ERROR_FAILED,
     GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED,
     GPA_STATUS_ERROR_DRIVER_NOT_SUPPORTED,
+    GPA_STATUS_ERROR_BUFFER_TOO_SMALL,
+    GPA_STATUS_ERROR_TIMEOUT,
+    GPA_STATUS_ERROR_API_NOT_SUPPORTED,
 
     // following are status codes used internally within GPUPerfAPI
     GPA_STATUS_INTERNAL = 256,
@@ -148,6 +152,50 @@ typedef enum
     GPA_USAGE_TYPE__LAST          ///< Marker indicating last element
 } GPA_Usage_Type;
 
+/// Session result layout definitions
+typedef enum
+{
+    GPA_RESULT_LAYOUT_ROW_MAJOR,     ///< Results are stored sample by sample, each row holding the result of every enabled counter
+    GPA_RESULT_LAYOUT_COLUMN_MAJOR,  ///< Results are stored counter by counter, each column holding a contiguous array of the counter's results for every sample
+    GPA_RESULT_LAYOUT__LAST          ///< Marker indicating last element
+} GPA_Result_Layout;
+
+/// Flush wait policy definitions, which control how GPUPerfAPI waits for outstanding counter results
+typedef enum
+{
+    GPA_FLUSH_WAIT_SPIN,            ///< Continuously poll for the results
+    GPA_FLUSH_WAIT_SPIN_THEN_YIELD, ///< Poll for the results a number of times, then yield the rest of the thread's time slice between polls
+    GPA_FLUSH_WAIT_BACKOFF_SLEEP,   ///< Poll for the results a number of times, then sleep between polls, doubling the sleep time up to a limit
+    GPA_FLUSH_WAIT_BACKEND,         ///< Block on the API's own wait primitive for the oldest outstanding result where there is one, otherwise yield between polls
+    GPA_FLUSH_WAIT__LAST            ///< Marker indicating last element
+} GPA_Flush_Wait_Policy;
+
+/// Result collection mode definitions, which control which thread collects the counter results from the API
+typedef enum
+{
+    GPA_RESULT_COLLECTION_APPLICATION_THREAD, ///< Results are collected when the application calls into GPUPerfAPI, either periodically from GPA_EndSample or when results are requested
+    GPA_RESULT_COLLECTION_BACKGROUND_THREAD,  ///< Results are collected as soon as they are available by a thread owned by GPUPerfAPI
+    GPA_RESULT_COLLECTION__LAST               ///< Marker indicating last element
+} GPA_Result_Collection_Mode;
+
+/// A read-only view of the results of every sample of a session, which is passed to a GPA_SessionResultsCallback
+typedef struct
+{
+    gpa_uint32 m_sampleCount;            ///< The number of samples in the session
+    const gpa_uint32* m_pSampleIds;      ///< The ID of each sample, in ascending order
+    gpa_uint32 m_counterCount;           ///< The number of counters in each row
+    const gpa_uint32* m_pCounterIndices; ///< The index of each counter, in the order its result is stored in a row
+    size_t m_rowSize;                    ///< The size in bytes of one row
+    const void* m_pResults;              ///< The results in GPA_RESULT_LAYOUT_ROW_MAJOR layout, one row for each entry of m_pSampleIds
+} GPA_SessionResultsView;
+
+/// Callback which receives the results of a session requested with GPA_RequestSessionResultsAsync
+/// \param sessionID The session whose results were requested.
+/// \param status GPA_STATUS_OK if the results were computed; otherwise the error which prevented it.
+/// \param pResults The results of the session, or NULL if status is not GPA_STATUS_OK. They are only valid until the callback returns.
+/// \param pUserData The user data which was passed to GPA_RequestSessionResultsAsync.
+typedef void(*GPA_SessionResultsCallback)(gpa_uint32 sessionID, GPA_Status status, const GPA_SessionResultsView* pResults, void* pUserData);
+
 /// Logging type definitions
 typedef enum
 {
@@ -6,6 +6,7 @@
 //==============================================================================
 
 #include "Logging.h"
+#include <chrono>
 
 #ifdef _WIN32
     #pragma comment( lib, "Winmm.lib" )
@@ -13,13 +14,20 @@
 
 static const char MUTEX_NAME[]     = "GPALoggerMutex"; ///< mutex name
 
+/// The longest time the logging thread waits before checking the ring again, in case it missed a notification
+static const unsigned int LOGGING_THREAD_MAX_WAIT_MILLISECONDS = 100;
+
+/// Indicates whether the calling thread is the logging thread
+static thread_local bool s_isLoggingThread = false;
+
+/// Stores the number of tabs to indent nested function calls made on the calling thread.
+static thread_local unsigned int s_logTab = 0;
+
 GPATracer gTracerSingleton;
 GPALogger g_loggerSingleton;
 
 GPATracer::GPATracer()
 {
-    m_logTab = 0;
-
 #ifdef AMDT_INTERNAL
     // in internal builds, we want all the tracing to be displayed
     m_topLevelOnly = false;
@@ -32,11 +40,11 @@ GPATracer::GPATracer()
 
 void GPATracer::EnterFunction(const char* pFunctionName)
 {
-    if ((!m_logTab && m_topLevelOnly) || !m_topLevelOnly)
+    if ((!s_logTab && m_topLevelOnly) || !m_topLevelOnly)
     {
         std::string message;
 
-        for (unsigned int tempLogTab = 0; tempLogTab < m_logTab; tempLogTab++)
+        for (unsigned int tempLogTab = 0; tempLogTab < s_logTab; tempLogTab++)
         {
             message += "   ";
         }
@@ -47,7 +55,7 @@ void GPATracer::EnterFunction(const char* pFunctionName)
 #ifdef AMDT_INTERNAL
         GPA_LogDebugTrace(message.c_str());
 
-        if (m_logTab == 0)
+        if (s_logTab == 0)
         {
             // if this is the top level, also pass it to the normal LogTrace
             GPA_LogTrace(message.c_str());
@@ -58,19 +66,19 @@ void GPATracer::EnterFunction(const char* pFunctionName)
 #endif // AMDT_INTERNAL
     }
 
-    m_logTab++;
+    s_logTab++;
 }
 
 
 void GPATracer::LeaveFunction(const char* pFunctionName)
 {
-    m_logTab--;
+    s_logTab--;
 
-    if ((!m_logTab && m_topLevelOnly) || !m_topLevelOnly)
+    if ((!s_logTab && m_topLevelOnly) || !m_topLevelOnly)
     {
         std::string message;
 
-        for (unsigned int tempLogTab = 0; tempLogTab < m_logTab; tempLogTab++)
+        for (unsigned int tempLogTab = 0; tempLogTab < s_logTab; tempLogTab++)
         {
             message += "   ";
         }
@@ -81,7 +89,7 @@ void GPATracer::LeaveFunction(const char* pFunctionName)
 #ifdef AMDT_INTERNAL
         GPA_LogDebugTrace(message.c_str());
 
-        if (m_logTab == 0)
+        if (s_logTab == 0)
         {
             // if this is the top level, also pass it to the normal LogTrace
             GPA_LogTrace(message.c_str());
@@ -94,20 +102,22 @@ void GPATracer::LeaveFunction(const char* pFunctionName)
 }
 
 
-ScopeTrace::ScopeTrace(const char* pTraceFunction)
-{
-    gTracerSingleton.EnterFunction(pTraceFunction);
-    m_pTraceFunction = pTraceFunction;
-}
-
-ScopeTrace::~ScopeTrace()
-{
-    gTracerSingleton.LeaveFunction(m_pTraceFunction);
-}
-
-
-
 GPALogger::GPALogger()
+    : m_loggingType(GPA_LOGGING_NONE),
+      m_loggingCallback(nullptr),
+#ifdef AMDT_INTERNAL
+      m_loggingDebugType(GPA_LOG_NONE),
+      m_loggingDebugCallback(nullptr),
+#endif // AMDT_INTERNAL
+      m_pRing(nullptr),
+      m_enqueuePosition(0),
+      m_dequeuePosition(0),
+      m_droppedMessageCount(0),
+      m_reportedDroppedMessageCount(0),
+      m_isLoggingThreadRunning(false),
+      m_stopLoggingThread(false),
+      m_isLoggingThreadWaiting(false),
+      m_isDelivering(false)
 {
 #ifdef _WIN32
     InitializeCriticalSection(&m_hLock);
@@ -129,48 +139,399 @@ GPALogger::GPALogger()
 
 void GPALogger::SetLoggingCallback(GPA_Logging_Type loggingType, GPA_LoggingCallbackPtrType loggingCallback)
 {
+    EnterCriticalSection(&m_hLock);
+
+    // messages which have already been logged go to the callback which was registered when they were logged
+    Flush();
+
     if (nullptr == loggingCallback)
     {
-        m_loggingCallback = nullptr;
         m_loggingType = GPA_LOGGING_NONE;
+        m_loggingCallback = nullptr;
     }
     else
     {
+        StartLoggingThread();
         m_loggingCallback = loggingCallback;
         m_loggingType = loggingType;
     }
+
+#ifdef AMDT_INTERNAL
+
+    if (nullptr == m_loggingCallback && nullptr == m_loggingDebugCallback)
+#else
+    if (nullptr == m_loggingCallback)
+#endif // AMDT_INTERNAL
+    {
+        StopLoggingThread();
+    }
+
+    LeaveCriticalSection(&m_hLock);
 }
 
 #ifdef AMDT_INTERNAL
 void GPALogger::SetLoggingDebugCallback(GPA_Log_Debug_Type loggingType, GPA_LoggingDebugCallbackPtrType loggingDebugCallback)
 {
+    EnterCriticalSection(&m_hLock);
+
+    Flush();
+
     if (nullptr == loggingDebugCallback)
     {
-        m_loggingDebugCallback = nullptr;
         m_loggingDebugType = GPA_LOG_NONE;
+        m_loggingDebugCallback = nullptr;
     }
     else
     {
+        StartLoggingThread();
         m_loggingDebugCallback = loggingDebugCallback;
         m_loggingDebugType = loggingType;
     }
+
+    if (nullptr == m_loggingCallback && nullptr == m_loggingDebugCallback)
+    {
+        StopLoggingThread();
+    }
+
+    LeaveCriticalSection(&m_hLock);
 }
 #endif // AMDT_INTERNAL
 
 void GPALogger::Log(GPA_Log_Debug_Type logType, const char* pMessage)
+{
+    // the message is ignored unless the user wants to be notified of its type
+    if (IsLogTypeEnabled(logType))
+    {
+        Enqueue(logType, nullptr, nullptr, 0, pMessage);
+    }
+}
+
+void GPALogger::Flush()
+{
+    if (s_isLoggingThread)
+    {
+        // the logging thread is calling a callback function, so it can't pass the messages along until this returns
+        return;
+    }
+
+    size_t lastPosition = m_enqueuePosition.load();
+
+    std::unique_lock<std::mutex> lock(m_loggingThreadMutex);
+
+    m_loggingThreadCondition.notify_one();
+    m_flushCondition.wait(lock, [this, lastPosition]
+    {
+        return !m_isLoggingThreadRunning || (m_dequeuePosition.load() >= lastPosition && !m_isDelivering);
+    });
+}
+
+void GPALogger::StopLogging()
 {
     EnterCriticalSection(&m_hLock);
 
+    StopLoggingThread();
+
+    LeaveCriticalSection(&m_hLock);
+}
+
+gpa_uint64 GPALogger::GetDroppedMessageCount() const
+{
+    return m_droppedMessageCount;
+}
+
+void GPALogger::Enqueue(GPA_Log_Debug_Type logType, const char* pFormat, const GPA_LogArg* pArgs, unsigned int argCount, const char* pMessage)
+{
+    GPA_LogRecord* pRing = m_pRing.load(std::memory_order_acquire);
+    GPA_LogRecord* pRecord = nullptr;
+    GPA_LogRecord localRecord;
+
+    size_t messageLength = (nullptr == pFormat) ? strlen(pMessage) : 0;
+    char* pLongMessage = nullptr;
+
+    if (messageLength >= GPA_LOG_RECORD_MESSAGE_SIZE)
+    {
+        // the message does not fit in the record, so it is copied out of line rather than truncated;
+        // this is done before a slot is claimed, so that the logging thread does not wait for the allocation
+        pLongMessage = new(std::nothrow) char[messageLength + 1];
+
+        if (nullptr != pLongMessage)
+        {
+            memcpy(pLongMessage, pMessage, messageLength + 1);
+        }
+    }
+
+    size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+    if (nullptr == pRing || !m_isLoggingThreadRunning)
+    {
+        // the logging thread could not be started or has been stopped, so pass the message along directly
+        pRecord = &localRecord;
+    }
+
+    while (nullptr == pRecord)
+    {
+        GPA_LogRecord* pSlot = &pRing[position & (GPA_LOG_RING_SIZE - 1)];
+        size_t sequence = pSlot->m_sequence.load(std::memory_order_acquire);
+        ptrdiff_t difference = static_cast<ptrdiff_t>(sequence - position);
+
+        if (0 == difference)
+        {
+            // the slot is free, claim it
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                pRecord = pSlot;
+            }
+        }
+        else if (difference < 0)
+        {
+            // the ring is full, so drop the oldest message to make room
+            m_droppedMessageCount++;
+
+            if (!Dequeue(nullptr))
+            {
+                // the oldest message is still being added, so drop this one instead rather than wait for it
+                delete[] pLongMessage;
+                return;
+            }
+
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            // another thread claimed the slot first
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    pRecord->m_logType = logType;
+    pRecord->m_pFormat = pFormat;
+    pRecord->m_argCount = argCount;
+
+    for (unsigned int i = 0; i < argCount; i++)
+    {
+        pRecord->m_args[i] = pArgs[i];
+    }
+
+    if (nullptr != pLongMessage)
+    {
+        pRecord->m_pLongMessage = pLongMessage;
+    }
+    else if (nullptr == pFormat)
+    {
+        strncpy(pRecord->m_message, pMessage, GPA_LOG_RECORD_MESSAGE_SIZE - 1);
+        pRecord->m_message[GPA_LOG_RECORD_MESSAGE_SIZE - 1] = '\0';
+
+        if (messageLength >= GPA_LOG_RECORD_MESSAGE_SIZE)
+        {
+            // the message could not be copied out of line, so show that it has been cut short
+            memcpy(&pRecord->m_message[GPA_LOG_RECORD_MESSAGE_SIZE - 4], "...", 4);
+        }
+    }
+
+    if (pRecord == &localRecord)
+    {
+        Deliver(localRecord);
+        return;
+    }
+
+    pRecord->m_sequence.store(position + 1, std::memory_order_release);
+
+    // pairs with the fence in LoggingThreadProc, so that either the logging thread sees this message or this sees the thread waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (m_isLoggingThreadWaiting.load(std::memory_order_relaxed))
+    {
+        std::lock_guard<std::mutex> lock(m_loggingThreadMutex);
+        m_loggingThreadCondition.notify_one();
+    }
+}
+
+bool GPALogger::Dequeue(GPA_LogRecord* pRecord)
+{
+    GPA_LogRecord* pRing = m_pRing.load(std::memory_order_acquire);
+
+    if (nullptr == pRing)
+    {
+        return false;
+    }
+
+    GPA_LogRecord* pSlot = nullptr;
+    size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+
+    while (nullptr == pSlot)
+    {
+        GPA_LogRecord* pOldest = &pRing[position & (GPA_LOG_RING_SIZE - 1)];
+        size_t sequence = pOldest->m_sequence.load(std::memory_order_acquire);
+        ptrdiff_t difference = static_cast<ptrdiff_t>(sequence - (position + 1));
+
+        if (0 == difference)
+        {
+            // the message has been written, claim it
+            if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                pSlot = pOldest;
+            }
+        }
+        else if (difference < 0)
+        {
+            // the ring is empty, or its oldest message is still being written
+            return false;
+        }
+        else
+        {
+            // another thread removed the message first
+            position = m_dequeuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    if (nullptr != pRecord)
+    {
+        pRecord->m_logType = pSlot->m_logType;
+        pRecord->m_pFormat = pSlot->m_pFormat;
+        pRecord->m_argCount = pSlot->m_argCount;
+
+        for (unsigned int i = 0; i < pSlot->m_argCount; i++)
+        {
+            pRecord->m_args[i] = pSlot->m_args[i];
+        }
+
+        // the message stored out of line now belongs to the caller
+        delete[] pRecord->m_pLongMessage;
+        pRecord->m_pLongMessage = pSlot->m_pLongMessage;
+
+        if (nullptr == pSlot->m_pFormat && nullptr == pSlot->m_pLongMessage)
+        {
+            strcpy(pRecord->m_message, pSlot->m_message);
+        }
+    }
+    else
+    {
+        delete[] pSlot->m_pLongMessage;
+    }
+
+    pSlot->m_pLongMessage = nullptr;
+
+    // free the slot for the message which will be added GPA_LOG_RING_SIZE messages later
+    pSlot->m_sequence.store(position + GPA_LOG_RING_SIZE, std::memory_order_release);
+
+    return true;
+}
+
+/// Formats a message from a printf-style format string and numeric arguments.
+/// Each conversion is formatted separately, using the stored type of its argument rather than the length modifier of the format string.
+/// \param pFormat the format string
+/// \param pArgs the arguments of the format string
+/// \param argCount the number of entries in pArgs
+/// \param[out] message will contain the formatted message
+static void FormatLogMessage(const char* pFormat, const GPA_LogArg* pArgs, unsigned int argCount, std::string& message)
+{
+    unsigned int argIndex = 0;
+    const char* pCurrent = pFormat;
+
+    while ('\0' != *pCurrent)
+    {
+        if ('%' != *pCurrent)
+        {
+            message += *pCurrent++;
+            continue;
+        }
+
+        if ('%' == pCurrent[1])
+        {
+            message += '%';
+            pCurrent += 2;
+            continue;
+        }
+
+        // keep the flags, width and precision of the conversion, and skip its length modifier
+        std::string conversionSpec("%");
+        const char* pSpec = pCurrent + 1;
+
+        while ('\0' != *pSpec && nullptr != strchr("-+ #0123456789.", *pSpec))
+        {
+            conversionSpec += *pSpec++;
+        }
+
+        while ('\0' != *pSpec && nullptr != strchr("hljztL", *pSpec))
+        {
+            pSpec++;
+        }
+
+        char conversion = *pSpec;
+
+        if ('\0' == conversion || argIndex >= argCount)
+        {
+            // malformed, or there is no argument left for the conversion, so show the rest as it is
+            message += pCurrent;
+            break;
+        }
+
+        const GPA_LogArg& arg = pArgs[argIndex++];
+        long long signedValue = (GPA_LOG_ARG_FLOAT == arg.m_type) ? static_cast<long long>(arg.m_float) : arg.m_signed;
+        double floatValue = (GPA_LOG_ARG_FLOAT == arg.m_type) ? arg.m_float :
+                            (GPA_LOG_ARG_SIGNED == arg.m_type) ? static_cast<double>(arg.m_signed) : static_cast<double>(arg.m_unsigned);
+
+        char buffer[128] = "";
+
+        if (nullptr != strchr("di", conversion))
+        {
+            conversionSpec += "ll";
+            conversionSpec += conversion;
+            snprintf(buffer, sizeof(buffer), conversionSpec.c_str(), signedValue);
+        }
+        else if (nullptr != strchr("ouxX", conversion))
+        {
+            conversionSpec += "ll";
+            conversionSpec += conversion;
+            snprintf(buffer, sizeof(buffer), conversionSpec.c_str(), static_cast<unsigned long long>(signedValue));
+        }
+        else if (nullptr != strchr("eEfFgGaA", conversion))
+        {
+            conversionSpec += conversion;
+            snprintf(buffer, sizeof(buffer), conversionSpec.c_str(), floatValue);
+        }
+        else if ('c' == conversion)
+        {
+            conversionSpec += conversion;
+            snprintf(buffer, sizeof(buffer), conversionSpec.c_str(), static_cast<int>(signedValue));
+        }
+        else
+        {
+            // strings and pointers can't be deferred, since they may not be valid by the time the message is formatted
+            conversionSpec += conversion;
+            strncpy(buffer, conversionSpec.c_str(), sizeof(buffer) - 1);
+        }
+
+        message += buffer;
+        pCurrent = pSpec + 1;
+    }
+}
+
+void GPALogger::Deliver(GPA_LogRecord& record)
+{
+    const char* pMessage = (nullptr != record.m_pLongMessage) ? record.m_pLongMessage : record.m_message;
+    std::string formattedMessage;
+
+    if (nullptr != record.m_pFormat)
+    {
+        FormatLogMessage(record.m_pFormat, record.m_args, record.m_argCount, formattedMessage);
+        pMessage = formattedMessage.c_str();
+    }
+
+    GPA_Log_Debug_Type logType = record.m_logType;
+
 #ifdef AMDT_INTERNAL
 
     if (logType > GPA_LOG_ALL)
     {
         // this is in the debug message range,
         // so log it to the debug callback
+        GPA_LoggingDebugCallbackPtrType loggingDebugCallback = m_loggingDebugCallback;
+
         if ((logType & m_loggingDebugType) &&
-            nullptr != m_loggingDebugCallback)
+            nullptr != loggingDebugCallback)
         {
-            m_loggingDebugCallback(logType, pMessage);
+            loggingDebugCallback(logType, pMessage);
         }
 
     }
@@ -179,21 +540,167 @@ void GPALogger::Log(GPA_Log_Debug_Type logType, const char* pMessage)
     {
         // convert from private GPA_Log_Debug_type to public GPA_Logging_Type
         GPA_Logging_Type messageType = (GPA_Logging_Type)logType;
+        GPA_LoggingCallbackPtrType loggingCallback = m_loggingCallback;
 
         // if the supplied message type is among those that the user wants be notified of,
         // then pass the message along.
         if ((messageType & m_loggingType) &&
-            nullptr != m_loggingCallback)
+            nullptr != loggingCallback)
         {
-            m_loggingCallback(messageType, pMessage);
+            loggingCallback(messageType, pMessage);
         }
     }
 
-    LeaveCriticalSection(&m_hLock);
+    delete[] record.m_pLongMessage;
+    record.m_pLongMessage = nullptr;
+}
+
+void GPALogger::StartLoggingThread()
+{
+    std::lock_guard<std::mutex> lock(m_loggingThreadMutex);
+
+    if (m_isLoggingThreadRunning)
+    {
+        return;
+    }
+
+    if (nullptr == m_pRing.load())
+    {
+        GPA_LogRecord* pRing = new(std::nothrow) GPA_LogRecord[GPA_LOG_RING_SIZE];
+
+        if (nullptr == pRing)
+        {
+            // messages will be passed along by the threads which log them
+            return;
+        }
+
+        for (size_t i = 0; i < GPA_LOG_RING_SIZE; i++)
+        {
+            pRing[i].m_sequence = i;
+        }
+
+        m_pRing.store(pRing, std::memory_order_release);
+    }
+
+    m_stopLoggingThread = false;
+    m_isLoggingThreadRunning = true;
+    m_loggingThread = std::thread(&GPALogger::LoggingThreadProc, this);
+}
+
+void GPALogger::StopLoggingThread()
+{
+    if (s_isLoggingThread)
+    {
+        // a callback function can't wait for the thread which is calling it, so the thread keeps running
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_loggingThreadMutex);
+
+        if (!m_isLoggingThreadRunning)
+        {
+            return;
+        }
+
+        m_stopLoggingThread = true;
+    }
+
+    m_loggingThreadCondition.notify_one();
+    m_loggingThread.join();
+
+    {
+        std::lock_guard<std::mutex> lock(m_loggingThreadMutex);
+        m_isLoggingThreadRunning = false;
+    }
+
+    // messages which were added while the thread was exiting are passed along here
+    GPA_LogRecord record;
+
+    while (Dequeue(&record))
+    {
+        Deliver(record);
+    }
+
+    m_flushCondition.notify_all();
+}
+
+void GPALogger::LoggingThreadProc()
+{
+    s_isLoggingThread = true;
+
+    GPA_LogRecord record;
+    std::unique_lock<std::mutex> lock(m_loggingThreadMutex);
+
+    for (;;)
+    {
+        lock.unlock();
+
+        // set before taking a message off the ring, so that Flush can't see the message gone before it has been passed along
+        m_isDelivering = true;
+
+        while (Dequeue(&record))
+        {
+            Deliver(record);
+        }
+
+        gpa_uint64 droppedMessageCount = m_droppedMessageCount;
+
+        if (droppedMessageCount != m_reportedDroppedMessageCount)
+        {
+            GPA_LogArg droppedArg = MakeLogArg(droppedMessageCount - m_reportedDroppedMessageCount);
+
+            record.m_logType = GPA_LOG_ERROR;
+            record.m_pFormat = "%llu log messages were dropped because they were logged faster than they could be passed to the logging callback.";
+            record.m_argCount = 1;
+            record.m_args[0] = droppedArg;
+            Deliver(record);
+
+            m_reportedDroppedMessageCount = droppedMessageCount;
+        }
+
+        m_isDelivering = false;
+
+        lock.lock();
+        m_flushCondition.notify_all();
+
+        m_isLoggingThreadWaiting = true;
+
+        // pairs with the fence in Enqueue
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        GPA_LogRecord* pOldest = &m_pRing.load()[m_dequeuePosition.load() & (GPA_LOG_RING_SIZE - 1)];
+        bool isRingEmpty = pOldest->m_sequence.load() != m_dequeuePosition.load() + 1;
+
+        if (isRingEmpty)
+        {
+            if (m_stopLoggingThread)
+            {
+                break;
+            }
+
+            m_loggingThreadCondition.wait_for(lock, std::chrono::milliseconds(LOGGING_THREAD_MAX_WAIT_MILLISECONDS));
+        }
+
+        m_isLoggingThreadWaiting = false;
+    }
+
+    m_isLoggingThreadWaiting = false;
 }
 
 GPALogger::~GPALogger()
 {
+    // joining the logging thread here would deadlock when the library is unloaded, since this runs under the loader lock the exiting thread needs;
+    // GPA_Destroy and clearing the callback functions stop it, otherwise it is left running with the ring until the process exits
+    if (m_loggingThread.joinable())
+    {
+        m_loggingThread.detach();
+    }
+    else
+    {
+        delete[] m_pRing.load();
+    }
+
 #ifdef _WIN32
     DeleteCriticalSection(&m_hLock);
 #else
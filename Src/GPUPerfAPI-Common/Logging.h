@@ -23,13 +23,18 @@
 
 #endif
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <type_traits>
 using std::string;
 
 #include "GPUPerfAPITypes-Private.h"
 #include "GPUPerfAPIFunctionTypes-Private.h"
 
-#if 1 // enable trace functions ?
+#ifndef GPA_DISABLE_TRACE_FUNCTIONS // release builds define GPA_DISABLE_TRACE_FUNCTIONS to compile the trace functions out of the library
     #undef TRACE_FUNCTION
     /// macro for tracing function calls
     #define TRACE_FUNCTION(func) ScopeTrace _tempScopeTraceObject(#func)
@@ -48,8 +53,97 @@ using std::string;
     #define TRACE_PRIVATE_FUNCTION(func)
 #endif // trace functions
 
+/// The maximum number of arguments of a log message whose formatting is deferred to the logging thread
+static const unsigned int GPA_LOG_MAX_ARGS = 4;
+
+/// The size of the message text stored in a log record, including the terminating null; longer messages are copied out of line
+static const size_t GPA_LOG_RECORD_MESSAGE_SIZE = 512;
+
+/// The number of log records which can wait for the logging thread; must be a power of two
+static const size_t GPA_LOG_RING_SIZE = 512;
+
+/// The type of an argument of a log message whose formatting is deferred to the logging thread
+enum GPA_LogArgType
+{
+    GPA_LOG_ARG_SIGNED,   ///< A signed integer
+    GPA_LOG_ARG_UNSIGNED, ///< An unsigned integer or an enumeration
+    GPA_LOG_ARG_FLOAT,    ///< A floating point number
+};
+
+/// An argument of a log message whose formatting is deferred to the logging thread
+struct GPA_LogArg
+{
+    GPA_LogArgType m_type;               ///< The type of the argument
+
+    union
+    {
+        long long m_signed;              ///< The value of a GPA_LOG_ARG_SIGNED argument
+        unsigned long long m_unsigned;   ///< The value of a GPA_LOG_ARG_UNSIGNED argument
+        double m_float;                  ///< The value of a GPA_LOG_ARG_FLOAT argument
+    };
+};
+
+/// Stores a numeric value as the argument of a deferred log message.
+/// \param value the value of the argument
+/// \return the argument
+template<typename T>
+inline GPA_LogArg MakeLogArg(T value)
+{
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Only numbers can be passed to a deferred log message");
+
+    GPA_LogArg arg;
+
+    if (std::is_floating_point<T>::value)
+    {
+        arg.m_type = GPA_LOG_ARG_FLOAT;
+        arg.m_float = static_cast<double>(value);
+    }
+    else if (std::is_signed<T>::value)
+    {
+        arg.m_type = GPA_LOG_ARG_SIGNED;
+        arg.m_signed = static_cast<long long>(value);
+    }
+    else
+    {
+        arg.m_type = GPA_LOG_ARG_UNSIGNED;
+        arg.m_unsigned = static_cast<unsigned long long>(value);
+    }
+
+    return arg;
+}
+
+/// A log message waiting to be passed to the callback function by the logging thread
+struct GPA_LogRecord
+{
+    /// Orders the record between the threads which write and read it: it equals the ring position of the record once the record is free,
+    /// and the position plus one once the record has been written.
+    std::atomic<size_t> m_sequence;
+
+    /// Initializes a new instance of the GPA_LogRecord struct.
+    GPA_LogRecord()
+        : m_pLongMessage(nullptr)
+    {
+    }
+
+    /// Frees the message stored out of line, if the record still owns one.
+    ~GPA_LogRecord()
+    {
+        delete[] m_pLongMessage;
+    }
+
+    GPA_Log_Debug_Type m_logType;                  ///< The type of the message
+    const char* m_pFormat;                         ///< The format string of the message, or nullptr if m_message or m_pLongMessage holds the message
+    unsigned int m_argCount;                       ///< The number of entries of m_args used by m_pFormat
+    GPA_LogArg m_args[GPA_LOG_MAX_ARGS];           ///< The arguments of m_pFormat
+    char m_message[GPA_LOG_RECORD_MESSAGE_SIZE];   ///< The message, if it was logged already formatted and fits
+    char* m_pLongMessage;                          ///< The message, if it was logged already formatted and does not fit in m_message; owned by the record
+};
+
 /// Passes log messages of various types to a user-supplied callback function
 /// if the user has elected to receive messages of that particular type.
+/// Messages are queued in a lock-free ring and passed to the callback by a logging thread,
+/// so that the threads which log them do not wait for the formatting of the message or for the callback.
+/// If the ring is full, the oldest message is dropped to make room.
 class GPALogger
 {
 public:
@@ -61,6 +155,7 @@ public:
     virtual ~GPALogger();
 
     /// Sets the type of message the user would like to be informed of and a pointer to the callback function.
+    /// Messages logged before this call are passed to the previous callback function first.
     /// \param loggingType the type of messages to pass on to the callback function
     /// \param loggingCallback a pointer to the callback function
     void SetLoggingCallback(GPA_Logging_Type loggingType, GPA_LoggingCallbackPtrType loggingCallback);
@@ -72,11 +167,46 @@ public:
     void SetLoggingDebugCallback(GPA_Log_Debug_Type loggingType, GPA_LoggingDebugCallbackPtrType loggingDebugCallback);
 #endif // AMDT_INTERNAL
 
+    /// Indicates whether the user has accepted a type of message, so that a caller can skip building a message which would be ignored.
+    /// \param logType the type of message
+    /// \return true if messages of the type are passed to a callback function; false otherwise
+    bool IsLogTypeEnabled(GPA_Log_Debug_Type logType) const
+    {
+#ifdef AMDT_INTERNAL
+
+        if (logType > GPA_LOG_ALL)
+        {
+            return 0 != (logType & m_loggingDebugType.load(std::memory_order_relaxed));
+        }
+
+#endif // AMDT_INTERNAL
+
+        return 0 != (logType & m_loggingType.load(std::memory_order_relaxed));
+    }
+
     /// Passes the supplied message to the callback function if the user has accepted that type of message.
     /// \param logType the type of message being supplied
     /// \param pMessage the message to pass along
     void Log(GPA_Log_Debug_Type logType, const char* pMessage);
 
+    /// Formats a message and passes it to the callback function if the user has accepted that type of message.
+    /// Only the format string and the arguments are stored, the message is formatted on the logging thread.
+    /// \param logType the type of message being supplied
+    /// \param pFormat the printf-style format string of the message; it is used after this returns, so it must be a string literal
+    /// \param args the numeric arguments of the format string, at most GPA_LOG_MAX_ARGS of them
+    template<typename... Args>
+    void LogFormat(GPA_Log_Debug_Type logType, const char* pFormat, Args... args)
+    {
+        static_assert(sizeof...(Args) <= GPA_LOG_MAX_ARGS, "Too many arguments for a deferred log message");
+
+        if (IsLogTypeEnabled(logType))
+        {
+            // one extra element, so that the array is not empty when there are no arguments
+            GPA_LogArg logArgs[sizeof...(Args) + 1] = { MakeLogArg(args)... };
+            Enqueue(logType, pFormat, logArgs, sizeof...(Args), nullptr);
+        }
+    }
+
     /// Logs an error message.
     /// \param pMessage the message to pass along
     inline void LogError(const char* pMessage)
@@ -98,6 +228,36 @@ public:
         Log(GPA_LOG_TRACE, pMessage);
     }
 
+    /// Logs an error message which is formatted on the logging thread.
+    /// \param pFormat the printf-style format string of the message, which must be a string literal
+    /// \param args the numeric arguments of the format string
+    template<typename... Args>
+    inline void LogErrorFormat(const char* pFormat, Args... args)
+    {
+        LogFormat(GPA_LOG_ERROR, pFormat, args...);
+    }
+
+    /// Logs an informational message which is formatted on the logging thread.
+    /// \param pFormat the printf-style format string of the message, which must be a string literal
+    /// \param args the numeric arguments of the format string
+    template<typename... Args>
+    inline void LogMessageFormat(const char* pFormat, Args... args)
+    {
+        LogFormat(GPA_LOG_MESSAGE, pFormat, args...);
+    }
+
+    /// Waits until the logging thread has passed every message logged so far to the callback function.
+    /// This does not wait when called from a callback function.
+    void Flush();
+
+    /// Passes the remaining messages along and stops the logging thread; later messages are passed along by the threads which log them.
+    /// GPA_Destroy calls this, because the destructor can't join the thread: it may run under the loader lock while the library is unloaded.
+    void StopLogging();
+
+    /// Gets the number of messages which were dropped because the ring was full.
+    /// \return the number of dropped messages since the logger was created
+    gpa_uint64 GetDroppedMessageCount() const;
+
     /// Logs a formatted message in internal builds; does nothing in release.
     /// \param pMsgFmt the message to format and pass along
     void LogDebugMessage(const char* pMsgFmt, ...)
@@ -108,8 +268,6 @@ public:
         // then pass the message along.
         if (GPA_LOG_DEBUG_MESSAGE & m_loggingDebugType)
         {
-            EnterCriticalSection(&m_hLock);
-
             // Format string
             char buffer[1024 * 50];
             va_list arglist;
@@ -122,8 +280,6 @@ public:
             va_end(arglist);
 
             Log(GPA_LOG_DEBUG_MESSAGE, buffer);
-
-            LeaveCriticalSection(&m_hLock);
         }
 
 #else
@@ -141,8 +297,6 @@ public:
         // then pass the message along.
         if (GPA_LOG_DEBUG_ERROR & m_loggingDebugType)
         {
-            EnterCriticalSection(&m_hLock);
-
             // Format string
             char buffer[1024 * 50];
             va_list arglist;
@@ -155,8 +309,6 @@ public:
             va_end(arglist);
 
             Log(GPA_LOG_DEBUG_ERROR, buffer);
-
-            LeaveCriticalSection(&m_hLock);
         }
 
 #else
@@ -175,8 +327,6 @@ public:
         // then pass the message along.
         if (GPA_LOG_DEBUG_TRACE & m_loggingDebugType)
         {
-            EnterCriticalSection(&m_hLock);
-
             // Format string
             char buffer[1024 * 50];
             va_list arglist;
@@ -189,8 +339,6 @@ public:
             va_end(arglist);
 
             Log(GPA_LOG_DEBUG_TRACE, buffer);
-
-            LeaveCriticalSection(&m_hLock);
         }
 
 #else
@@ -208,8 +356,6 @@ public:
         // then pass the message along.
         if (GPA_LOG_DEBUG_COUNTERDEFS & m_loggingDebugType)
         {
-            EnterCriticalSection(&m_hLock);
-
             // Format string
             char buffer[1024 * 50];
             va_list arglist;
@@ -222,8 +368,6 @@ public:
             va_end(arglist);
 
             Log(GPA_LOG_DEBUG_COUNTERDEFS, buffer);
-
-            LeaveCriticalSection(&m_hLock);
         }
 
 #else
@@ -233,26 +377,68 @@ public:
 
 protected:
 
+    /// Adds a message to the ring, dropping the oldest message if the ring is full.
+    /// \param logType the type of message
+    /// \param pFormat the format string of the message, or nullptr if pMessage holds the message
+    /// \param pArgs the arguments of pFormat
+    /// \param argCount the number of entries in pArgs
+    /// \param pMessage the message, if pFormat is nullptr
+    void Enqueue(GPA_Log_Debug_Type logType, const char* pFormat, const GPA_LogArg* pArgs, unsigned int argCount, const char* pMessage);
+
+    /// Removes the oldest message from the ring.
+    /// \param[out] pRecord will contain the message, and take ownership of a message stored out of line; or nullptr to discard it
+    /// \return true if a message was removed; false if the ring is empty
+    bool Dequeue(GPA_LogRecord* pRecord);
+
+    /// Formats a message and passes it to the callback function which accepts its type.
+    /// A message stored out of line is freed once it has been passed along.
+    /// \param record the message
+    void Deliver(GPA_LogRecord& record);
+
+    /// Starts the logging thread if it is not running. The caller must hold m_hLock.
+    void StartLoggingThread();
+
+    /// Passes the remaining messages along, then stops the logging thread. The caller must hold m_hLock.
+    void StopLoggingThread();
+
+    /// The entry point of the logging thread.
+    void LoggingThreadProc();
+
     /// User selected logging type that defines what messages they want to be notified of
-    GPA_Logging_Type m_loggingType;
+    std::atomic<int> m_loggingType;
 
     /// User-supplied callback function
-    GPA_LoggingCallbackPtrType m_loggingCallback;
+    std::atomic<GPA_LoggingCallbackPtrType> m_loggingCallback;
 
 #ifdef AMDT_INTERNAL
     /// User selected logging type that defines what debug messages they want to be notified of
-    GPA_Log_Debug_Type m_loggingDebugType;
+    std::atomic<int> m_loggingDebugType;
 
     /// User-supplied debug callback function
-    GPA_LoggingDebugCallbackPtrType m_loggingDebugCallback;
+    std::atomic<GPA_LoggingDebugCallbackPtrType> m_loggingDebugCallback;
 #endif // AMDT_INTERNAL
 
+    std::atomic<GPA_LogRecord*> m_pRing;             ///< The ring of messages waiting for the logging thread, allocated when the thread first starts
+    std::atomic<size_t> m_enqueuePosition;           ///< The ring position of the next message to add
+    std::atomic<size_t> m_dequeuePosition;           ///< The ring position of the oldest message
+    std::atomic<gpa_uint64> m_droppedMessageCount;   ///< The number of messages dropped because the ring was full
+    gpa_uint64 m_reportedDroppedMessageCount;        ///< The value of m_droppedMessageCount when the logging thread last reported it
+
+    std::thread m_loggingThread;                     ///< The thread which passes the messages to the callback functions
+    std::mutex m_loggingThreadMutex;                 ///< Protects the state shared with the logging thread
+    std::condition_variable m_loggingThreadCondition; ///< Wakes up the logging thread
+    std::condition_variable m_flushCondition;        ///< Wakes up the threads waiting in Flush
+    std::atomic<bool> m_isLoggingThreadRunning;      ///< Indicates that the logging thread has been started and not stopped
+    bool m_stopLoggingThread;                        ///< Tells the logging thread to exit once the ring is empty
+    std::atomic<bool> m_isLoggingThreadWaiting;      ///< Indicates that the logging thread is waiting for a message to be added
+    std::atomic<bool> m_isDelivering;                ///< Indicates that the logging thread is passing a message to a callback function
+
 #ifdef _WIN32
-    CRITICAL_SECTION m_hLock;  ///< lock for thread-safe access
+    CRITICAL_SECTION m_hLock;  ///< lock which serializes changes to the callback functions
 #endif
 
 #ifdef _LINUX
-    pthread_mutex_t m_hLock;   ///< lock for thread-safe access
+    pthread_mutex_t m_hLock;   ///< lock which serializes changes to the callback functions
 #endif
 };
 
@@ -268,6 +454,10 @@ extern GPALogger g_loggerSingleton;
 #define GPA_LogMessage g_loggerSingleton.LogMessage
 /// macro for logging of trace items
 #define GPA_LogTrace g_loggerSingleton.LogTrace
+/// macro for logging of errors which are formatted on the logging thread
+#define GPA_LogErrorFormat g_loggerSingleton.LogErrorFormat
+/// macro for logging of messages which are formatted on the logging thread
+#define GPA_LogMessageFormat g_loggerSingleton.LogMessageFormat
 
 /// macro for debug logging of messages
 #define GPA_LogDebugMessage g_loggerSingleton.LogDebugMessage
@@ -289,6 +479,23 @@ public:
     /// Destructor
     ~GPATracer() {}
 
+    /// Indicates whether trace messages are currently accepted by the user.
+    /// This is only a relaxed load of the logging type, so it is cheap enough to be checked on every traced call.
+    /// \return true if function calls should be traced; false otherwise
+    bool IsTracing() const
+    {
+#ifdef AMDT_INTERNAL
+
+        if (g_loggerSingleton.IsLogTypeEnabled(GPA_LOG_DEBUG_TRACE))
+        {
+            return true;
+        }
+
+#endif // AMDT_INTERNAL
+
+        return g_loggerSingleton.IsLogTypeEnabled(GPA_LOG_TRACE);
+    }
+
     /// Should be called when a function is entered.
     /// \param pFunctionName the function that is being entered
     void EnterFunction(const char* pFunctionName);
@@ -301,9 +508,6 @@ protected:
 
     /// Indicates whether to only show the top level of functions (true), or also show nested function calls (false).
     bool m_topLevelOnly;
-
-    /// Stores the number of tabs to indent nested function calls.
-    unsigned int m_logTab;
 };
 
 /// Singleton instance of the GPATracer class
@@ -312,20 +516,38 @@ extern GPATracer gTracerSingleton;
 /// Allows for easy tracing of exiting a function.
 /// Calls GPATracer::EnterFunction in the constructor
 /// and GPATracer::LeaveFunction in the destructor.
+/// Nothing beyond checking GPATracer::IsTracing is done when tracing is disabled.
 class ScopeTrace
 {
 public:
-    /// Constructor which calls GPATracer::EnterFunction.
+    /// Constructor which calls GPATracer::EnterFunction if tracing is enabled.
     /// \param pTraceFunction the function which is being traced.
-    ScopeTrace(const char* pTraceFunction);
+    ScopeTrace(const char* pTraceFunction)
+        : m_pTraceFunction(pTraceFunction),
+          m_isTracing(gTracerSingleton.IsTracing())
+    {
+        if (m_isTracing)
+        {
+            gTracerSingleton.EnterFunction(pTraceFunction);
+        }
+    }
 
-    /// Destructor which calls GPATracer::LeaveFunction.
-    ~ScopeTrace();
+    /// Destructor which calls GPATracer::LeaveFunction if the function was entered.
+    ~ScopeTrace()
+    {
+        if (m_isTracing)
+        {
+            gTracerSingleton.LeaveFunction(m_pTraceFunction);
+        }
+    }
 
 protected:
 
     /// Stores the function being traced.
     const char* m_pTraceFunction;
+
+    /// Indicates whether the function was entered, so that it is left even if tracing is disabled in the meantime.
+    bool m_isTracing;
 };
 
 #endif //GPA_LOGGING_H_
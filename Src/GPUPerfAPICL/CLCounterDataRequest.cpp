@@ -7,12 +7,15 @@
 
 #include <assert.h>
 #include <math.h>
+#include <chrono>
+#include <thread>
 #include <CL/cl.h>
 #include <CL/internal/cl_profile_amd.h>
 #include <map>
 #include <vector>
 #include "CLPerfCounterBlock.h"
 #include "CLPerfCounterAMDExtension.h"
+#include "CLRTModuleLoader.h"
 
 #include "CLCounterDataRequest.h"
 
@@ -60,9 +63,11 @@ void CLCounterDataRequest::ReleaseCounters()
 {
     TRACE_PRIVATE_FUNCTION(CLCounterDataRequest::ReleaseCounters);
 
+    // the CL perf counters are owned by this request, so they are kept for the next use of the same counter selection.
+    // they are released when the counter blocks are deleted.
     for (gpa_uint32 i = 0; i < m_clCounterBlocks.size(); ++i)
     {
-        m_clCounterBlocks[i]->ReleaseCounters();
+        m_clCounterBlocks[i]->ResetResults();
     }
 }
 
@@ -92,6 +97,12 @@ bool CLCounterDataRequest::CollectResults(GPA_CounterResults& resultStorage)
         return false;
     }
 
+    // the counter blocks wait on the event when they collect their data, so only collect once the event is complete
+    if (!IsEventComplete())
+    {
+        return false;
+    }
+
     // Get the data from opencl interface
     for (gpa_uint32 i = 0; i < m_clCounterBlocks.size(); ++i)
     {
@@ -131,6 +142,43 @@ bool CLCounterDataRequest::CollectResults(GPA_CounterResults& resultStorage)
 }
 
 
+bool CLCounterDataRequest::WaitForResults(gpa_uint32 timeoutMilliseconds)
+{
+    TRACE_PRIVATE_FUNCTION(CLCounterDataRequest::WaitForResults);
+
+    if (nullptr == m_clEvent)
+    {
+        // clEnqueueEndPerfCounterAMD() hasn't been called succesfully
+        return false;
+    }
+
+    // clWaitForEvents has no timeout, so poll the status of the event until it completes or the timeout elapses
+    std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMilliseconds);
+
+    while (!IsEventComplete() && std::chrono::steady_clock::now() < endTime)
+    {
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+
+bool CLCounterDataRequest::IsEventComplete() const
+{
+    cl_int executionStatus = CL_QUEUED;
+
+    if (CL_SUCCESS != OCLRTModuleLoader::Instance()->GetAPIRTModule()->GetEventInfo(m_clEvent, CL_EVENT_COMMAND_EXECUTION_STATUS, sizeof(executionStatus), &executionStatus, nullptr))
+    {
+        // let the counter blocks report the error when they collect their data
+        return true;
+    }
+
+    // a negative status is an error, which also ends the command
+    return CL_COMPLETE >= executionStatus;
+}
+
+
 void CLCounterDataRequest::Reset(gpa_uint32 uSelectionID, const vector<gpa_uint32>* pCounters)
 {
     TRACE_PRIVATE_FUNCTION(CLCounterDataRequest::Reset);
@@ -146,13 +194,13 @@ void CLCounterDataRequest::Reset(gpa_uint32 uSelectionID, const vector<gpa_uint3
     if (m_uCounterSelectionID != uSelectionID || m_activeCounters != uNewActiveCounters)
     {
         // release existing counters, cannot reuse
-        ReleaseCounters();
+        DeleteCounterBlocks();
+        m_pclCounters.clear();
 
         if (m_activeCounters != uNewActiveCounters)
         {
             // need to reallocate buffers
             delete[] m_counters;
-            DeleteCounterBlocks();
             m_clCounterBlocks.reserve(pHardwareCounters->m_groupCount);
 
             m_counters = new(std::nothrow) CLCounter[uNewActiveCounters];
@@ -163,7 +211,6 @@ void CLCounterDataRequest::Reset(gpa_uint32 uSelectionID, const vector<gpa_uint3
                 return;
             }
 
-            m_pclCounters.clear();
             m_pclCounters.reserve(pHardwareCounters->m_groupCount); // incorrect size but start with a reasonable number
         }
 
@@ -180,17 +227,13 @@ void CLCounterDataRequest::Reset(gpa_uint32 uSelectionID, const vector<gpa_uint3
     }
 
     m_uDataReadyCount = 0;
+    m_clEvent = nullptr;
 }
 
 
-bool CLCounterDataRequest::BeginRequest(GPA_ContextState* pContextState, gpa_uint32 selectionID, const vector<gpa_uint32>* pCounters)
+bool CLCounterDataRequest::CreateCounterBlocks(const vector<gpa_uint32>* pCounters)
 {
-    TRACE_PRIVATE_FUNCTION(CLCounterDataRequest::Begin);
-
-    UNREFERENCED_PARAMETER(pContextState);
-
-    // reset object since may be reused
-    Reset(selectionID, pCounters);
+    TRACE_PRIVATE_FUNCTION(CLCounterDataRequest::CreateCounterBlocks);
 
     GPA_HardwareCounters* pHardwareCounters = getCurrentContext()->m_pCounterAccessor->GetHardwareCounters();
 
@@ -231,7 +274,8 @@ bool CLCounterDataRequest::BeginRequest(GPA_ContextState* pContextState, gpa_uin
         if (nullptr == cBlock)
         {
             GPA_LogError("Unable to allocate memory for CL counter blocks");
-            Reset(selectionID, pCounters);
+            DeleteCounterBlocks();
+            m_pclCounters.clear();
             return false;
         }
 
@@ -248,6 +292,24 @@ bool CLCounterDataRequest::BeginRequest(GPA_ContextState* pContextState, gpa_uin
 
     assert(m_clCounterBlocks.size() == groupCounters.size());
 
+    return true;
+}
+
+
+bool CLCounterDataRequest::BeginRequest(GPA_ContextState* pContextState, gpa_uint32 selectionID, const vector<gpa_uint32>* pCounters)
+{
+    TRACE_PRIVATE_FUNCTION(CLCounterDataRequest::Begin);
+
+    UNREFERENCED_PARAMETER(pContextState);
+
+    // reset object since may be reused
+    Reset(selectionID, pCounters);
+
+    if (m_clCounterBlocks.empty() && !CreateCounterBlocks(pCounters))
+    {
+        return false;
+    }
+
     if (CL_SUCCESS != my_clEnqueueBeginPerfCounterAMD((cl_command_queue) getCurrentContext()->m_pContext,
                                                       (cl_uint) m_pclCounters.size(),
                                                       &m_pclCounters[0],
@@ -51,6 +51,11 @@ public:
     /// selected counters may not have changed, so can just use query resources again
     void Reset(gpa_uint32 selectionID, const vector<gpa_uint32>* pCounters);
 
+    /// Polls the event of clEnqueueEndPerfCounterAMD() until it is complete or the timeout elapses.
+    /// \param timeoutMilliseconds The maximum time to wait
+    /// \return true if the wait was performed, false if the counters have not been ended yet
+    virtual bool WaitForResults(gpa_uint32 timeoutMilliseconds);
+
 protected:
 
     virtual bool BeginRequest(GPA_ContextState* pContextState, gpa_uint32 selectionID, const vector<gpa_uint32>* pCounters);
@@ -58,6 +63,11 @@ protected:
     virtual bool CollectResults(GPA_CounterResults& resultStorage);
     virtual void ReleaseCounters();
 
+    /// Creates the counter blocks which enable the specified counters
+    /// \param pCounters the set of counters to enable
+    /// \return True if the counter blocks were created, false otherwise.
+    bool CreateCounterBlocks(const vector<gpa_uint32>* pCounters);
+
     /// Deletes counter block objects
     void DeleteCounterBlocks();
 
@@ -67,6 +77,10 @@ protected:
     /// \return True if the group was found, false otherwise.
     bool FindBlockID(gpa_uint32& uBlockID, gpa_uint32 uGroupID);
 
+    /// Checks whether the command of m_clEvent has finished, without blocking
+    /// \return True if the command completed or failed, false if it is still queued or running.
+    bool IsEventComplete() const;
+
     gpa_uint32 m_uCounterSelectionID;   ///< the id of the set of active counters
     CLCounter* m_counters;              ///< store the counters' data
 
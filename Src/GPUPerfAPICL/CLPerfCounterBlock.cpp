@@ -48,6 +48,12 @@ void clPerfCounterBlock::ReleaseCounters()
     }
 }
 
+void clPerfCounterBlock::ResetResults()
+{
+    m_results.clear();
+    m_isResultReady = false;
+}
+
 void clPerfCounterBlock::Create()
 {
     if (m_pCounters.empty())
@@ -47,6 +47,9 @@ public:
     /// Release the counters that were created in the CL runtime
     void ReleaseCounters();
 
+    /// Clears the collected results so that the counters can be used again
+    void ResetResults();
+
     /// Collect data from the HW performance counters
     /// \param clEvent  event to synchronize the result (this should be the event from clEnqueueEndPerfCounterAMD())
     /// \return true if successfull, false otherwise
@@ -22,6 +22,13 @@ public:
     {
     }
 
+    /// OpenCL calls can be made from any thread, so the results can be collected in the background.
+    /// \return true
+    virtual bool SupportsBackgroundResultCollection() const
+    {
+        return true;
+    }
+
     /// The OpenCL device ID
     cl_device_id m_clDevice;
 };
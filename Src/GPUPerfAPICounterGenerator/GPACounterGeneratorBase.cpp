@@ -14,7 +14,8 @@
 GPA_CounterGeneratorBase::GPA_CounterGeneratorBase()
     :   m_doAllowPublicCounters(false),
         m_doAllowHardwareCounters(false),
-        m_doAllowSoftwareCounters(false)
+        m_doAllowSoftwareCounters(false),
+        m_generatedGeneration(GDT_HW_GENERATION_NONE)
 {
 }
 
@@ -24,11 +25,20 @@ GPA_CounterGeneratorBase::~GPA_CounterGeneratorBase()
 
 GPA_Status GPA_CounterGeneratorBase::GenerateCounters(GDT_HW_GENERATION desiredGeneration)
 {
+    // the counters of a generation do not change, and the contexts which are already open keep using them
+    if (GDT_HW_GENERATION_NONE != desiredGeneration && desiredGeneration == m_generatedGeneration)
+    {
+        return GPA_STATUS_OK;
+    }
+
     GPA_Status status = GPA_STATUS_ERROR_NOT_ENABLED;
 
+    m_generatedGeneration = GDT_HW_GENERATION_NONE;
     m_publicCounters.Clear();
     m_hardwareCounters.Clear();
     m_softwareCounters.Clear();
+    m_counterNameHash.Clear();
+    m_counterGroupAccessor = GPACounterGroupAccessor();
 
     if (m_doAllowPublicCounters)
     {
@@ -64,15 +74,47 @@ GPA_Status GPA_CounterGeneratorBase::GenerateCounters(GDT_HW_GENERATION desiredG
 
 #endif  // WIN32
 
+    m_counterGroupAccessor = GPACounterGroupAccessor(m_hardwareCounters.m_pGroups,
+                                                     m_hardwareCounters.m_groupCount,
+                                                     m_hardwareCounters.m_pAdditionalGroups,
+                                                     m_hardwareCounters.m_additionalGroupCount,
+                                                     m_softwareCounters.m_pGroups,
+                                                     m_softwareCounters.m_groupCount);
+
     if (0 == GetNumCounters())
     {
         // no counters reported, return hardware not supported
         status = GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED;
     }
 
+    if (GPA_STATUS_OK == status)
+    {
+        // the names come from the counter tables rather than from the descriptors generated on demand,
+        // so the hash can be built now and lookups by name only read it
+        BuildCounterNameHash();
+        m_generatedGeneration = desiredGeneration;
+    }
+
     return status;
 }
 
+void GPA_CounterGeneratorBase::BuildCounterNameHash()
+{
+    gpa_uint32 numCounters = GetNumCounters();
+    std::vector<const char*> names(numCounters);
+
+    for (gpa_uint32 i = 0; i < numCounters; i++)
+    {
+        names[i] = GetCounterName(i);
+    }
+
+    if (!m_counterNameHash.Build(names.data(), numCounters))
+    {
+        // GetCounterIndex falls back to a linear search
+        m_counterNameHash.Clear();
+    }
+}
+
 gpa_uint32 GPA_CounterGeneratorBase::GetNumCounters()
 {
     gpa_uint32 count = 0;
@@ -155,45 +197,31 @@ const char* GPA_CounterGeneratorBase::GetCounterName(gpa_uint32 index)
 
 bool GPA_CounterGeneratorBase::GetCounterIndex(const char* pName, gpa_uint32* pIndex)
 {
+    if (nullptr == pName || nullptr == pIndex)
+    {
+        return false;
+    }
 
-    bool retVal = false;
+    gpa_uint32 numCounters = GetNumCounters();
 
-    if (nullptr != pIndex)
+    if (0 != numCounters && m_counterNameHash.GetNumNames() == numCounters)
     {
-        CounterNameIndexMap::iterator it = m_counterIndexCache.find(pName);
-        if (m_counterIndexCache.end() != it)
-        {
-            *pIndex = m_counterIndexCache[pName];
-            retVal = ms_COUNTER_NOT_FOUND != *pIndex;
-        }
+        return m_counterNameHash.Find(pName, pIndex);
     }
 
-    if (!retVal)
+    // the hash was not built for the current set of counters
+    for (gpa_uint32 i = 0; i < numCounters; i++)
     {
-        gpa_uint32 numCounters = GetNumCounters();
+        const char* pCounterName = GetCounterName(i);
 
-        for (gpa_uint32 i = 0; i < numCounters; i++)
+        if (nullptr != pCounterName && 0 == _strcmpi(pName, pCounterName))
         {
-            const char* pCounterName = GetCounterName(i);
-
-            if (0 == _strcmpi(pName, pCounterName))
-            {
-                m_counterIndexCache[pName] = i;
-                *pIndex = i;
-                retVal = true;
-                break;
-            }
+            *pIndex = i;
+            return true;
         }
     }
 
-    if (!retVal)
-    {
-        // cache the fact that it wasn't found
-        m_counterIndexCache[pName] = ms_COUNTER_NOT_FOUND;
-    }
-
-    return retVal;
-
+    return false;
 }
 
 const char* GPA_CounterGeneratorBase::GetCounterDescription(gpa_uint32 index)
@@ -348,7 +376,7 @@ const GPA_PublicCounter* GPA_CounterGeneratorBase::GetPublicCounter(gpa_uint32 i
 
 GPA_HardwareCounterDescExt* GPA_CounterGeneratorBase::GetHardwareCounterExt(gpa_uint32 index)
 {
-    return &(m_hardwareCounters.m_counters[index]);
+    return m_hardwareCounters.GetCounter(index);
 }
 
 gpa_uint32 GPA_CounterGeneratorBase::GetNumPublicCounters()
@@ -403,6 +431,11 @@ vector<gpa_uint32> GPA_CounterGeneratorBase::GetInternalCountersRequired(gpa_uin
     return vecInternalCounters;
 }
 
+void GPA_CounterGeneratorBase::ExpandPublicCounters()
+{
+    m_publicCounters.ExpandCounters();
+}
+
 void GPA_CounterGeneratorBase::ComputePublicCounterValue(gpa_uint32 counterIndex, vector<char*>& results, vector<GPA_Type>& internalCounterTypes, void* pResult, GPA_HWInfo* pHwInfo)
 {
     m_publicCounters.ComputeCounterValue(counterIndex, results, internalCounterTypes, pResult, pHwInfo);
@@ -430,6 +463,11 @@ GPA_SoftwareCounters* GPA_CounterGeneratorBase::GetSoftwareCounters()
     return &m_softwareCounters;
 }
 
+const IGPACounterAccessor* GPA_CounterGeneratorBase::GetCounterGroupAccessor() const
+{
+    return (const IGPACounterAccessor*)&m_counterGroupAccessor;
+}
+
 GPACounterTypeInfo GPA_CounterGeneratorBase::GetCounterTypeInfo(gpa_uint32 globalIndex)
 {
     if (m_doAllowPublicCounters)
@@ -487,4 +525,7 @@ void GPA_CounterGeneratorBase::SetAllowedCounters(bool bAllowPublicCounters, boo
 #endif
 
     m_doAllowSoftwareCounters = bAllowSoftwareCounters;
+
+    // the counters have to be generated again for the allowed counters
+    m_generatedGeneration = GDT_HW_GENERATION_NONE;
 }
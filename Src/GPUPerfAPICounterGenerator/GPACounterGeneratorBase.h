@@ -8,11 +8,10 @@
 #ifndef _GPA_COUNTER_GENERATOR_BASE_H_
 #define _GPA_COUNTER_GENERATOR_BASE_H_
 
-#include <unordered_map>
-
 #include "GPAHardwareCounters.h"
 #include "GPASoftwareCounters.h"
 #include "GPAICounterAccessor.h"
+#include "GPACounterNameHash.h"
 
 /// Base class for counter generation
 class GPA_CounterGeneratorBase : public GPA_ICounterAccessor
@@ -34,12 +33,14 @@ public:
     virtual GPA_HardwareCounterDescExt* GetHardwareCounterExt(gpa_uint32 index);
     virtual gpa_uint32 GetNumPublicCounters();
     virtual vector<gpa_uint32> GetInternalCountersRequired(gpa_uint32 index);
+    virtual void ExpandPublicCounters();
     virtual void ComputePublicCounterValue(gpa_uint32 counterIndex, std::vector<char*>& results, std::vector<GPA_Type>& internalCounterTypes, void* pResult, GPA_HWInfo* pHwInfo);
     virtual GPACounterTypeInfo GetCounterTypeInfo(gpa_uint32 globalIndex);
     virtual bool GetCounterIndex(const char* pName, gpa_uint32* pIndex);
     // end Implementation of GPA_ICounterAccessor
 
     /// Generate the counters for the specified generation
+    /// The counters are only generated again if they were generated for another generation, so that the contexts which are already open can keep using them.
     /// \param desiredGeneration the generation whose counters are needed
     /// \return GPA_STATUS_OK on success
     GPA_Status GenerateCounters(GDT_HW_GENERATION desiredGeneration);
@@ -63,6 +64,11 @@ public:
     /// \return the software counters
     GPA_SoftwareCounters* GetSoftwareCounters();
 
+    /// Get the accessor that resolves an internal counter index to its group and counter
+    /// The accessor is built once when the counters are generated, and is not modified by lookups.
+    /// \return the counter group accessor for the generated hardware and software counters
+    const IGPACounterAccessor* GetCounterGroupAccessor() const;
+
     /// Generate the public counters for the specified hardware generation
     /// \param desiredGeneration the generation whose counters are needed
     /// \param[out] pPublicCounters the generated counters
@@ -97,9 +103,14 @@ private:
     bool m_doAllowHardwareCounters; ///< flag indicating whether or not hardware counters are allowed
     bool m_doAllowSoftwareCounters; ///< flag indicating whether or not software counters are allowed
 
-    typedef std::unordered_map<std::string, gpa_uint32> CounterNameIndexMap;    ///< typedef for an unordered_map from counter name to index
-    static const gpa_uint32 ms_COUNTER_NOT_FOUND = static_cast<gpa_uint32>(-1); ///< const indicating that a counter was not found
-    CounterNameIndexMap m_counterIndexCache;                                    ///< cache of counter indexes, so we don't have to look up a counter more than once (it can be expensive)
+    GDT_HW_GENERATION m_generatedGeneration; ///< the generation the counters were generated for, or GDT_HW_GENERATION_NONE if they need to be generated
+
+    /// Build the counter name hash from the generated counters
+    void BuildCounterNameHash();
+
+    GPA_CounterNameHash m_counterNameHash; ///< perfect hash from counter name to index, built when the counters are generated
+
+    GPACounterGroupAccessor m_counterGroupAccessor; ///< group and counter lookup for the generated hardware and software counters
 };
 
 #endif //_GPA_COUNTER_GENERATOR_BASE_H_
@@ -82,68 +82,47 @@ GPA_Status GPA_CounterGeneratorHSA::GenerateHardwareCounters(GDT_HW_GENERATION d
         return GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED;
     }
 
-    // need to count total number of internal counters, since split into groups
+    // the counter descriptors are generated per group when they are first accessed
     if (!pHardwareCounters->m_countersGenerated)
     {
-        pHardwareCounters->m_counters.clear();
-
-        GPA_HardwareCounterDescExt counter;
 #if defined(_DEBUG) && defined(_WIN32) && defined(AMDT_INTERNAL)
         // Debug builds will generate a file that lists the counter names in a format that can be
         // easily copy/pasted into the GPUPerfAPIUnitTests project
         FILE* pFile = nullptr;
         fopen_s(&pFile, "HardwareCounterNamesHSA.txt", "w");
-#endif
 
-        for (gpa_uint32 i = 0; i < pHardwareCounters->m_groupCount; i++)
+        if (nullptr != pFile)
         {
-            // for each group
-            GPA_HardwareCounterDesc* pGroup = (*(pHardwareCounters->m_ppCounterGroupArray + i));
-
-            const int numGroupCounters = (int)pHardwareCounters->m_pGroups[i].m_numCounters;
-
-            for (int j = 0; j < numGroupCounters; j++)
+            for (gpa_uint32 i = 0; i < pHardwareCounters->m_groupCount; i++)
             {
-                // for each internal counter
-                counter.m_pHardwareCounter = &(pGroup[j]);
-                counter.m_groupIndex      = i;
-                counter.m_groupIdDriver = i;
-                counter.m_counterIdDriver = 0;
-
-#if defined(_DEBUG) && defined(_WIN32) && defined(AMDT_INTERNAL)
+                GPA_HardwareCounterDesc* pGroup = (*(pHardwareCounters->m_ppCounterGroupArray + i));
+                const int numGroupCounters = (int)pHardwareCounters->m_pGroups[i].m_numCounters;
 
-                if (nullptr != pFile)
+                for (int j = 0; j < numGroupCounters; j++)
                 {
                     fwrite("    \"", 1, 5, pFile);
-                    std::string tmpName(counter.m_pHardwareCounter->m_pName);
+                    std::string tmpName(pGroup[j].m_pName);
                     size_t size = tmpName.size();
-                    fwrite(counter.m_pHardwareCounter->m_pName, 1, size, pFile);
+                    fwrite(pGroup[j].m_pName, 1, size, pFile);
                     fwrite("\",", 1, 2, pFile);
 #ifdef EXTRA_COUNTER_INFO
                     // this can be useful for debugging counter definitions
                     std::stringstream ss;
-                    ss << " " << counter.m_groupIndex << ", " << counter.m_groupIdDriver << ", " << counter.m_pHardwareCounter->m_counterIndexInGroup << ", " << counter.m_counterIdDriver;
+                    ss << " " << i << ", " << i << ", " << pGroup[j].m_counterIndexInGroup << ", " << 0;
                     std::string tmpCounterInfo(ss.str());
                     size = tmpCounterInfo.size();
                     fwrite(tmpCounterInfo.c_str(), 1, size, pFile);
 #endif
                     fwrite("\n", 1, 1, pFile);
                 }
-
-#endif
-                pHardwareCounters->m_counters.push_back(counter);
             }
-        }
 
-#if defined(_DEBUG) && defined(_WIN32) && defined(AMDT_INTERNAL)
-
-        if (nullptr != pFile)
-        {
             fclose(pFile);
         }
 
 #endif
 
+        pHardwareCounters->DeferCounterGeneration();
         pHardwareCounters->m_countersGenerated = true;
     }
 
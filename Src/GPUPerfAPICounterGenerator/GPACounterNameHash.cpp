@@ -0,0 +1,221 @@
+//==============================================================================
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief Case-insensitive minimal perfect hash over counter names
+//==============================================================================
+
+#include <algorithm>
+#include <string.h>
+
+#include "GPACounterNameHash.h"
+
+static const gpa_uint32 s_namesPerBucket = 4;            ///< average number of names in a bucket
+static const gpa_uint32 s_maxDisplacement = 1 << 20;     ///< number of displacements tried for a bucket before the build gives up
+
+/// A counter name while the table is being built
+struct GPA_CounterNameHashEntry
+{
+    gpa_uint64  m_hash;     ///< hash of the name
+    gpa_uint32  m_bucket;   ///< bucket of the name
+    const char* m_pName;    ///< the name
+    gpa_uint32  m_index;    ///< counter index of the name
+};
+
+GPA_CounterNameHash::GPA_CounterNameHash()
+    : m_numNames(0)
+{
+}
+
+gpa_uint64 GPA_CounterNameHash::HashName(const char* pName)
+{
+    // 64-bit FNV-1a of the lower case name
+    gpa_uint64 hash = 14695981039346656037ULL;
+
+    for (const char* pChar = pName; '\0' != *pChar; ++pChar)
+    {
+        char c = *pChar;
+
+        if ('A' <= c && 'Z' >= c)
+        {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+gpa_uint32 GPA_CounterNameHash::GetSlot(gpa_uint64 hash, gpa_uint32 displacement, gpa_uint32 numSlots)
+{
+    // mix the displaced hash so that each displacement gives an unrelated slot
+    gpa_uint64 value = hash + displacement * 0x9E3779B97F4A7C15ULL;
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ULL;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBULL;
+    value ^= value >> 31;
+
+    return static_cast<gpa_uint32>(value % numSlots);
+}
+
+bool GPA_CounterNameHash::Build(const char* const* ppNames, gpa_uint32 numNames)
+{
+    Clear();
+
+    std::vector<GPA_CounterNameHashEntry> entries;
+    entries.reserve(numNames);
+
+    for (gpa_uint32 i = 0; i < numNames; i++)
+    {
+        if (nullptr != ppNames[i])
+        {
+            GPA_CounterNameHashEntry entry = { HashName(ppNames[i]), 0, ppNames[i], i };
+            entries.push_back(entry);
+        }
+    }
+
+    // drop names that differ only in case, keeping the lowest index (as a linear search would find)
+    std::sort(entries.begin(), entries.end(), [](const GPA_CounterNameHashEntry & a, const GPA_CounterNameHashEntry & b)
+    {
+        return a.m_hash != b.m_hash ? a.m_hash < b.m_hash : a.m_index < b.m_index;
+    });
+
+    size_t numUnique = 0;
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        bool isDuplicate = false;
+
+        for (size_t j = numUnique; j > 0 && entries[j - 1].m_hash == entries[i].m_hash; j--)
+        {
+            if (0 == _strcmpi(entries[j - 1].m_pName, entries[i].m_pName))
+            {
+                isDuplicate = true;
+                break;
+            }
+        }
+
+        if (!isDuplicate)
+        {
+            entries[numUnique++] = entries[i];
+        }
+    }
+
+    entries.resize(numUnique);
+
+    if (entries.empty())
+    {
+        m_numNames = numNames;
+        return true;
+    }
+
+    gpa_uint32 numSlots = static_cast<gpa_uint32>(entries.size());
+    gpa_uint32 numBuckets = (numSlots + s_namesPerBucket - 1) / s_namesPerBucket;
+
+    // group the names by bucket, and place the largest buckets first while most slots are still free
+    std::vector<gpa_uint32> bucketSizes(numBuckets, 0);
+
+    for (std::vector<GPA_CounterNameHashEntry>::iterator it = entries.begin(); it != entries.end(); ++it)
+    {
+        it->m_bucket = static_cast<gpa_uint32>((it->m_hash >> 32) % numBuckets);
+        bucketSizes[it->m_bucket]++;
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), [&bucketSizes](const GPA_CounterNameHashEntry & a, const GPA_CounterNameHashEntry & b)
+    {
+        return bucketSizes[a.m_bucket] != bucketSizes[b.m_bucket] ? bucketSizes[a.m_bucket] > bucketSizes[b.m_bucket] : a.m_bucket < b.m_bucket;
+    });
+
+    std::vector<gpa_uint32> displacements(numBuckets, 0);
+    std::vector<Slot> slots(numSlots);
+    std::vector<bool> isSlotUsed(numSlots, false);
+    std::vector<gpa_uint32> bucketSlots;
+
+    for (size_t bucketStart = 0; bucketStart < entries.size();)
+    {
+        gpa_uint32 bucket = entries[bucketStart].m_bucket;
+        size_t bucketEnd = bucketStart + bucketSizes[bucket];
+        bool placed = false;
+
+        for (gpa_uint32 displacement = 0; displacement < s_maxDisplacement && !placed; displacement++)
+        {
+            bucketSlots.clear();
+            placed = true;
+
+            for (size_t i = bucketStart; i < bucketEnd; i++)
+            {
+                gpa_uint32 slot = GetSlot(entries[i].m_hash, displacement, numSlots);
+
+                if (isSlotUsed[slot] || bucketSlots.end() != std::find(bucketSlots.begin(), bucketSlots.end(), slot))
+                {
+                    placed = false;
+                    break;
+                }
+
+                bucketSlots.push_back(slot);
+            }
+
+            if (placed)
+            {
+                displacements[bucket] = displacement;
+
+                for (size_t i = bucketStart; i < bucketEnd; i++)
+                {
+                    gpa_uint32 slot = bucketSlots[i - bucketStart];
+                    isSlotUsed[slot] = true;
+                    slots[slot].m_pName = entries[i].m_pName;
+                    slots[slot].m_index = entries[i].m_index;
+                }
+            }
+        }
+
+        if (!placed)
+        {
+            // only happens if two different names have the same 64-bit hash
+            return false;
+        }
+
+        bucketStart = bucketEnd;
+    }
+
+    m_displacements.swap(displacements);
+    m_slots.swap(slots);
+    m_numNames = numNames;
+
+    return true;
+}
+
+void GPA_CounterNameHash::Clear()
+{
+    m_displacements.clear();
+    m_slots.clear();
+    m_numNames = 0;
+}
+
+bool GPA_CounterNameHash::Find(const char* pName, gpa_uint32* pIndex) const
+{
+    if (nullptr == pName || nullptr == pIndex || m_slots.empty())
+    {
+        return false;
+    }
+
+    gpa_uint64 hash = HashName(pName);
+    gpa_uint32 bucket = static_cast<gpa_uint32>((hash >> 32) % m_displacements.size());
+    const Slot& slot = m_slots[GetSlot(hash, m_displacements[bucket], static_cast<gpa_uint32>(m_slots.size()))];
+
+    if (0 != _strcmpi(slot.m_pName, pName))
+    {
+        return false;
+    }
+
+    *pIndex = slot.m_index;
+    return true;
+}
+
+gpa_uint32 GPA_CounterNameHash::GetNumNames() const
+{
+    return m_numNames;
+}
@@ -0,0 +1,73 @@
+//==============================================================================
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief Case-insensitive minimal perfect hash over counter names
+//==============================================================================
+
+#ifndef _GPA_COUNTER_NAME_HASH_H_
+#define _GPA_COUNTER_NAME_HASH_H_
+
+#include <vector>
+
+#include "GPUPerfAPITypes.h"
+
+/// Case-insensitive minimal perfect hash from counter name to counter index.
+///
+/// The table is built once from the full list of counter names (hash-and-displace: names are
+/// grouped into buckets, and each bucket gets a displacement that places all of its names in
+/// free slots). A lookup is then one hash of the name, one displacement and one string compare,
+/// and never allocates. Names are not copied, so they must outlive the table.
+class GPA_CounterNameHash
+{
+public:
+    /// Constructor
+    GPA_CounterNameHash();
+
+    /// Build the table from a list of counter names
+    /// If a name appears more than once (ignoring case), the lowest index is the one that is found.
+    /// \param ppNames the counter names; the index of a name in this list is its counter index
+    /// \param numNames the number of names in ppNames
+    /// \return true if the table was built, false if no displacement could be found for a bucket (the table is left empty)
+    bool Build(const char* const* ppNames, gpa_uint32 numNames);
+
+    /// Empty the table
+    void Clear();
+
+    /// Look up the index of a counter name (case insensitive)
+    /// \param pName the name of the counter
+    /// \param[out] pIndex the index of the counter, if it was found
+    /// \return true if the counter was found
+    bool Find(const char* pName, gpa_uint32* pIndex) const;
+
+    /// Get the number of counter names the table was built from
+    /// \return the number of counter names, or 0 if the table is empty
+    gpa_uint32 GetNumNames() const;
+
+private:
+
+    /// A slot of the table
+    struct Slot
+    {
+        const char* m_pName;  ///< the counter name
+        gpa_uint32  m_index;  ///< the counter index
+    };
+
+    /// Hash a counter name, ignoring case
+    /// \param pName the name to hash
+    /// \return the hash of the name
+    static gpa_uint64 HashName(const char* pName);
+
+    /// Get the slot of a name hash for a bucket displacement
+    /// \param hash the hash of the name
+    /// \param displacement the displacement of the name's bucket
+    /// \param numSlots the number of slots in the table
+    /// \return the slot index
+    static gpa_uint32 GetSlot(gpa_uint64 hash, gpa_uint32 displacement, gpa_uint32 numSlots);
+
+    std::vector<gpa_uint32> m_displacements; ///< displacement of each bucket
+    std::vector<Slot>       m_slots;         ///< one slot per distinct counter name
+    gpa_uint32              m_numNames;      ///< number of names the table was built from
+};
+
+#endif //_GPA_COUNTER_NAME_HASH_H_
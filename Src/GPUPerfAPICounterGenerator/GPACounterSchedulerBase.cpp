@@ -12,12 +12,58 @@
 #include <sstream>
 #include <vector>
 #include <list>
+#include <algorithm>
+#include <iterator>
 #include <DeviceInfoUtils.h>
 
+/// Adds a value to a 64-bit FNV-1a hash
+/// \param hash the hash to update
+/// \param value the value to add
+static void HashValue(gpa_uint64& hash, gpa_uint32 value)
+{
+    static const gpa_uint64 s_fnvPrime = 1099511628211ULL;
+
+    for (unsigned int i = 0; i < sizeof(value); i++)
+    {
+        hash ^= (value >> (i * 8)) & 0xFF;
+        hash *= s_fnvPrime;
+    }
+}
+
+/// Computes the hash a pass plan is looked up by in the pass plan cache
+/// \param vendorId the vendor id the plan is for
+/// \param deviceId the device id the plan is for
+/// \param revisionId the revision id the plan is for
+/// \param algorithm the splitting algorithm the plan is computed with
+/// \param sortedCounterIndices the counters in the plan, sorted by index
+/// \return the hash of the plan
+static gpa_uint64 HashPassPlan(gpa_uint32 vendorId, gpa_uint32 deviceId, gpa_uint32 revisionId, GPACounterSplitterAlgorithm algorithm, const std::vector<gpa_uint32>& sortedCounterIndices)
+{
+    gpa_uint64 hash = 14695981039346656037ULL;
+    HashValue(hash, vendorId);
+    HashValue(hash, deviceId);
+    HashValue(hash, revisionId);
+    HashValue(hash, static_cast<gpa_uint32>(algorithm));
+
+    for (std::vector<gpa_uint32>::const_iterator it = sortedCounterIndices.begin(); it != sortedCounterIndices.end(); ++it)
+    {
+        HashValue(hash, *it);
+    }
+
+    return hash;
+}
+
 GPA_CounterSchedulerBase::GPA_CounterSchedulerBase()
     : m_counterSelectionChanged(false),
+      m_passesChanged(false),
       m_pCounterAccessor(nullptr),
-      m_passIndex(0)
+      m_passIndex(0),
+      m_passPlanCacheHits(0),
+      m_passPlanCacheMisses(0),
+      m_minimizePasses(false),
+      m_hasPassPlan(false),
+      m_scheduledAlgorithm(CONSOLIDATED),
+      m_fullSplitRequested(false)
 {
 }
 
@@ -31,6 +77,12 @@ void GPA_CounterSchedulerBase::Reset()
     m_passIndex = 0;
     m_pCounterAccessor = nullptr;
     m_counterSelectionChanged = false;
+    m_passesChanged = false;
+    m_minimizePasses = false;
+    m_hasPassPlan = false;
+    m_fullSplitRequested = false;
+    m_gatherEntries.clear();
+    m_gatherPlans.clear();
 }
 
 GPA_Status GPA_CounterSchedulerBase::SetCounterAccessor(GPA_ICounterAccessor* pCounterAccessor, gpa_uint32 vendorId, gpa_uint32 deviceId, gpa_uint32 revisionId)
@@ -46,6 +98,11 @@ GPA_Status GPA_CounterSchedulerBase::SetCounterAccessor(GPA_ICounterAccessor* pC
     m_deviceId = deviceId;
     m_revisionId = revisionId;
 
+    // the counters may have been generated again, so the current passes cannot be updated
+    m_hasPassPlan = false;
+    m_gatherEntries.clear();
+    m_gatherPlans.clear();
+
     // make sure there are enough bits to track the enabled counters
     m_enabledPublicCounterBits.resize(pCounterAccessor->GetNumCounters());
     fill(m_enabledPublicCounterBits.begin(), m_enabledPublicCounterBits.end(), false);
@@ -134,9 +191,7 @@ GPA_Status GPA_CounterSchedulerBase::IsCounterEnabled(gpa_uint32 counterIndex)
 {
     if (counterIndex >= m_enabledPublicCounterBits.size())
     {
-        std::stringstream message;
-        message << "Parameter 'counterIndex' is " << counterIndex << " but must be less than the number of enabled counters (" << m_enabledPublicCounterBits.size() << ").";
-        GPA_LogError(message.str().c_str());
+        GPA_LogErrorFormat("Parameter 'counterIndex' is %u but must be less than the number of enabled counters (%u).", counterIndex, static_cast<gpa_uint32>(m_enabledPublicCounterBits.size()));
         return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
     }
 
@@ -146,9 +201,8 @@ GPA_Status GPA_CounterSchedulerBase::IsCounterEnabled(gpa_uint32 counterIndex)
     }
     else
     {
-        std::stringstream message;
-        message << "Parameter 'counterIndex' (" << counterIndex << ") is not an enabled counter.";
-        GPA_LogMessage(message.str().c_str());
+        // this is checked for every result read, so the message is only formatted if the user wants it
+        GPA_LogMessageFormat("Parameter 'counterIndex' (%u) is not an enabled counter.", counterIndex);
         return GPA_STATUS_ERROR_NOT_FOUND;
     }
 
@@ -191,13 +245,394 @@ GPA_Status GPA_CounterSchedulerBase::GetNumRequiredPasses(gpa_uint32* pNumRequir
         return GPA_STATUS_OK;
     }
 
+    if (nullptr == m_pCounterAccessor)
+    {
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    // the plan only depends on the device and on the set of enabled counters, not on the order in which they were enabled
+    std::vector<gpa_uint32> sortedEnabledIndices(m_enabledPublicIndices);
+    std::sort(sortedEnabledIndices.begin(), sortedEnabledIndices.end());
+
+    GPACounterSplitterAlgorithm algorithm = GetSplittingAlgorithm();
+    gpa_uint64 hash = HashPassPlan(m_vendorId, m_deviceId, m_revisionId, algorithm, sortedEnabledIndices);
+
+    // the current passes are kept when the same counters are enabled again, whether they were split or updated
+    bool isCurrentPassPlan = m_hasPassPlan && !m_fullSplitRequested && algorithm == m_scheduledAlgorithm && sortedEnabledIndices == m_scheduledIndices;
+
+    if (isCurrentPassPlan || (!m_fullSplitRequested && UseCachedPassPlan(hash, algorithm, sortedEnabledIndices)))
+    {
+        if (!isCurrentPassPlan)
+        {
+            m_passesChanged = true;
+        }
+
+        m_hasPassPlan = true;
+        m_scheduledIndices = sortedEnabledIndices;
+        m_scheduledAlgorithm = algorithm;
+        BuildCounterGatherPlans();
+        m_counterSelectionChanged = false;
+        *pNumRequiredPassesOut = (gpa_uint32)m_passPartitions.size();
+        return GPA_STATUS_OK;
+    }
+
+    std::vector<unsigned int> maxCountersPerGroup;
+    IGPASplitCounters* pSplitter = CreateCounterSplitter(algorithm, maxCountersPerGroup);
+
+    if (nullptr == pSplitter)
+    {
+        GPA_LogError("Failed to create a counter splitting algorithm.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
     GPA_CounterGeneratorBase* pGenerator = reinterpret_cast<GPA_CounterGeneratorBase*>(m_pCounterAccessor);
+    const IGPACounterAccessor* pGroupAccessor = pGenerator->GetCounterGroupAccessor();
+
+    // updated passes depend on the selections they were updated from, so only the passes of a full split are cached for this selection
+    bool isFullSplit = !UpdatePassPlan(pSplitter, algorithm, sortedEnabledIndices, pGroupAccessor, maxCountersPerGroup);
+
+    if (isFullSplit)
+    {
+        GPA_Status status = SplitCounters(pSplitter, m_enabledPublicIndices, pGroupAccessor, maxCountersPerGroup, m_passPartitions);
+
+        if (GPA_STATUS_OK != status)
+        {
+            delete pSplitter;
+            return status;
+        }
+
+        m_counterResultLocationMap = pSplitter->GetCounterResultLocations();
+        m_fullSplitRequested = false;
+    }
+
+    delete pSplitter;
+    pSplitter = nullptr;
+
+    m_passesChanged = true;
+    m_hasPassPlan = true;
+    m_scheduledIndices = sortedEnabledIndices;
+    m_scheduledAlgorithm = algorithm;
+
+    if (isFullSplit)
+    {
+        CachePassPlan(hash, algorithm, sortedEnabledIndices);
+    }
 
-    if (nullptr == pGenerator)
+    BuildCounterGatherPlans();
+
+    m_counterSelectionChanged = false;
+    *pNumRequiredPassesOut = (gpa_uint32)m_passPartitions.size();
+
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_CounterSchedulerBase::GetNumRequiredPassesForCounters(const gpa_uint32* pCounterIndices, gpa_uint32 counterCount, gpa_uint32* pNumRequiredPassesOut)
+{
+    if (nullptr == m_pCounterAccessor)
     {
         return GPA_STATUS_ERROR_FAILED;
     }
 
+    // the counters are split in the order given, skipping repeated counters, like enabling them one after another would
+    gpa_uint32 numCounters = m_pCounterAccessor->GetNumCounters();
+    std::vector<bool> candidateCounterBits(numCounters, false);
+    std::vector<gpa_uint32> candidateIndices;
+    candidateIndices.reserve(counterCount);
+
+    for (gpa_uint32 i = 0; i < counterCount; i++)
+    {
+        if (pCounterIndices[i] >= numCounters)
+        {
+            std::stringstream message;
+            message << "Parameter 'pCounterIndices[" << i << "]' is " << pCounterIndices[i] << " but must be less than " << numCounters << ".";
+            GPA_LogError(message.str().c_str());
+            return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
+        }
+
+        if (!candidateCounterBits[pCounterIndices[i]])
+        {
+            candidateCounterBits[pCounterIndices[i]] = true;
+            candidateIndices.push_back(pCounterIndices[i]);
+        }
+    }
+
+    std::vector<gpa_uint32> sortedCandidateIndices(candidateIndices);
+    std::sort(sortedCandidateIndices.begin(), sortedCandidateIndices.end());
+
+    GPACounterSplitterAlgorithm algorithm = GetSplittingAlgorithm();
+    gpa_uint64 hash = HashPassPlan(m_vendorId, m_deviceId, m_revisionId, algorithm, sortedCandidateIndices);
+
+    // a cached plan is only read, so that neither the cache order nor the cache statistics change
+    GPA_CounterPassPlanList::iterator cachedPlan = FindCachedPassPlan(hash, algorithm, sortedCandidateIndices);
+
+    if (cachedPlan != m_passPlanCache.end())
+    {
+        *pNumRequiredPassesOut = (gpa_uint32)cachedPlan->m_passPartitions.size();
+        return GPA_STATUS_OK;
+    }
+
+    std::vector<unsigned int> maxCountersPerGroup;
+    IGPASplitCounters* pSplitter = CreateCounterSplitter(algorithm, maxCountersPerGroup);
+
+    if (nullptr == pSplitter)
+    {
+        GPA_LogError("Failed to create a counter splitting algorithm.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    GPA_CounterGeneratorBase* pGenerator = reinterpret_cast<GPA_CounterGeneratorBase*>(m_pCounterAccessor);
+    const IGPACounterAccessor* pGroupAccessor = pGenerator->GetCounterGroupAccessor();
+
+    GPACounterPassList passPartitions;
+    GPA_Status status = SplitCounters(pSplitter, candidateIndices, pGroupAccessor, maxCountersPerGroup, passPartitions);
+
+    delete pSplitter;
+    pSplitter = nullptr;
+
+    if (GPA_STATUS_OK == status)
+    {
+        *pNumRequiredPassesOut = (gpa_uint32)passPartitions.size();
+    }
+
+    return status;
+}
+
+GPA_Status GPA_CounterSchedulerBase::GetCounterPassAffinity(gpa_uint32 counterIndex, gpa_uint8* pPasses, gpa_uint32 passCount)
+{
+    if (counterIndex >= m_enabledPublicCounterBits.size() || !m_enabledPublicCounterBits[counterIndex])
+    {
+        std::stringstream message;
+        message << "Counter " << counterIndex << " is not enabled.";
+        GPA_LogError(message.str().c_str());
+        return GPA_STATUS_ERROR_NOT_ENABLED;
+    }
+
+    gpa_uint32 numRequiredPasses = 0;
+    GPA_Status status = GetNumRequiredPasses(&numRequiredPasses);
+
+    if (GPA_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    if (passCount < numRequiredPasses)
+    {
+        std::stringstream message;
+        message << "Parameter 'passCount' is " << passCount << " but must be at least the number of passes (" << numRequiredPasses << ").";
+        GPA_LogError(message.str().c_str());
+        return GPA_STATUS_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    CounterResultLocationMap* pResultLocations = GetCounterResultLocations(counterIndex);
+
+    if (nullptr == pResultLocations)
+    {
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    for (gpa_uint32 i = 0; i < passCount; i++)
+    {
+        pPasses[i] = 0;
+    }
+
+    for (CounterResultLocationMap::const_iterator it = pResultLocations->begin(); it != pResultLocations->end(); ++it)
+    {
+        pPasses[it->second.m_pass] = 1;
+    }
+
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_CounterSchedulerBase::EnableCountersWithinPassBudget(const gpa_uint32* pCounterIndices, gpa_uint32 counterCount, gpa_uint32 maxPasses, gpa_uint32* pNumEnabledOut)
+{
+    if (nullptr == m_pCounterAccessor)
+    {
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    if (0 == maxPasses)
+    {
+        GPA_LogError("Parameter 'maxPasses' must be at least 1.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    // check all of the counters before changing the enabled counters
+    gpa_uint32 numCounters = m_pCounterAccessor->GetNumCounters();
+
+    for (gpa_uint32 i = 0; i < counterCount; i++)
+    {
+        if (pCounterIndices[i] >= numCounters)
+        {
+            std::stringstream message;
+            message << "Parameter 'pCounterIndices[" << i << "]' is " << pCounterIndices[i] << " but must be less than " << numCounters << ".";
+            GPA_LogError(message.str().c_str());
+            return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE;
+        }
+    }
+
+    GPACounterSplitterAlgorithm algorithm = GetSplittingAlgorithm();
+
+    // the pass-minimizing splitter can not update passes, so the counters that fit are chosen with the consolidated splitter, which can
+    GPACounterSplitterAlgorithm selectionAlgorithm = (OPTIMAL == algorithm) ? CONSOLIDATED : algorithm;
+    std::vector<unsigned int> maxCountersPerGroup;
+    IGPASplitCounters* pSplitter = CreateCounterSplitter(selectionAlgorithm, maxCountersPerGroup);
+
+    if (nullptr == pSplitter)
+    {
+        GPA_LogError("Failed to create a counter splitting algorithm.");
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    GPA_CounterGeneratorBase* pGenerator = reinterpret_cast<GPA_CounterGeneratorBase*>(m_pCounterAccessor);
+    const IGPACounterAccessor* pGroupAccessor = pGenerator->GetCounterGroupAccessor();
+
+    // the counters are tried in priority order, and a counter that does not fit in the budget is skipped,
+    // so that lower priority counters which fit in the passes of the higher priority ones are still enabled.
+    // Each counter is added to the passes of the counters enabled before it, the counters are only split again if the passes can not be updated.
+    std::vector<bool> triedCounterBits(numCounters, false);
+    std::vector<gpa_uint32> budgetIndices;
+    GPACounterPassList budgetPassPartitions;
+    std::map<unsigned int, CounterResultLocationMap> budgetResultLocationMap;
+    bool budgetHasSoftwareCounters = false;
+    bool budgetPassesAreSplit = true;
+
+    for (gpa_uint32 i = 0; i < counterCount; i++)
+    {
+        gpa_uint32 counterIndex = pCounterIndices[i];
+
+        if (triedCounterBits[counterIndex])
+        {
+            continue;
+        }
+
+        triedCounterBits[counterIndex] = true;
+
+        GPACounterPassList passPartitions;
+        std::map<unsigned int, CounterResultLocationMap> resultLocationMap;
+        std::vector<const GPA_PublicCounter*> publicCountersToAdd;
+        std::vector<GPAHardwareCounterIndices> hardwareCountersToAdd;
+        bool updatedPasses = false;
+
+        if (!budgetIndices.empty() && !budgetHasSoftwareCounters &&
+            GetCountersToAdd(std::vector<gpa_uint32>(1, counterIndex), publicCountersToAdd, hardwareCountersToAdd))
+        {
+            passPartitions = budgetPassPartitions;
+            resultLocationMap = budgetResultLocationMap;
+
+            // the splitter updates the result locations in place
+            pSplitter->SwapCounterResultLocations(resultLocationMap);
+            updatedPasses = pSplitter->UpdatePasses(passPartitions, std::vector<unsigned int>(), publicCountersToAdd, hardwareCountersToAdd, pGroupAccessor, maxCountersPerGroup);
+            pSplitter->SwapCounterResultLocations(resultLocationMap);
+        }
+
+        budgetIndices.push_back(counterIndex);
+
+        if (!updatedPasses)
+        {
+            GPA_Status status = SplitCounters(pSplitter, budgetIndices, pGroupAccessor, maxCountersPerGroup, passPartitions);
+
+            // taking the result locations out of the splitter also clears them for the next split
+            resultLocationMap.clear();
+            pSplitter->SwapCounterResultLocations(resultLocationMap);
+
+            if (GPA_STATUS_OK != status)
+            {
+                delete pSplitter;
+                return status;
+            }
+        }
+
+        if (passPartitions.size() <= maxPasses)
+        {
+            budgetPassPartitions.swap(passPartitions);
+            budgetResultLocationMap.swap(resultLocationMap);
+            budgetHasSoftwareCounters = budgetHasSoftwareCounters || SOFTWARE_COUNTER == m_pCounterAccessor->GetCounterTypeInfo(counterIndex).m_counterType;
+            budgetPassesAreSplit = !updatedPasses;
+        }
+        else
+        {
+            budgetIndices.pop_back();
+        }
+    }
+
+    delete pSplitter;
+    pSplitter = nullptr;
+
+    // the pass-minimizing splitter splits the chosen counters once, and its passes are used unless the updated passes are fewer.
+    // Updated passes depend on the order in which the counters were tried, so only the passes of a full split are cached.
+    bool budgetPassesAreCacheable = budgetPassesAreSplit;
+
+    if (selectionAlgorithm != algorithm && !budgetIndices.empty())
+    {
+        pSplitter = CreateCounterSplitter(algorithm, maxCountersPerGroup);
+
+        if (nullptr == pSplitter)
+        {
+            GPA_LogError("Failed to create a counter splitting algorithm.");
+            return GPA_STATUS_ERROR_FAILED;
+        }
+
+        GPACounterPassList passPartitions;
+        GPA_Status status = SplitCounters(pSplitter, budgetIndices, pGroupAccessor, maxCountersPerGroup, passPartitions);
+
+        std::map<unsigned int, CounterResultLocationMap> resultLocationMap;
+        pSplitter->SwapCounterResultLocations(resultLocationMap);
+
+        delete pSplitter;
+        pSplitter = nullptr;
+
+        if (GPA_STATUS_OK != status)
+        {
+            return status;
+        }
+
+        budgetPassesAreCacheable = passPartitions.size() <= budgetPassPartitions.size();
+
+        if (budgetPassesAreCacheable)
+        {
+            budgetPassPartitions.swap(passPartitions);
+            budgetResultLocationMap.swap(resultLocationMap);
+        }
+    }
+
+    DisableAllCounters();
+
+    for (std::vector<gpa_uint32>::const_iterator it = budgetIndices.begin(); it != budgetIndices.end(); ++it)
+    {
+        GPA_Status status = EnableCounter(*it);
+
+        if (GPA_STATUS_OK != status)
+        {
+            return status;
+        }
+    }
+
+    // the passes of the enabled counters are already known, so they are kept for GetNumRequiredPasses instead of being split again
+    m_passPartitions.swap(budgetPassPartitions);
+    m_counterResultLocationMap.swap(budgetResultLocationMap);
+    m_passesChanged = true;
+
+    std::vector<gpa_uint32> sortedEnabledIndices(budgetIndices);
+    std::sort(sortedEnabledIndices.begin(), sortedEnabledIndices.end());
+
+    m_hasPassPlan = true;
+    m_scheduledIndices = sortedEnabledIndices;
+    m_scheduledAlgorithm = algorithm;
+    m_fullSplitRequested = false;
+
+    if (budgetPassesAreCacheable)
+    {
+        CachePassPlan(HashPassPlan(m_vendorId, m_deviceId, m_revisionId, algorithm, sortedEnabledIndices), algorithm, sortedEnabledIndices);
+    }
+
+    *pNumEnabledOut = static_cast<gpa_uint32>(budgetIndices.size());
+
+    return GPA_STATUS_OK;
+}
+
+IGPASplitCounters* GPA_CounterSchedulerBase::CreateCounterSplitter(GPACounterSplitterAlgorithm algorithm, std::vector<unsigned int>& maxCountersPerGroup)
+{
+    GPA_CounterGeneratorBase* pGenerator = reinterpret_cast<GPA_CounterGeneratorBase*>(m_pCounterAccessor);
     GPA_HardwareCounters* pHWCounters = pGenerator->GetHardwareCounters();
 
     unsigned int numSQMaxCounters = 0;
@@ -209,7 +644,7 @@ GPA_Status GPA_CounterSchedulerBase::GetNumRequiredPasses(gpa_uint32* pNumRequir
         numSQMaxCounters = static_cast<unsigned int>(deviceInfo.m_nNumSQMaxCounters);
     }
 
-    IGPASplitCounters* pSplitter = GPASplitCounterFactory::GetNewCounterSplitter(GetPreferredSplittingAlgorithm(),
+    IGPASplitCounters* pSplitter = GPASplitCounterFactory::GetNewCounterSplitter(algorithm,
                                    pHWCounters->m_gpuTimeIndex,
                                    pHWCounters->m_gpuTimeBottomToBottomCounterIndex,
                                    pHWCounters->m_gpuTimeTopToBottomCounterIndex,
@@ -219,16 +654,55 @@ GPA_Status GPA_CounterSchedulerBase::GetNumRequiredPasses(gpa_uint32* pNumRequir
 
     if (nullptr == pSplitter)
     {
-        GPA_LogError("Failed to create a counter splitting algorithm.");
-        return GPA_STATUS_ERROR_FAILED;
+        return nullptr;
     }
 
+    // Get the Sw counters
+    GPA_SoftwareCounters* pSWCounters = pGenerator->GetSoftwareCounters();
+
+    // build the list of max counters per group (includes both hardware and software groups)
+    maxCountersPerGroup.clear();
+
+    // Create space for the number of HW and SW groups
+    maxCountersPerGroup.reserve(pHWCounters->m_groupCount + pHWCounters->m_additionalGroupCount + pSWCounters->m_groupCount);
+
+    // Add the HW groups max's
+    for (unsigned int i = 0; i < pHWCounters->m_groupCount; ++i)
+    {
+        maxCountersPerGroup.push_back(pHWCounters->m_pGroups[i].m_maxActiveCounters);
+    }
+
+    // Add the Additional groups max's
+    for (unsigned int i = 0; i < pHWCounters->m_additionalGroupCount; ++i)
+    {
+        maxCountersPerGroup.push_back(pHWCounters->m_pAdditionalGroups[i].m_maxActiveCounters);
+    }
+
+    // TODO: properly handle software groups -- right now, this works because there is only ever a single group defined
+    if (pSWCounters->m_groupCount == 1)
+    {
+        maxCountersPerGroup.push_back(DoGetNumSoftwareCounters());
+    }
+
+    return pSplitter;
+}
+
+GPA_Status GPA_CounterSchedulerBase::SplitCounters(IGPASplitCounters* pSplitter,
+                                                  const std::vector<gpa_uint32>& counterIndices,
+                                                  const IGPACounterAccessor* pAccessor,
+                                                  const std::vector<unsigned int>& maxCountersPerGroup,
+                                                  GPACounterPassList& passPartitions)
+{
+#if defined(WIN32)
+    GPA_HardwareCounters* pHWCounters = reinterpret_cast<GPA_CounterGeneratorBase*>(m_pCounterAccessor)->GetHardwareCounters();
+#endif
+
     // build the list of counters to split
     std::vector<const GPA_PublicCounter*> publicCountersToSplit;
     std::vector<GPAHardwareCounterIndices> internalCountersToSchedule;
     std::vector<GPASoftwareCounterIndices> softwareCountersToSchedule;
 
-    for (std::vector<gpa_uint32>::iterator counterIter = m_enabledPublicIndices.begin(); counterIter != m_enabledPublicIndices.end(); ++counterIter)
+    for (std::vector<gpa_uint32>::const_iterator counterIter = counterIndices.begin(); counterIter != counterIndices.end(); ++counterIter)
     {
         GPACounterTypeInfo info = m_pCounterAccessor->GetCounterTypeInfo(*counterIter);
 
@@ -290,69 +764,27 @@ GPA_Status GPA_CounterSchedulerBase::GetNumRequiredPasses(gpa_uint32* pNumRequir
         }
     }
 
-    // Get the Sw counters
-    GPA_SoftwareCounters* pSWCounters = pGenerator->GetSoftwareCounters();
-
-    // build the list of max counters per group (includes both hardware and software groups)
-    std::vector<unsigned int> maxCountersPerGroup;
-
-    // Create space for the number of HW and SW groups
-    maxCountersPerGroup.reserve(pHWCounters->m_groupCount + pHWCounters->m_additionalGroupCount + pSWCounters->m_groupCount);
-
-    // Add the HW groups max's
-    for (unsigned int i = 0; i < pHWCounters->m_groupCount; ++i)
-    {
-        maxCountersPerGroup.push_back(pHWCounters->m_pGroups[i].m_maxActiveCounters);
-    }
-
-    // Add the Additional groups max's
-    for (unsigned int i = 0; i < pHWCounters->m_additionalGroupCount; ++i)
-    {
-        maxCountersPerGroup.push_back(pHWCounters->m_pAdditionalGroups[i].m_maxActiveCounters);
-    }
-
-    // TODO: properly handle software groups -- right now, this works because there is only ever a single group defined
-    if (pSWCounters->m_groupCount == 1)
-    {
-        maxCountersPerGroup.push_back(DoGetNumSoftwareCounters());
-    }
-
-    GPACounterGroupAccessor accessor(pHWCounters->m_pGroups,
-                                     pHWCounters->m_groupCount,
-                                     pHWCounters->m_pAdditionalGroups,
-                                     pHWCounters->m_additionalGroupCount,
-                                     pSWCounters->m_pGroups,
-                                     pSWCounters->m_groupCount);
-
     unsigned int numInternalCountersScheduled = 0;
 
-    m_passPartitions = pSplitter->SplitCounters(publicCountersToSplit,
-                                                internalCountersToSchedule,
-                                                softwareCountersToSchedule,
-                                                (IGPACounterAccessor*)&accessor,
-                                                maxCountersPerGroup,
-                                                numInternalCountersScheduled);
-
-    m_counterResultLocationMap = pSplitter->GetCounterResultLocations();
-
-    delete pSplitter;
-    pSplitter = nullptr;
-
-    m_counterSelectionChanged = false;
-    *pNumRequiredPassesOut = (gpa_uint32)m_passPartitions.size();
+    passPartitions = pSplitter->SplitCounters(publicCountersToSplit,
+                                              internalCountersToSchedule,
+                                              softwareCountersToSchedule,
+                                              pAccessor,
+                                              maxCountersPerGroup,
+                                              numInternalCountersScheduled);
 
     return GPA_STATUS_OK;
 }
 
 bool GPA_CounterSchedulerBase::GetCounterSelectionChanged()
 {
-    return m_counterSelectionChanged;
+    return m_passesChanged;
 }
 
 GPA_Status GPA_CounterSchedulerBase::BeginProfile()
 {
     m_passIndex = 0;
-    m_counterSelectionChanged = false;
+    m_passesChanged = false;
 
     return DoBeginProfile();
 }
@@ -366,16 +798,7 @@ void GPA_CounterSchedulerBase::BeginPass()
 
 std::vector<unsigned int>* GPA_CounterSchedulerBase::GetCountersForPass(gpa_uint32 passIndex)
 {
-    auto iter = m_passPartitions.begin();
-    unsigned int i = 0;
-
-    while (i < passIndex)
-    {
-        iter++;
-        i++;
-    }
-
-    return &(iter->m_counters);
+    return &(m_passPartitions[passIndex].m_counters);
 }
 
 void GPA_CounterSchedulerBase::EndPass()
@@ -405,11 +828,311 @@ CounterResultLocationMap* GPA_CounterSchedulerBase::GetCounterResultLocations(un
     return nullptr;
 }
 
+const GPA_CounterGatherPlan* GPA_CounterSchedulerBase::GetCounterGatherPlan(gpa_uint32 counterIndex)
+{
+    if (counterIndex >= m_gatherPlans.size() || 0 == m_gatherPlans[counterIndex].m_numEntries)
+    {
+        return nullptr;
+    }
+
+    return &m_gatherPlans[counterIndex];
+}
+
+void GPA_CounterSchedulerBase::BuildCounterGatherPlans()
+{
+    gpa_uint32 numCounters = m_pCounterAccessor->GetNumCounters();
+    gpa_uint32 numPublicCounters = m_pCounterAccessor->GetNumPublicCounters();
+
+    // the plans point into m_gatherEntries, so the first entry of each plan is recorded until all of the entries are added
+    std::vector<gpa_uint32> firstEntries(numCounters, 0);
+
+    m_gatherEntries.clear();
+    m_gatherPlans.assign(numCounters, GPA_CounterGatherPlan());
+
+    for (std::vector<gpa_uint32>::const_iterator counterIter = m_enabledPublicIndices.begin(); counterIter != m_enabledPublicIndices.end(); ++counterIter)
+    {
+        gpa_uint32 counterIndex = *counterIter;
+        CounterResultLocationMap* pResultLocations = GetCounterResultLocations(counterIndex);
+
+        if (nullptr == pResultLocations || pResultLocations->empty())
+        {
+            continue;
+        }
+
+        GPA_CounterGatherPlan& plan = m_gatherPlans[counterIndex];
+        firstEntries[counterIndex] = (gpa_uint32)m_gatherEntries.size();
+
+        GPA_CounterGatherEntry entry;
+
+        switch (m_pCounterAccessor->GetCounterTypeInfo(counterIndex).m_counterType)
+        {
+            case PUBLIC_COUNTER:
+            {
+                std::vector<gpa_uint32> internalCountersRequired = m_pCounterAccessor->GetInternalCountersRequired(counterIndex);
+
+                for (std::vector<gpa_uint32>::const_iterator requiredCounterIter = internalCountersRequired.begin(); requiredCounterIter != internalCountersRequired.end(); ++requiredCounterIter)
+                {
+                    CounterResultLocationMap::const_iterator resultLocationIter = pResultLocations->find(*requiredCounterIter);
+
+                    if (resultLocationIter == pResultLocations->end())
+                    {
+                        // a counter which is missing one of its results cannot be computed
+                        m_gatherEntries.resize(firstEntries[counterIndex]);
+                        plan.m_numEntries = 0;
+                        break;
+                    }
+
+                    entry.m_pass = resultLocationIter->second.m_pass;
+                    entry.m_offset = resultLocationIter->second.m_offset;
+                    entry.m_type = m_pCounterAccessor->GetCounterDataType(numPublicCounters + *requiredCounterIter);
+                    m_gatherEntries.push_back(entry);
+                    plan.m_numEntries++;
+                }
+
+                break;
+            }
+
+            case HARDWARE_COUNTER:
+            {
+                CounterResultLocationMap::const_iterator resultLocationIter = pResultLocations->find(counterIndex - numPublicCounters);
+
+                if (resultLocationIter != pResultLocations->end())
+                {
+                    entry.m_pass = resultLocationIter->second.m_pass;
+                    entry.m_offset = resultLocationIter->second.m_offset;
+                    entry.m_type = GPA_TYPE_UINT64;
+                    m_gatherEntries.push_back(entry);
+                    plan.m_numEntries = 1;
+                }
+
+                break;
+            }
+
+            case SOFTWARE_COUNTER:
+            {
+                entry.m_pass = pResultLocations->begin()->second.m_pass;
+                entry.m_offset = pResultLocations->begin()->second.m_offset;
+                entry.m_type = GPA_TYPE_UINT64;
+                m_gatherEntries.push_back(entry);
+                plan.m_numEntries = 1;
+                break;
+            }
+
+            case UNKNOWN_COUNTER:
+            default:
+                break;
+        }
+    }
+
+    for (std::vector<gpa_uint32>::const_iterator counterIter = m_enabledPublicIndices.begin(); counterIter != m_enabledPublicIndices.end(); ++counterIter)
+    {
+        if (0 != m_gatherPlans[*counterIter].m_numEntries)
+        {
+            m_gatherPlans[*counterIter].m_pEntries = &m_gatherEntries[firstEntries[*counterIter]];
+        }
+    }
+}
+
 void GPA_CounterSchedulerBase::SetDrawCallCounts(const int iCounts)
 {
     DoSetDrawCallCounts(iCounts);
 }
 
+void GPA_CounterSchedulerBase::GetPassPlanCacheStatistics(gpa_uint32* pHits, gpa_uint32* pMisses)
+{
+    if (nullptr != pHits)
+    {
+        *pHits = m_passPlanCacheHits;
+    }
+
+    if (nullptr != pMisses)
+    {
+        *pMisses = m_passPlanCacheMisses;
+    }
+}
+
+void GPA_CounterSchedulerBase::SetMinimizePasses(bool minimizePasses)
+{
+    if (minimizePasses != m_minimizePasses)
+    {
+        m_minimizePasses = minimizePasses;
+
+        // the enabled counters have to be split again with the other algorithm
+        m_counterSelectionChanged = true;
+    }
+}
+
+void GPA_CounterSchedulerBase::RequestFullSplit()
+{
+    m_fullSplitRequested = true;
+
+    // the passes have to be computed again even if the enabled counters did not change
+    m_counterSelectionChanged = true;
+}
+
+GPACounterSplitterAlgorithm GPA_CounterSchedulerBase::GetSplittingAlgorithm()
+{
+    GPACounterSplitterAlgorithm algorithm = GetPreferredSplittingAlgorithm();
+
+    // the other algorithms either split differently on purpose or handle API specific counters
+    if (m_minimizePasses && CONSOLIDATED == algorithm)
+    {
+        algorithm = OPTIMAL;
+    }
+
+    return algorithm;
+}
+
+GPA_CounterPassPlanList::iterator GPA_CounterSchedulerBase::FindCachedPassPlan(gpa_uint64 hash, GPACounterSplitterAlgorithm algorithm, const std::vector<gpa_uint32>& sortedCounterIndices)
+{
+    for (GPA_CounterPassPlanList::iterator it = m_passPlanCache.begin(); it != m_passPlanCache.end(); ++it)
+    {
+        if (it->m_hash == hash &&
+            it->m_vendorId == m_vendorId &&
+            it->m_deviceId == m_deviceId &&
+            it->m_revisionId == m_revisionId &&
+            it->m_algorithm == algorithm &&
+            it->m_sortedEnabledIndices == sortedCounterIndices)
+        {
+            return it;
+        }
+    }
+
+    return m_passPlanCache.end();
+}
+
+bool GPA_CounterSchedulerBase::UseCachedPassPlan(gpa_uint64 hash, GPACounterSplitterAlgorithm algorithm, const std::vector<gpa_uint32>& sortedEnabledIndices)
+{
+    GPA_CounterPassPlanList::iterator it = FindCachedPassPlan(hash, algorithm, sortedEnabledIndices);
+
+    if (it == m_passPlanCache.end())
+    {
+        m_passPlanCacheMisses++;
+        return false;
+    }
+
+    // move the plan to the front, so that the least recently used plan is evicted first
+    m_passPlanCache.splice(m_passPlanCache.begin(), m_passPlanCache, it);
+
+    m_passPartitions = m_passPlanCache.front().m_passPartitions;
+    m_counterResultLocationMap = m_passPlanCache.front().m_counterResultLocationMap;
+    m_passPlanCacheHits++;
+    return true;
+}
+
+void GPA_CounterSchedulerBase::CachePassPlan(gpa_uint64 hash, GPACounterSplitterAlgorithm algorithm, std::vector<gpa_uint32>& sortedEnabledIndices)
+{
+    // a plan for the same counters is already cached if the counters were split again on request
+    GPA_CounterPassPlanList::iterator cachedPlan = FindCachedPassPlan(hash, algorithm, sortedEnabledIndices);
+
+    if (cachedPlan != m_passPlanCache.end())
+    {
+        m_passPlanCache.erase(cachedPlan);
+    }
+
+    if (m_passPlanCache.size() >= GPA_PASS_PLAN_CACHE_SIZE)
+    {
+        m_passPlanCache.pop_back();
+    }
+
+    m_passPlanCache.push_front(GPA_CounterPassPlan());
+
+    GPA_CounterPassPlan& plan = m_passPlanCache.front();
+    plan.m_hash = hash;
+    plan.m_vendorId = m_vendorId;
+    plan.m_deviceId = m_deviceId;
+    plan.m_revisionId = m_revisionId;
+    plan.m_algorithm = algorithm;
+    plan.m_sortedEnabledIndices.swap(sortedEnabledIndices);
+    plan.m_passPartitions = m_passPartitions;
+    plan.m_counterResultLocationMap = m_counterResultLocationMap;
+}
+
+bool GPA_CounterSchedulerBase::UpdatePassPlan(IGPASplitCounters* pSplitter,
+                                              GPACounterSplitterAlgorithm algorithm,
+                                              const std::vector<gpa_uint32>& sortedEnabledIndices,
+                                              const IGPACounterAccessor* pAccessor,
+                                              const std::vector<unsigned int>& maxCountersPerGroup)
+{
+    if (!m_hasPassPlan || m_fullSplitRequested || algorithm != m_scheduledAlgorithm)
+    {
+        return false;
+    }
+
+    std::vector<gpa_uint32> addedIndices;
+    std::vector<gpa_uint32> removedIndices;
+    std::set_difference(sortedEnabledIndices.begin(), sortedEnabledIndices.end(), m_scheduledIndices.begin(), m_scheduledIndices.end(), std::back_inserter(addedIndices));
+    std::set_difference(m_scheduledIndices.begin(), m_scheduledIndices.end(), sortedEnabledIndices.begin(), sortedEnabledIndices.end(), std::back_inserter(removedIndices));
+
+    // when most of the selection changed, splitting it again costs about as much as updating the passes and gives better passes
+    size_t numKeptIndices = sortedEnabledIndices.size() - addedIndices.size();
+
+    if (addedIndices.size() + removedIndices.size() >= numKeptIndices)
+    {
+        return false;
+    }
+
+    // software counters are scheduled in passes of their own, which are only built by a full split
+    for (std::vector<gpa_uint32>::const_iterator it = m_scheduledIndices.begin(); it != m_scheduledIndices.end(); ++it)
+    {
+        if (SOFTWARE_COUNTER == m_pCounterAccessor->GetCounterTypeInfo(*it).m_counterType)
+        {
+            return false;
+        }
+    }
+
+    std::vector<const GPA_PublicCounter*> publicCountersToAdd;
+    std::vector<GPAHardwareCounterIndices> hardwareCountersToAdd;
+
+    if (!GetCountersToAdd(addedIndices, publicCountersToAdd, hardwareCountersToAdd))
+    {
+        return false;
+    }
+
+    // the splitter updates the result locations in place, and leaves them unchanged if it cannot update the passes
+    pSplitter->SwapCounterResultLocations(m_counterResultLocationMap);
+    bool updatedPasses = pSplitter->UpdatePasses(m_passPartitions, removedIndices, publicCountersToAdd, hardwareCountersToAdd, pAccessor, maxCountersPerGroup);
+    pSplitter->SwapCounterResultLocations(m_counterResultLocationMap);
+
+    return updatedPasses;
+}
+
+bool GPA_CounterSchedulerBase::GetCountersToAdd(const std::vector<gpa_uint32>& addedIndices,
+                                                std::vector<const GPA_PublicCounter*>& publicCountersToAdd,
+                                                std::vector<GPAHardwareCounterIndices>& hardwareCountersToAdd)
+{
+    for (std::vector<gpa_uint32>::const_iterator it = addedIndices.begin(); it != addedIndices.end(); ++it)
+    {
+        GPACounterTypeInfo info = m_pCounterAccessor->GetCounterTypeInfo(*it);
+
+        if (PUBLIC_COUNTER == info.m_counterType)
+        {
+            publicCountersToAdd.push_back(m_pCounterAccessor->GetPublicCounter(*it));
+        }
+        else if (HARDWARE_COUNTER == info.m_counterType)
+        {
+            std::vector<unsigned int> requiredCounters = m_pCounterAccessor->GetInternalCountersRequired(*it);
+
+            if (requiredCounters.size() != 1)
+            {
+                return false;
+            }
+
+            GPAHardwareCounterIndices indices;
+            indices.m_publicIndex = *it;
+            indices.m_hardwareIndex = requiredCounters[0];
+            hardwareCountersToAdd.push_back(indices);
+        }
+        else
+        {
+            // software counters are only placed by a full split
+            return false;
+        }
+    }
+
+    return true;
+}
+
 GPA_Status GPA_CounterSchedulerBase::DoDisableCounter(gpa_uint32 index)
 {
     m_enabledPublicCounterBits[index] = false;
@@ -8,9 +8,28 @@
 #ifndef _GPA_COUNTER_SCHEDULER_BASE_H_
 #define _GPA_COUNTER_SCHEDULER_BASE_H_
 
+#include <list>
 #include "GPAICounterScheduler.h"
 #include "GPASplitCounterFactory.h"
 
+/// The number of pass plans kept by a counter scheduler, so that switching between a few counter selections does not split the counters again
+static const unsigned int GPA_PASS_PLAN_CACHE_SIZE = 8;
+
+/// The passes and result locations computed for a set of enabled counters
+struct GPA_CounterPassPlan
+{
+    gpa_uint64 m_hash;                                                         ///< hash of the device ids, the splitting algorithm and the sorted enabled counters, compared before the counters themselves
+    gpa_uint32 m_vendorId;                                                     ///< the vendor id the plan was computed for
+    gpa_uint32 m_deviceId;                                                     ///< the device id the plan was computed for
+    gpa_uint32 m_revisionId;                                                   ///< the revision id the plan was computed for
+    GPACounterSplitterAlgorithm m_algorithm;                                   ///< the splitting algorithm the plan was computed with
+    std::vector<gpa_uint32> m_sortedEnabledIndices;                            ///< the enabled counters, sorted by index
+    GPACounterPassList m_passPartitions;                                       ///< the counters in each pass
+    std::map< unsigned int, CounterResultLocationMap> m_counterResultLocationMap; ///< the result locations of each enabled counter
+};
+
+typedef std::list<GPA_CounterPassPlan> GPA_CounterPassPlanList; ///< typedef for a list of pass plans, most recently used first
+
 /// Base Class for counter scheduling
 class GPA_CounterSchedulerBase : public GPA_ICounterScheduler
 {
@@ -19,7 +38,7 @@ public:
     GPA_CounterSchedulerBase();
 
     /// Destructor
-    ~GPA_CounterSchedulerBase();
+    virtual ~GPA_CounterSchedulerBase();
 
     // Implementation of GPA_ICounterScheduler
 
@@ -68,8 +87,8 @@ public:
     /// \return GPA_STATUS_OK on success
     GPA_Status GetNumRequiredPasses(gpa_uint32* pNumRequiredPassesOut);
 
-    /// Get a flag indicating if the counter selection has changed
-    /// \return true if the counter selection has changed, false otherwise
+    /// Get a flag indicating if the passes have changed since profiling last began
+    /// \return true if the passes have changed, false otherwise
     bool GetCounterSelectionChanged();
 
     /// Begin profiling -- sets pass index to zero
@@ -100,6 +119,49 @@ public:
     /// \param iCounts the count of draw calls
     void SetDrawCallCounts(const int iCounts);
 
+    /// Gets how often the pass plan for the enabled counters was found in the cache of previously computed plans
+    /// \param[out] pHits the number of times GetNumRequiredPasses reused a cached plan
+    /// \param[out] pMisses the number of times GetNumRequiredPasses had to split the enabled counters
+    void GetPassPlanCacheStatistics(gpa_uint32* pHits, gpa_uint32* pMisses);
+
+    /// Sets whether the enabled counters are split into as few passes as possible
+    /// \param minimizePasses true to search for the fewest passes, false to use the splitting algorithm preferred by the API
+    void SetMinimizePasses(bool minimizePasses);
+
+    /// Makes the next call to GetNumRequiredPasses split all of the enabled counters again
+    void RequestFullSplit();
+
+    /// Obtains the number of passes required to collect a set of counters, without changing the enabled counters
+    /// \param pCounterIndices the indices of the counters to split
+    /// \param counterCount the number of counters in pCounterIndices
+    /// \param[out] pNumRequiredPassesOut Will contain the number of passes needed to collect the counters
+    /// \return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE if a counter index is not valid
+    /// \return GPA_STATUS_OK on success
+    GPA_Status GetNumRequiredPassesForCounters(const gpa_uint32* pCounterIndices, gpa_uint32 counterCount, gpa_uint32* pNumRequiredPassesOut);
+
+    /// Gets the passes the results of an enabled counter are collected in
+    /// \param counterIndex the index of the enabled counter
+    /// \param[out] pPasses array that will contain 1 for each pass the counter is collected in, and 0 for the other passes
+    /// \param passCount the number of elements in pPasses
+    /// \return GPA_STATUS_ERROR_NOT_ENABLED if the counter is not enabled
+    /// \return GPA_STATUS_ERROR_BUFFER_TOO_SMALL if passCount is less than the number of passes
+    /// \return GPA_STATUS_OK on success
+    GPA_Status GetCounterPassAffinity(gpa_uint32 counterIndex, gpa_uint8* pPasses, gpa_uint32 passCount);
+
+    /// Enables the highest priority counters that can be collected within a number of passes, in place of the enabled counters
+    /// \param pCounterIndices the indices of the counters to enable, highest priority first
+    /// \param counterCount the number of counters in pCounterIndices
+    /// \param maxPasses the maximum number of passes the enabled counters may require
+    /// \param[out] pNumEnabledOut Will contain the number of counters that were enabled
+    /// \return GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE if a counter index is not valid or maxPasses is 0
+    /// \return GPA_STATUS_OK on success
+    GPA_Status EnableCountersWithinPassBudget(const gpa_uint32* pCounterIndices, gpa_uint32 counterCount, gpa_uint32 maxPasses, gpa_uint32* pNumEnabledOut);
+
+    /// Gets where the internal results of an enabled counter are located in the current passes
+    /// \param counterIndex the index of the enabled counter
+    /// \return the gather plan of the counter, or nullptr if the counter was not enabled when the passes were computed
+    const GPA_CounterGatherPlan* GetCounterGatherPlan(gpa_uint32 counterIndex);
+
     // end Implementation of GPA_ICounterScheduler
 
 protected:
@@ -108,6 +170,10 @@ protected:
     /// \return the preferred counter splitting algorithm
     virtual GPACounterSplitterAlgorithm GetPreferredSplittingAlgorithm() = 0;
 
+    /// Gets the counter splitting algorithm to use for the enabled counters
+    /// \return OPTIMAL if passes should be minimized and the preferred algorithm is CONSOLIDATED, otherwise the preferred counter splitting algorithm
+    GPACounterSplitterAlgorithm GetSplittingAlgorithm();
+
     /// Helper function to disable a counter
     /// \param index the index of the counter to disable
     /// \return GPA_STATUS_OK on success
@@ -131,6 +197,70 @@ protected:
     /// Helper function called when ending a pass
     virtual void DoEndPass();
 
+    /// Creates a counter splitter for the device
+    /// \param algorithm the splitting algorithm to create
+    /// \param[out] maxCountersPerGroup the maximum number of counters that can be enabled in a single pass on each HW block or SW group
+    /// \return the new counter splitter, which the caller must delete, or nullptr if it could not be created
+    IGPASplitCounters* CreateCounterSplitter(GPACounterSplitterAlgorithm algorithm, std::vector<unsigned int>& maxCountersPerGroup);
+
+    /// Splits a set of counters into passes
+    /// \param pSplitter the counter splitter to split the counters with
+    /// \param counterIndices the counters to split, in the order they were enabled
+    /// \param pAccessor the accessor for the internal counters
+    /// \param maxCountersPerGroup the maximum number of counters that can be enabled in a single pass on each HW block or SW group
+    /// \param[out] passPartitions the counters in each pass
+    /// \return GPA_STATUS_OK on success
+    GPA_Status SplitCounters(IGPASplitCounters* pSplitter,
+                             const std::vector<gpa_uint32>& counterIndices,
+                             const IGPACounterAccessor* pAccessor,
+                             const std::vector<unsigned int>& maxCountersPerGroup,
+                             GPACounterPassList& passPartitions);
+
+    /// Finds the pass plan for a set of counters in the cache
+    /// \param hash the hash of the device ids, the splitting algorithm and the sorted counters
+    /// \param algorithm the splitting algorithm the plan must have been computed with
+    /// \param sortedCounterIndices the counters, sorted by index
+    /// \return the cached plan, or the end of m_passPlanCache if the plan is not cached
+    GPA_CounterPassPlanList::iterator FindCachedPassPlan(gpa_uint64 hash, GPACounterSplitterAlgorithm algorithm, const std::vector<gpa_uint32>& sortedCounterIndices);
+
+    /// Looks up the pass plan for the enabled counters in the cache, and makes it the current plan if it is found
+    /// \param hash the hash of the device ids, the splitting algorithm and the sorted enabled counters
+    /// \param algorithm the splitting algorithm the plan must have been computed with
+    /// \param sortedEnabledIndices the enabled counters, sorted by index
+    /// \return true if a cached plan was found
+    bool UseCachedPassPlan(gpa_uint64 hash, GPACounterSplitterAlgorithm algorithm, const std::vector<gpa_uint32>& sortedEnabledIndices);
+
+    /// Adds the current pass plan to the cache, evicting the least recently used plan if the cache is full
+    /// \param hash the hash of the device ids, the splitting algorithm and the sorted enabled counters
+    /// \param algorithm the splitting algorithm the plan was computed with
+    /// \param sortedEnabledIndices the enabled counters, sorted by index
+    void CachePassPlan(gpa_uint64 hash, GPACounterSplitterAlgorithm algorithm, std::vector<gpa_uint32>& sortedEnabledIndices);
+
+    /// Gets the public and hardware counters to add to passes which are updated instead of split again
+    /// \param addedIndices the indices of the counters to add
+    /// \param[out] publicCountersToAdd the public counters among the added counters
+    /// \param[out] hardwareCountersToAdd the hardware counters among the added counters
+    /// \return true if the counters can be added to the passes, false if the counters need to be split again
+    bool GetCountersToAdd(const std::vector<gpa_uint32>& addedIndices,
+                          std::vector<const GPA_PublicCounter*>& publicCountersToAdd,
+                          std::vector<GPAHardwareCounterIndices>& hardwareCountersToAdd);
+
+    /// Updates the current passes for the counters that were enabled or disabled since the passes were computed, instead of splitting all of the enabled counters again
+    /// \param pSplitter the counter splitter to update the passes with
+    /// \param algorithm the splitting algorithm of pSplitter
+    /// \param sortedEnabledIndices the enabled counters, sorted by index
+    /// \param pAccessor the accessor for the internal counters
+    /// \param maxCountersPerGroup the maximum number of counters that can be enabled in a single pass on each HW block or SW group
+    /// \return true if the passes were updated, false if the enabled counters need to be split again
+    bool UpdatePassPlan(IGPASplitCounters* pSplitter,
+                        GPACounterSplitterAlgorithm algorithm,
+                        const std::vector<gpa_uint32>& sortedEnabledIndices,
+                        const IGPACounterAccessor* pAccessor,
+                        const std::vector<unsigned int>& maxCountersPerGroup);
+
+    /// Builds the gather plan of each enabled counter from the current result locations
+    void BuildCounterGatherPlans();
+
     /// Helper function called when setting draw call counts
     /// \param iCount draw call count per frame
     virtual void DoSetDrawCallCounts(const int iCount);
@@ -162,15 +292,50 @@ protected:
     /// m_enabledPublicCounterBits was added for performance reasons.
     std::vector<bool> m_enabledPublicCounterBits;
 
-    /// Records whether or not the counter selection changed since GPA_BeginSampling was last called.
+    /// Records whether or not the counter selection changed since the passes were last computed.
     bool m_counterSelectionChanged;
 
+    /// Records whether the passes changed since BeginProfile was last called, so that the data requests made for the previous passes are not reused.
+    /// Unlike m_counterSelectionChanged, it is not cleared when the passes are computed, since they are computed whenever the pass count is queried.
+    bool m_passesChanged;
+
     /// List of passes, which are identified by a list of counter indices which are in that pass.
     /// Populated when GetNumRequiredPasses is called.
     GPACounterPassList m_passPartitions;
 
     /// As the profile is happening, this tracks the current pass.
     unsigned int m_passIndex;
+
+    /// The most recently computed pass plans, most recently used first.
+    GPA_CounterPassPlanList m_passPlanCache;
+
+    /// The number of times a pass plan was found in m_passPlanCache.
+    gpa_uint32 m_passPlanCacheHits;
+
+    /// The number of times the enabled counters had to be split because their pass plan was not in m_passPlanCache.
+    gpa_uint32 m_passPlanCacheMisses;
+
+    /// Records whether the enabled counters are split into as few passes as possible.
+    bool m_minimizePasses;
+
+    /// Records whether m_passPartitions was computed since the counter accessor was set, so that it can be updated when counters are enabled or disabled.
+    bool m_hasPassPlan;
+
+    /// The enabled counters m_passPartitions was computed for, sorted by index.
+    std::vector<gpa_uint32> m_scheduledIndices;
+
+    /// The splitting algorithm m_passPartitions was computed for.
+    /// EnableCountersWithinPassBudget may keep passes updated by the consolidated splitter for the pass-minimizing splitter, if they are fewer.
+    GPACounterSplitterAlgorithm m_scheduledAlgorithm;
+
+    /// Records whether the next call to GetNumRequiredPasses has to split all of the enabled counters again.
+    bool m_fullSplitRequested;
+
+    /// The gather plan entries of all of the enabled counters, with the entries of each counter stored contiguously.
+    std::vector<GPA_CounterGatherEntry> m_gatherEntries;
+
+    /// The gather plan of each counter, indexed by counter index; the plans of counters that are not enabled have no entries.
+    std::vector<GPA_CounterGatherPlan> m_gatherPlans;
 };
 
 #endif //_GPA_COUNTER_GENERATOR_BASE_H_
@@ -8,14 +8,22 @@
 #include "GPACounterSchedulerCL.h"
 #include "GPACounterGeneratorSchedulerManager.h"
 
-GPA_CounterSchedulerCL::GPA_CounterSchedulerCL()
+GPA_CounterSchedulerCL::GPA_CounterSchedulerCL(bool registerScheduler)
 {
-    for (int gen = GDT_HW_GENERATION_FIRST_AMD; gen < GDT_HW_GENERATION_LAST; gen++)
+    if (registerScheduler)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_OPENCL, static_cast<GDT_HW_GENERATION>(gen), this);
+        for (int gen = GDT_HW_GENERATION_FIRST_AMD; gen < GDT_HW_GENERATION_LAST; gen++)
+        {
+            CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_OPENCL, static_cast<GDT_HW_GENERATION>(gen), this);
+        }
     }
 }
 
+GPA_ICounterScheduler* GPA_CounterSchedulerCL::CreateContextScheduler()
+{
+    return new(std::nothrow) GPA_CounterSchedulerCL(false);
+}
+
 GPACounterSplitterAlgorithm GPA_CounterSchedulerCL::GetPreferredSplittingAlgorithm()
 {
     return CONSOLIDATED;
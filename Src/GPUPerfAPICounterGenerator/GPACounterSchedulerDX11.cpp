@@ -10,16 +10,24 @@
 #include "GPACounterSchedulerDX11.h"
 #include "GPACounterGeneratorSchedulerManager.h"
 
-GPA_CounterSchedulerDX11::GPA_CounterSchedulerDX11()
+GPA_CounterSchedulerDX11::GPA_CounterSchedulerDX11(bool registerScheduler)
 {
-    CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_DIRECTX_11, GDT_HW_GENERATION_NVIDIA, this, false);
-
-    for (int gen = GDT_HW_GENERATION_INTEL; gen < GDT_HW_GENERATION_LAST; gen++)
+    if (registerScheduler)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_DIRECTX_11, static_cast<GDT_HW_GENERATION>(gen), this);
+        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_DIRECTX_11, GDT_HW_GENERATION_NVIDIA, this, false);
+
+        for (int gen = GDT_HW_GENERATION_INTEL; gen < GDT_HW_GENERATION_LAST; gen++)
+        {
+            CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_DIRECTX_11, static_cast<GDT_HW_GENERATION>(gen), this);
+        }
     }
 }
 
+GPA_ICounterScheduler* GPA_CounterSchedulerDX11::CreateContextScheduler()
+{
+    return new(std::nothrow) GPA_CounterSchedulerDX11(false);
+}
+
 GPA_Status GPA_CounterSchedulerDX11::EnableCounter(gpa_uint32 index)
 {
     GPA_Status status = GPA_CounterSchedulerBase::EnableCounter(index);
@@ -15,7 +15,12 @@ class GPA_CounterSchedulerDX11 : public GPA_CounterSchedulerBase
 {
 public:
     /// Constructor
-    GPA_CounterSchedulerDX11();
+    /// \param registerScheduler true to register the scheduler with the CounterGeneratorSchedulerManager, false for the scheduler of a single context
+    explicit GPA_CounterSchedulerDX11(bool registerScheduler = true);
+
+    /// Creates a DirectX 11 scheduler for a single context
+    /// \return the new scheduler, which the caller must delete, or nullptr if it could not be created
+    virtual GPA_ICounterScheduler* CreateContextScheduler();
 
     /// Overridden methods -- see base for documentation
     virtual GPA_Status EnableCounter(gpa_uint32 index);
@@ -8,14 +8,22 @@
 #include "GPACounterSchedulerDX12.h"
 #include "GPACounterGeneratorSchedulerManager.h"
 
-GPA_CounterSchedulerDX12::GPA_CounterSchedulerDX12()
+GPA_CounterSchedulerDX12::GPA_CounterSchedulerDX12(bool registerScheduler)
 {
-    for (int gen = GDT_HW_GENERATION_NVIDIA; gen < GDT_HW_GENERATION_LAST; gen++)
+    if (registerScheduler)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_DIRECTX_12, static_cast<GDT_HW_GENERATION>(gen), this);
+        for (int gen = GDT_HW_GENERATION_NVIDIA; gen < GDT_HW_GENERATION_LAST; gen++)
+        {
+            CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_DIRECTX_12, static_cast<GDT_HW_GENERATION>(gen), this);
+        }
     }
 }
 
+GPA_ICounterScheduler* GPA_CounterSchedulerDX12::CreateContextScheduler()
+{
+    return new(std::nothrow) GPA_CounterSchedulerDX12(false);
+}
+
 GPACounterSplitterAlgorithm GPA_CounterSchedulerDX12::GetPreferredSplittingAlgorithm()
 {
     return CONSOLIDATED_DX12;
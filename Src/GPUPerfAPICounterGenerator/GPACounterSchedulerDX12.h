@@ -15,7 +15,12 @@ class GPA_CounterSchedulerDX12 : public GPA_CounterSchedulerBase
 {
 public:
     /// Constructor
-    GPA_CounterSchedulerDX12();
+    /// \param registerScheduler true to register the scheduler with the CounterGeneratorSchedulerManager, false for the scheduler of a single context
+    explicit GPA_CounterSchedulerDX12(bool registerScheduler = true);
+
+    /// Creates a DirectX 12 scheduler for a single context
+    /// \return the new scheduler, which the caller must delete, or nullptr if it could not be created
+    virtual GPA_ICounterScheduler* CreateContextScheduler();
 
 protected:
     /// For DirectX 12, the preferred splitting algorithm is the consolidated one.
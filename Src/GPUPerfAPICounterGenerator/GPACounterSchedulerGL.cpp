@@ -8,21 +8,29 @@
 #include "GPACounterSchedulerGL.h"
 #include "GPACounterGeneratorSchedulerManager.h"
 
-GPA_CounterSchedulerGL::GPA_CounterSchedulerGL()
+GPA_CounterSchedulerGL::GPA_CounterSchedulerGL(bool registerScheduler)
 {
-    // TODO: need to make some changes to support GPUTime counter on non-AMD in public build
-    for (int gen = GDT_HW_GENERATION_FIRST_AMD; gen < GDT_HW_GENERATION_LAST; gen++)
+    if (registerScheduler)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_OPENGL, static_cast<GDT_HW_GENERATION>(gen), this);
-    }
+        // TODO: need to make some changes to support GPUTime counter on non-AMD in public build
+        for (int gen = GDT_HW_GENERATION_FIRST_AMD; gen < GDT_HW_GENERATION_LAST; gen++)
+        {
+            CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_OPENGL, static_cast<GDT_HW_GENERATION>(gen), this);
+        }
 
-    // AMD only for GLES (for now) -- will allow non-AMD once GPUTime is supported in public builds
-    for (int gen = GDT_HW_GENERATION_FIRST_AMD; gen < GDT_HW_GENERATION_LAST; gen++)
-    {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_OPENGLES, static_cast<GDT_HW_GENERATION>(gen), this);
+        // AMD only for GLES (for now) -- will allow non-AMD once GPUTime is supported in public builds
+        for (int gen = GDT_HW_GENERATION_FIRST_AMD; gen < GDT_HW_GENERATION_LAST; gen++)
+        {
+            CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_OPENGLES, static_cast<GDT_HW_GENERATION>(gen), this);
+        }
     }
 }
 
+GPA_ICounterScheduler* GPA_CounterSchedulerGL::CreateContextScheduler()
+{
+    return new(std::nothrow) GPA_CounterSchedulerGL(false);
+}
+
 GPACounterSplitterAlgorithm GPA_CounterSchedulerGL::GetPreferredSplittingAlgorithm()
 {
     return CONSOLIDATED;
@@ -15,7 +15,12 @@ class GPA_CounterSchedulerGL : public GPA_CounterSchedulerBase
 {
 public:
     /// Constructor
-    GPA_CounterSchedulerGL();
+    /// \param registerScheduler true to register the scheduler with the CounterGeneratorSchedulerManager, false for the scheduler of a single context
+    explicit GPA_CounterSchedulerGL(bool registerScheduler = true);
+
+    /// Creates a GL scheduler for a single context
+    /// \return the new scheduler, which the caller must delete, or nullptr if it could not be created
+    virtual GPA_ICounterScheduler* CreateContextScheduler();
 
 protected:
     /// For GL, the preferred splitting algorithm is the consolidated one.
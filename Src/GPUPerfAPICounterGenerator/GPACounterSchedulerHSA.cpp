@@ -8,14 +8,22 @@
 #include "GPACounterSchedulerHSA.h"
 #include "GPACounterGeneratorSchedulerManager.h"
 
-GPA_CounterSchedulerHSA::GPA_CounterSchedulerHSA()
+GPA_CounterSchedulerHSA::GPA_CounterSchedulerHSA(bool registerScheduler)
 {
-    for (int gen = GDT_HW_GENERATION_SEAISLAND; gen < GDT_HW_GENERATION_LAST; gen++)
+    if (registerScheduler)
     {
-        CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_HSA, static_cast<GDT_HW_GENERATION>(gen), this);
+        for (int gen = GDT_HW_GENERATION_SEAISLAND; gen < GDT_HW_GENERATION_LAST; gen++)
+        {
+            CounterGeneratorSchedulerManager::Instance()->RegisterCounterScheduler(GPA_API_HSA, static_cast<GDT_HW_GENERATION>(gen), this);
+        }
     }
 }
 
+GPA_ICounterScheduler* GPA_CounterSchedulerHSA::CreateContextScheduler()
+{
+    return new(std::nothrow) GPA_CounterSchedulerHSA(false);
+}
+
 GPACounterSplitterAlgorithm GPA_CounterSchedulerHSA::GetPreferredSplittingAlgorithm()
 {
     return CONSOLIDATED;
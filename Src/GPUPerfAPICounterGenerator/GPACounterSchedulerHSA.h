@@ -15,7 +15,12 @@ class GPA_CounterSchedulerHSA : public GPA_CounterSchedulerBase
 {
 public:
     /// Constructor
-    GPA_CounterSchedulerHSA();
+    /// \param registerScheduler true to register the scheduler with the CounterGeneratorSchedulerManager, false for the scheduler of a single context
+    explicit GPA_CounterSchedulerHSA(bool registerScheduler = true);
+
+    /// Creates a HSA scheduler for a single context
+    /// \return the new scheduler, which the caller must delete, or nullptr if it could not be created
+    virtual GPA_ICounterScheduler* CreateContextScheduler();
 
 protected:
 
@@ -8,6 +8,10 @@
 #ifndef _GPA_HARDWARE_COUNTERS_H_
 #define _GPA_HARDWARE_COUNTERS_H_
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
 #include "GPAInternalCounter.h"
 
 /// Struct to describe a hardware counter
@@ -39,6 +43,10 @@ public:
     {
         m_currentGroupUsedCounts.clear();
         m_counters.clear();
+        m_groupCounterStarts.clear();
+        m_groupCounters.clear();
+        m_groupCountersGenerated.reset();
+        m_isGenerationDeferred = false;
         m_ppCounterGroupArray = nullptr;
         m_pGroups = nullptr;
         m_groupCount = 0;
@@ -60,6 +68,11 @@ public:
     /// \return the number of hardware counters
     gpa_uint32 GetNumCounters()
     {
+        if (m_isGenerationDeferred)
+        {
+            return m_groupCounterStarts.back();
+        }
+
         return (gpa_uint32)m_counters.size();
     }
 
@@ -68,7 +81,7 @@ public:
     /// \return the name of the specified counter
     const char* GetCounterName(gpa_uint32 index)
     {
-        return m_counters[index].m_pHardwareCounter->m_pName;
+        return GetHardwareCounterDesc(index)->m_pName;
     }
 
     /// Gets the description of the specified counter
@@ -76,7 +89,58 @@ public:
     /// \return the description of the specified counter
     const char* GetCounterDescription(gpa_uint32 index)
     {
-        return m_counters[index].m_pHardwareCounter->m_pDescription;
+        return GetHardwareCounterDesc(index)->m_pDescription;
+    }
+
+    /// Sets up the counters of m_pGroups without generating their descriptors.
+    /// The descriptors of a group are generated the first time one of its counters is accessed through GetCounter,
+    /// using the group index as the driver group ID. Names and descriptions are read straight from the group tables.
+    void DeferCounterGeneration()
+    {
+        m_counters.clear();
+        m_groupCounters.clear();
+        m_groupCounters.resize(m_groupCount);
+        m_groupCountersGenerated.reset(new std::once_flag[m_groupCount]);
+        m_groupCounterStarts.resize(m_groupCount + 1);
+        m_groupCounterStarts[0] = 0;
+
+        for (unsigned int i = 0; i < m_groupCount; i++)
+        {
+            m_groupCounterStarts[i + 1] = m_groupCounterStarts[i] + (gpa_uint32)m_pGroups[i].m_numCounters;
+        }
+
+        m_isGenerationDeferred = true;
+    }
+
+    /// Gets the descriptor of the specified counter, generating the descriptors of its group if needed.
+    /// A group is generated only once, even if its counters are first accessed from several threads at the same time.
+    /// \param index the index of the counter
+    /// \return the descriptor of the counter
+    GPA_HardwareCounterDescExt* GetCounter(gpa_uint32 index)
+    {
+        if (!m_isGenerationDeferred)
+        {
+            return &m_counters[index];
+        }
+
+        gpa_uint32 groupIndex = GetGroupOfCounter(index);
+        std::vector<GPA_HardwareCounterDescExt>& groupCounters = m_groupCounters[groupIndex];
+
+        std::call_once(m_groupCountersGenerated[groupIndex], [&]()
+        {
+            gpa_uint32 numGroupCounters = m_groupCounterStarts[groupIndex + 1] - m_groupCounterStarts[groupIndex];
+            groupCounters.resize(numGroupCounters);
+
+            for (gpa_uint32 i = 0; i < numGroupCounters; i++)
+            {
+                groupCounters[i].m_groupIndex = groupIndex;
+                groupCounters[i].m_groupIdDriver = groupIndex;
+                groupCounters[i].m_counterIdDriver = 0;
+                groupCounters[i].m_pHardwareCounter = &(m_ppCounterGroupArray[groupIndex][i]);
+            }
+        });
+
+        return &groupCounters[index - m_groupCounterStarts[groupIndex]];
     }
 
     /// List of counter groups as defined by the list of internal counters in each group.
@@ -112,11 +176,48 @@ public:
     /// indicates that the internal counters have been generated
     bool m_countersGenerated;
 
-    /// vector of hardware counters
+    /// vector of hardware counters (empty if generation is deferred -- use GetCounter to access a counter)
     std::vector<GPA_HardwareCounterDescExt> m_counters;
 
     /// List of the number of counters which have been enabled in each group
     std::vector<int> m_currentGroupUsedCounts;
+
+private:
+
+    /// Gets the group containing a counter when generation is deferred
+    /// \param index the index of the counter
+    /// \return the index of the group
+    gpa_uint32 GetGroupOfCounter(gpa_uint32 index) const
+    {
+        // the last group starting at or before the index; empty groups share their start with the next group
+        return (gpa_uint32)(std::upper_bound(m_groupCounterStarts.begin(), m_groupCounterStarts.end(), index) - m_groupCounterStarts.begin()) - 1;
+    }
+
+    /// Gets the internal counter table entry of the specified counter, without generating its descriptor
+    /// \param index the index of the counter
+    /// \return the internal counter table entry
+    const GPA_HardwareCounterDesc* GetHardwareCounterDesc(gpa_uint32 index) const
+    {
+        if (!m_isGenerationDeferred)
+        {
+            return m_counters[index].m_pHardwareCounter;
+        }
+
+        gpa_uint32 groupIndex = GetGroupOfCounter(index);
+        return &(m_ppCounterGroupArray[groupIndex][index - m_groupCounterStarts[groupIndex]]);
+    }
+
+    /// Index of the first counter of each group, plus the total number of counters (only used when generation is deferred)
+    std::vector<gpa_uint32> m_groupCounterStarts;
+
+    /// Descriptors of each group, generated on first access (only used when generation is deferred)
+    std::vector< std::vector<GPA_HardwareCounterDescExt> > m_groupCounters;
+
+    /// Flags of each group in m_groupCounters, set once the descriptors of the group are generated (only used when generation is deferred)
+    std::unique_ptr<std::once_flag[]> m_groupCountersGenerated;
+
+    /// indicates that the counter descriptors are generated per group on first access instead of being listed in m_counters
+    bool m_isGenerationDeferred;
 };
 
 #endif //_GPA_HARDWARE_COUNTERS_H_
@@ -83,6 +83,9 @@ public:
     /// \return A vector of internal counter indices
     virtual std::vector<gpa_uint32> GetInternalCountersRequired(gpa_uint32 index) = 0;
 
+    /// Prepares the public counters for ComputePublicCounterValue, which does not check whether they are prepared
+    virtual void ExpandPublicCounters() = 0;
+
     /// Computes a public counter value pased on supplied results and hardware info
     /// \param[in] counterIndex The public counter index to calculate
     /// \param[in] results A vector of hardware counter results
@@ -17,11 +17,34 @@
 
 typedef std::map<unsigned int, GPA_CounterResultLocation> CounterResultLocationMap; ///< typedef for map of Counter Result Locations
 
+/// The location and type of one of the internal results an enabled counter is computed from
+struct GPA_CounterGatherEntry
+{
+    gpa_uint16 m_pass;   ///< index of the pass which contains the internal result
+    gpa_uint16 m_offset; ///< offset of the internal result within the pass
+    GPA_Type m_type;     ///< the type of the internal result
+};
+
+/// The internal results an enabled counter is computed from, in the order its equation expects them
+struct GPA_CounterGatherPlan
+{
+    const GPA_CounterGatherEntry* m_pEntries; ///< the location and type of each internal result
+    gpa_uint32 m_numEntries;                  ///< the number of entries in m_pEntries
+};
+
 /// An interface for enabling and disabling counters and getting the resulting number of necessary passes
 class GPA_ICounterScheduler
 {
 public:
 
+    /// Virtual destructor
+    virtual ~GPA_ICounterScheduler() {};
+
+    /// Creates a scheduler of the same type with no counters enabled, for a single context.
+    /// Each context schedules its counters with its own scheduler, so that the enabled counters and passes of one context do not change those of another.
+    /// \return the new scheduler, which the caller must delete, or nullptr if it could not be created
+    virtual GPA_ICounterScheduler* CreateContextScheduler() = 0;
+
     /// Reset the counter scheduler
     virtual void Reset() = 0;
 
@@ -66,7 +89,8 @@ public:
     /// \return GPA_STATUS_OK on success
     virtual GPA_Status GetNumRequiredPasses(gpa_uint32* pNumRequiredPassesOut) = 0;
 
-    /// Get a flag indicating if the counter selection has changed
+    /// Get a flag indicating if the counters in the passes have changed since profiling last began.
+    /// The data requests of the previous passes cannot be reused once they have.
     /// \return true if the counter selection has changed, false otherwise
     virtual bool GetCounterSelectionChanged() = 0;
 
@@ -97,6 +121,49 @@ public:
     /// Set draw call counts (internal support)
     /// \param iCounts the count of draw calls
     virtual void SetDrawCallCounts(const int iCounts) = 0;
+
+    /// Gets how often the pass plan for the enabled counters was found in the cache of previously computed plans
+    /// \param[out] pHits the number of times GetNumRequiredPasses reused a cached plan
+    /// \param[out] pMisses the number of times GetNumRequiredPasses had to split the enabled counters
+    virtual void GetPassPlanCacheStatistics(gpa_uint32* pHits, gpa_uint32* pMisses) = 0;
+
+    /// Sets whether the enabled counters are split into as few passes as possible.
+    /// Searching for the fewest passes takes longer than the splitting algorithm preferred by the API, but every pass saved is a replay of the workload saved.
+    /// \param minimizePasses true to search for the fewest passes, false to use the splitting algorithm preferred by the API
+    virtual void SetMinimizePasses(bool minimizePasses) = 0;
+
+    /// Makes the next call to GetNumRequiredPasses split all of the enabled counters again.
+    /// Otherwise, when only a few counters are enabled or disabled, the existing passes are updated for them, which is faster but may need more passes than a full split.
+    virtual void RequestFullSplit() = 0;
+
+    /// Obtains the number of passes the active splitting algorithm needs to collect a set of counters, without changing the enabled counters or the current passes
+    /// \param pCounterIndices the indices of the counters to split
+    /// \param counterCount the number of counters in pCounterIndices
+    /// \param[out] pNumRequiredPassesOut Will contain the number of passes needed to collect the counters
+    /// \return GPA_STATUS_OK on success
+    virtual GPA_Status GetNumRequiredPassesForCounters(const gpa_uint32* pCounterIndices, gpa_uint32 counterCount, gpa_uint32* pNumRequiredPassesOut) = 0;
+
+    /// Gets the passes the results of an enabled counter are collected in. Two enabled counters share a pass if both are collected in it.
+    /// \param counterIndex the index of the enabled counter
+    /// \param[out] pPasses array that will contain 1 for each pass the counter is collected in, and 0 for the other passes
+    /// \param passCount the number of elements in pPasses, which must be at least the number of required passes
+    /// \return GPA_STATUS_OK on success
+    virtual GPA_Status GetCounterPassAffinity(gpa_uint32 counterIndex, gpa_uint8* pPasses, gpa_uint32 passCount) = 0;
+
+    /// Disables all counters, then enables the highest priority counters that can be collected within a number of passes.
+    /// Each counter is enabled if it fits in the budget together with the higher priority counters already enabled, otherwise it is skipped.
+    /// \param pCounterIndices the indices of the counters to enable, highest priority first
+    /// \param counterCount the number of counters in pCounterIndices
+    /// \param maxPasses the maximum number of passes the enabled counters may require
+    /// \param[out] pNumEnabledOut Will contain the number of counters that were enabled
+    /// \return GPA_STATUS_OK on success
+    virtual GPA_Status EnableCountersWithinPassBudget(const gpa_uint32* pCounterIndices, gpa_uint32 counterCount, gpa_uint32 maxPasses, gpa_uint32* pNumEnabledOut) = 0;
+
+    /// Gets where the internal results of an enabled counter are located in the passes computed by the last call to GetNumRequiredPasses.
+    /// The plan does not change until the passes are computed again, so results can be gathered from it without any lookups.
+    /// \param counterIndex the index of the enabled counter
+    /// \return the gather plan of the counter, or nullptr if the counter was not enabled when the passes were computed
+    virtual const GPA_CounterGatherPlan* GetCounterGatherPlan(gpa_uint32 counterIndex) = 0;
 };
 
 #endif //_GPA_I_COUNTER_SCHEDULER_H_
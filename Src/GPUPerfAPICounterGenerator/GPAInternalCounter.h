@@ -8,6 +8,9 @@
 #ifndef _GPA_INTERNAL_COUNTER_H_
 #define _GPA_INTERNAL_COUNTER_H_
 
+#include <algorithm>
+#include <vector>
+
 #include "GPUPerfAPITypes.h"
 #include "GPASplitCountersInterfaces.h"
 
@@ -57,10 +60,20 @@ struct GPA_SoftwareCounterDesc
 };
 
 /// Indexes into an array of internal groups and counters and can access data from the internal counter.
+/// The accessor is not modified after it is constructed, so one accessor can be shared between threads.
 class GPACounterGroupAccessor : IGPACounterAccessor
 {
 public:
 
+    /// Initializes a new instance of the GPACounterGroupAccessor class with no counter groups.
+    GPACounterGroupAccessor()
+        : m_hardwareGroupCount(0),
+          m_hardwareAdditionalGroupCount(0),
+          m_hardwareCounterCount(0),
+          m_groupCounterStarts(1, 0)
+    {
+    };
+
     /// Initializes a new instance of the GPACounterGroupAccessor class.
     GPACounterGroupAccessor(GPA_CounterGroupDesc* pHardwareGroups,
                             unsigned int hardwareGroupCount,
@@ -68,210 +81,89 @@ public:
                             unsigned int hardwareAdditionalGroupCount,
                             GPA_CounterGroupDesc* pSoftwareGroups,
                             unsigned int softwareGroupCount)
-        : m_pHardwareGroups(pHardwareGroups),
-          m_hardwareGroupCount(hardwareGroupCount),
-          m_pHardwareAdditionalGroups(pHardwareAdditionalGroups),
+        : m_hardwareGroupCount(hardwareGroupCount),
           m_hardwareAdditionalGroupCount(hardwareAdditionalGroupCount),
-          m_pSoftwareGroups(pSoftwareGroups),
-          m_softwareGroupCount(softwareGroupCount),
-          m_groupIndex(0),
-          m_counterIndex(0)
-    {
-    };
-
-    /// Destructor
-    virtual ~GPACounterGroupAccessor() {};
-
-    /// Sets the counter index of which to get the group and counter Id.
-    /// \param index The counter index.
-    void SetCounterIndex(unsigned int index)
+          m_hardwareCounterCount(0)
     {
-        // count the number of counters that belong to groups that do not include the desired index
-        unsigned int prevGroupCounters = 0;
-        unsigned int tmpSum = 0;
-
-        m_isHW = false;
-        m_isAdditionalHW = false;
-        m_isSW = false;
+        // software counters all belong to the first software group, so only the hardware and additional groups are indexed
+        UNREFERENCED_PARAMETER(pSoftwareGroups);
+        UNREFERENCED_PARAMETER(softwareGroupCount);
 
-        unsigned int internalCounters = 0;
+        m_groupCounterStarts.reserve(hardwareGroupCount + hardwareAdditionalGroupCount + 1);
+        m_groupCounterStarts.push_back(0);
 
-        for (unsigned int i = 0; i < m_hardwareGroupCount; ++i)
+        for (unsigned int i = 0; i < hardwareGroupCount; ++i)
         {
-            internalCounters += (unsigned int)m_pHardwareGroups[i].m_numCounters;
+            m_groupCounterStarts.push_back(m_groupCounterStarts.back() + (unsigned int)pHardwareGroups[i].m_numCounters);
         }
 
-        for (unsigned int i = 0; i < m_hardwareGroupCount; ++i)
-        {
-            tmpSum = prevGroupCounters + (unsigned int)m_pHardwareGroups[i].m_numCounters;
+        m_hardwareCounterCount = m_groupCounterStarts.back();
 
-            if (tmpSum > index)
-            {
-                // this group contains the desired counter index.
-                // this is the right group, and we can calculate the right counter.
-                this->m_groupIndex = i;
-                this->m_counterIndex = index - prevGroupCounters;
+        for (unsigned int i = 0; i < hardwareAdditionalGroupCount; ++i)
+        {
+            m_groupCounterStarts.push_back(m_groupCounterStarts.back() + (unsigned int)pHardwareAdditionalGroups[i].m_numCounters);
+        }
+    };
 
-                // This is a HW counter
-                m_isHW = true;
+    /// Destructor
+    virtual ~GPACounterGroupAccessor() {};
 
-                // break from the loop
-                break;
-            }
-            else
-            {
-                // this group does not include the desired counter index.
-                // update the count and let the loop continue.
-                prevGroupCounters = tmpSum;
-            }
-        }
+    /// Gets the group and counter of an internal counter.
+    /// \param index The global index of the internal counter.
+    /// \return The location of the counter.
+    virtual GPACounterGroupLocation GetCounterLocation(unsigned int index) const
+    {
+        GPACounterGroupLocation location = { 0, 0, 0, false, false, false };
 
-        if (m_isHW == true)
+        if (index < m_groupCounterStarts.back())
         {
-            return;
-        }
+            // the counter belongs to the last group that starts at or before the index (an empty group starts at the same index as the next group, so it is never found)
+            std::vector<unsigned int>::const_iterator groupStartIter = std::upper_bound(m_groupCounterStarts.begin(), m_groupCounterStarts.end(), index) - 1;
+            unsigned int globalGroupIndex = static_cast<unsigned int>(groupStartIter - m_groupCounterStarts.begin());
 
-        for (unsigned int i = 0; i < m_hardwareAdditionalGroupCount; ++i)
-        {
-            tmpSum = prevGroupCounters + (unsigned int)m_pHardwareAdditionalGroups[i].m_numCounters;
+            location.m_counterIndex = index - *groupStartIter;
+            location.m_globalGroupIndex = globalGroupIndex;
 
-            if (tmpSum > index)
+            if (globalGroupIndex < m_hardwareGroupCount)
             {
-                // this group contains the desired counter index.
-                // this is the right group, and we can calculate the right counter.
-                this->m_groupIndex = i;
-                this->m_counterIndex = index - prevGroupCounters;
-
-                // This is an additional HW counter
-                m_isAdditionalHW = true;
-
-                // break from the loop
-                break;
+                location.m_groupIndex = globalGroupIndex;
+                location.m_isHW = true;
             }
             else
             {
-                // this group does not include the desired counter index.
-                // update the count and let the loop continue.
-                prevGroupCounters = tmpSum;
+                // additional groups come after the hardware groups
+                location.m_groupIndex = globalGroupIndex - m_hardwareGroupCount;
+                location.m_isAdditionalHW = true;
             }
-        }
 
-        if (m_isAdditionalHW == true)
-        {
-            return;
+            return location;
         }
 
 #if defined(WIN32)
 
-        this->m_groupIndex = 0;
-        m_isSW = true;
-
-        if (index >= internalCounters)
-        {
-            this->m_counterIndex = index - internalCounters;
-        }
-        else
-        {
-            this->m_counterIndex = index;
-        }
-
-        return;
+        location.m_groupIndex = 0;
+        location.m_counterIndex = index - m_hardwareCounterCount;
+        location.m_globalGroupIndex = m_hardwareAdditionalGroupCount;
+        location.m_isSW = true;
 
 #endif // WIN32
 
-    }
-
-    /// Get the 0-based group index of the internal counter.
-    /// \return The group index.
-    virtual unsigned int GroupIndex() const
-    {
-        return this->m_groupIndex;
-    };
-
-    /// Get the 0-based counter index of the internal counter.
-    /// \return The counter index.
-    virtual unsigned int CounterIndex() const
-    {
-        return this->m_counterIndex;
-    };
-
-    /// Get the hardware counter bool
-    /// \return True if the counter is a hardware counter
-    bool IsHWCounter() const
-    {
-        return m_isHW;
-    }
-
-    /// Get the additional hardware counter bool
-    /// \return True if the counter is an additional hardware counter (one exposed by the driver, but not by GPA)
-    bool IsAdditionalHWCounter() const
-    {
-        return m_isAdditionalHW;
-    }
-
-    /// Get the software counter bool
-    /// \return True if the counter is a software counter
-    bool IsSWCounter() const
-    {
-        return m_isSW;
-    }
-
-    /// Get the global group group index (the full index of the software groups that come after the hardware groups)
-    /// \return The total number of groups
-    unsigned int GlobalGroupIndex() const
-    {
-        unsigned int globalGroupIndex = GroupIndex();
-
-        if (m_isAdditionalHW)
-        {
-            // If this is a software counter then add in the HW group count
-            globalGroupIndex += m_hardwareGroupCount;
-        }
-
-        if (m_isSW)
-        {
-            // If this is a software counter then add in the HW group count
-            globalGroupIndex += m_hardwareAdditionalGroupCount;
-        }
-
-        return globalGroupIndex;
+        return location;
     }
 
 private:
 
-    /// Points to the array of internal counter groups
-    GPA_CounterGroupDesc* m_pHardwareGroups;
-
-    /// stores the number of groups in the array.
+    /// stores the number of hardware groups.
     unsigned int m_hardwareGroupCount;
 
-
-    /// Points to the array of internal counter groups
-    GPA_CounterGroupDesc* m_pHardwareAdditionalGroups;
-
-    /// stores the number of groups in the array.
+    /// stores the number of additional hardware groups.
     unsigned int m_hardwareAdditionalGroupCount;
 
-    /// Points to the array of internal counter groups
-    GPA_CounterGroupDesc* m_pSoftwareGroups;
-
-    /// stores the number of groups in the array.
-    unsigned int m_softwareGroupCount;
-
-    /// Stores the group index of the set counter index.
-    unsigned int m_groupIndex;
-
-    /// Stores the counter index within the group of the set counter index.
-    unsigned int m_counterIndex;
-
-    /// bool to record if the counter is HW
-    bool m_isHW;
-
-    /// bool to record if the counter is an additional HW counter (one exposed by the driver but not by GPA)
-    bool m_isAdditionalHW;
+    /// stores the number of counters in the hardware groups (the index of the first counter after them).
+    unsigned int m_hardwareCounterCount;
 
-    /// bool to record if the counter is SW
-    bool m_isSW;
+    /// The global index of the first counter of each hardware group followed by each additional group, and the number of counters in all of them.
+    std::vector<unsigned int> m_groupCounterStarts;
 };
 
 #endif //_GPA_INTERNAL_COUNTER_H_
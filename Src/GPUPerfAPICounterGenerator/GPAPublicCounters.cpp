@@ -13,47 +13,318 @@
 #include "Utility.h"
 #include "Logging.h"
 
-GPA_PublicCounter::GPA_PublicCounter(unsigned int index, const char* pName, const char* pDescription, GPA_Type dataType, GPA_Usage_Type usageType, GPA_CounterType counterType, vector< gpa_uint32 >& internalCountersRequired, const char* pComputeExpression)
+GPA_PublicCounter::GPA_PublicCounter(unsigned int index, const GPA_PublicCounterDef& definition, const gpa_uint32* pInternalCounters)
 {
     m_index = index;
-    m_pName = pName;
-    m_pDescription = pDescription;
-    m_dataType = dataType;
-    m_usageType = usageType;
-    m_counterType = counterType;
-    m_internalCountersRequired = internalCountersRequired;
-    m_pComputeExpression = pComputeExpression;
+    m_pName = definition.m_pName;
+    m_pDescription = definition.m_pDescription;
+    m_dataType = definition.m_dataType;
+    m_usageType = definition.m_usageType;
+    m_counterType = definition.m_counterType;
+    m_pInternalCountersRequired = pInternalCounters + definition.m_internalCounterOffset;
+    m_numInternalCountersRequired = definition.m_numInternalCounters;
+    m_pComputeExpression = definition.m_pComputeExpression;
+    m_pProgram = nullptr;
+    m_programLength = 0;
+    m_programOffset = 0;
 }
 
 
 //------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-void GPA_PublicCounters::DefinePublicCounter(const char* pName, const char* pDescription, GPA_Type dataType, GPA_Usage_Type usageType, GPA_CounterType counterType, vector< gpa_uint32 >& internalCountersRequired, const char* pComputeExpression)
+/// The deepest evaluation stack a compiled expression may require
+static const size_t MAX_EXPRESSION_STACK_DEPTH = 128;
+
+/// Parses a constant token of the form "(value)" as the public counter's data type
+/// \param pToken the constant token
+/// \param dataType the data type of the public counter
+/// \param[out] constant the parsed constant
+/// \return true if the constant was parsed successfully
+static bool ParseExpressionConstant(const char* pToken, GPA_Type dataType, GPA_CounterExpressionConstant& constant)
+{
+    int scanResult = 0;
+
+    if (dataType == GPA_TYPE_FLOAT32)
+    {
+#ifdef _LINUX
+        scanResult = sscanf(pToken, "(%f)", &constant.m_float32);
+#else
+        scanResult = sscanf_s(pToken, "(%f)", &constant.m_float32);
+#endif // _LINUX
+    }
+    else if (dataType == GPA_TYPE_FLOAT64)
+    {
+#ifdef _LINUX
+        scanResult = sscanf(pToken, "(%lf)", &constant.m_float64);
+#else
+        scanResult = sscanf_s(pToken, "(%lf)", &constant.m_float64);
+#endif // _LINUX
+    }
+    else if (dataType == GPA_TYPE_UINT32)
+    {
+#ifdef _LINUX
+        scanResult = sscanf(pToken, "(%u)", &constant.m_uint32);
+#else
+        scanResult = sscanf_s(pToken, "(%u)", &constant.m_uint32);
+#endif // _LINUX
+    }
+    else if (dataType == GPA_TYPE_UINT64)
+    {
+#ifdef _LINUX
+        scanResult = sscanf(pToken, "(%llu)", &constant.m_uint64);
+#else
+        scanResult = sscanf_s(pToken, "(%I64u)", &constant.m_uint64);
+#endif // _LINUX
+    }
+    else
+    {
+        // Unsupported public counter type
+        assert(false);
+    }
+
+    return scanResult == 1;
+}
+
+/// Compiles a public counter's compute expression into a list of instructions that can be evaluated without any string handling
+/// \param counter the public counter whose m_pComputeExpression should be compiled; its program offset and length are set
+/// \param programs the compiled programs, to which the counter's instructions are appended
+/// \return true if the expression was compiled successfully
+static bool CompileExpression(GPA_PublicCounter& counter, vector< GPA_CounterExpressionInstruction >& programs)
+{
+    /// Keywords that reduce a fixed number of values on the stack
+    struct ReductionKeyword
+    {
+        const char* m_pKeyword;       ///< the keyword as it appears in an expression
+        GPA_CounterExpressionOp m_op; ///< the reduction operation
+        gpa_uint32 m_count;           ///< the number of values reduced
+    };
+
+    static const ReductionKeyword s_reductionKeywords[] =
+    {
+        { "max16", EXPR_OP_MAX_N, 16 },
+        { "max32", EXPR_OP_MAX_N, 32 },
+        { "max44", EXPR_OP_MAX_N, 44 },
+        { "max64", EXPR_OP_MAX_N, 64 },
+        { "sum4", EXPR_OP_SUM_N, 4 },
+        { "sum8", EXPR_OP_SUM_N, 8 },
+        { "sum10", EXPR_OP_SUM_N, 10 },
+        { "sum11", EXPR_OP_SUM_N, 11 },
+        { "sum12", EXPR_OP_SUM_N, 12 },
+        { "sum16", EXPR_OP_SUM_N, 16 },
+        { "sum32", EXPR_OP_SUM_N, 32 },
+        { "sum44", EXPR_OP_SUM_N, 44 },
+        { "sum64", EXPR_OP_SUM_N, 64 },
+    };
+
+    size_t programOffset = programs.size();
+    counter.m_programOffset = static_cast<gpa_uint32>(programOffset);
+    counter.m_programLength = 0;
+
+    if (nullptr == counter.m_pComputeExpression)
+    {
+        return false;
+    }
+
+    size_t expressionLen = strlen(counter.m_pComputeExpression) + 1;
+    char* pBuf = new(std::nothrow) char[expressionLen];
+
+    if (nullptr == pBuf)
+    {
+        return false;
+    }
+
+    strcpy_s(pBuf, expressionLen, counter.m_pComputeExpression);
+
+    bool isValid = true;
+    size_t stackDepth = 0;
+    size_t numInternalCounters = counter.m_numInternalCountersRequired;
+
+    char* pContext;
+    char* pch = strtok_s(pBuf, " ,", &pContext);
+
+    while (nullptr != pch && isValid)
+    {
+        GPA_CounterExpressionInstruction instruction;
+        instruction.m_op = EXPR_OP_PUSH_CONSTANT;
+        instruction.m_operand = 0;
+        instruction.m_constant.m_uint64 = 0;
+
+        // the number of values the instruction pops; every instruction pushes a single value
+        size_t numPopped = 0;
+
+        if (*pch == '*' || *pch == '/' || *pch == '+' || *pch == '-')
+        {
+            instruction.m_op = (*pch == '*') ? EXPR_OP_MUL : (*pch == '/') ? EXPR_OP_DIV : (*pch == '+') ? EXPR_OP_ADD : EXPR_OP_SUB;
+            numPopped = 2;
+        }
+        else if (*pch == '(')
+        {
+            instruction.m_op = EXPR_OP_PUSH_CONSTANT;
+            isValid = ParseExpressionConstant(pch, counter.m_dataType, instruction.m_constant);
+        }
+        else if (_strcmpi(pch, "num_shader_engines") == 0)
+        {
+            instruction.m_op = EXPR_OP_PUSH_NUM_SHADER_ENGINES;
+        }
+        else if (_strcmpi(pch, "num_simds") == 0)
+        {
+            instruction.m_op = EXPR_OP_PUSH_NUM_SIMDS;
+        }
+        else if (_strcmpi(pch, "su_clocks_prim") == 0)
+        {
+            instruction.m_op = EXPR_OP_PUSH_SU_CLOCKS_PRIM;
+        }
+        else if (_strcmpi(pch, "num_prim_pipes") == 0)
+        {
+            instruction.m_op = EXPR_OP_PUSH_NUM_PRIM_PIPES;
+        }
+        else if (_strcmpi(pch, "TS_FREQ") == 0)
+        {
+            instruction.m_op = EXPR_OP_PUSH_TS_FREQ;
+        }
+        else if (_strcmpi(pch, "max") == 0)
+        {
+            instruction.m_op = EXPR_OP_MAX;
+            numPopped = 2;
+        }
+        else if (_strcmpi(pch, "min") == 0)
+        {
+            instruction.m_op = EXPR_OP_MIN;
+            numPopped = 2;
+        }
+        else if (_strcmpi(pch, "ifnotzero") == 0)
+        {
+            instruction.m_op = EXPR_OP_IFNOTZERO;
+            numPopped = 3;
+        }
+        else if (*pch >= '0' && *pch <= '9')
+        {
+            // must be number, reference to internal counter
+            char* pEnd = nullptr;
+            unsigned long index = strtoul(pch, &pEnd, 10);
+
+            instruction.m_op = EXPR_OP_PUSH_COUNTER;
+            instruction.m_operand = (gpa_uint32)index;
+            isValid = ('\0' == *pEnd) && (index < numInternalCounters);
+        }
+        else
+        {
+            isValid = false;
+
+            for (size_t i = 0; i < sizeof(s_reductionKeywords) / sizeof(s_reductionKeywords[0]); i++)
+            {
+                if (_strcmpi(pch, s_reductionKeywords[i].m_pKeyword) == 0)
+                {
+                    instruction.m_op = s_reductionKeywords[i].m_op;
+                    instruction.m_operand = s_reductionKeywords[i].m_count;
+                    numPopped = s_reductionKeywords[i].m_count;
+                    isValid = true;
+                    break;
+                }
+            }
+        }
+
+        if (isValid)
+        {
+            // track the stack depth so that the interpreter never needs to check it
+            isValid = (stackDepth >= numPopped) && (stackDepth - numPopped + 1 <= MAX_EXPRESSION_STACK_DEPTH);
+            stackDepth = stackDepth - numPopped + 1;
+            programs.push_back(instruction);
+        }
+
+        pch = strtok_s(nullptr, " ,", &pContext);
+    }
+
+    delete[] pBuf;
+
+    if (!isValid || stackDepth != 1)
+    {
+        std::stringstream ss;
+        ss << "Invalid formula: " << counter.m_pComputeExpression << ".";
+        GPA_LogError(ss.str().c_str());
+
+        programs.resize(programOffset);
+        return false;
+    }
+
+    counter.m_programLength = static_cast<gpa_uint32>(programs.size() - programOffset);
+    return true;
+}
+
+void GPA_PublicCounters::DefinePublicCounters(const GPA_PublicCounterDef* pCounterDefs, gpa_uint32 numCounterDefs, const gpa_uint32* pInternalCounters)
+{
+    assert(nullptr != pCounterDefs);
+    assert(nullptr != pInternalCounters);
+    assert(nullptr == m_pCounterDefs); // only one table can be registered
+
+    m_pCounterDefs = pCounterDefs;
+    m_numCounterDefs = numCounterDefs;
+    m_pInternalCounters = pInternalCounters;
+}
+
+
+void GPA_PublicCounters::ExpandCounters()
 {
-    assert(pName);
-    assert(pDescription);
-    assert(dataType < GPA_TYPE__LAST);
-    assert(counterType < GPA_COUNTER_TYPE__LAST);
-    assert(internalCountersRequired.size() > 0);
-    assert(pComputeExpression);
-    assert(strlen(pComputeExpression) > 0);
+    if (m_countersExpanded.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_expandMutex);
+
+    if (m_countersExpanded.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    m_counters.clear();
+    m_programs.clear();
+    m_counters.reserve(m_numCounterDefs);
+
+    for (gpa_uint32 i = 0; i < m_numCounterDefs; i++)
+    {
+        const GPA_PublicCounterDef& definition = m_pCounterDefs[i];
+
+        assert(definition.m_pName);
+        assert(definition.m_pDescription);
+        assert(definition.m_dataType < GPA_TYPE__LAST);
+        assert(definition.m_counterType < GPA_COUNTER_TYPE__LAST);
+        assert(definition.m_numInternalCounters > 0);
+        assert(definition.m_pComputeExpression);
+        assert(strlen(definition.m_pComputeExpression) > 0);
 
-    unsigned int index = (unsigned int)m_counters.size();
+        unsigned int index = (unsigned int)m_counters.size();
 
-    m_counters.push_back(GPA_PublicCounter(index, pName, pDescription, dataType, usageType, counterType, internalCountersRequired, pComputeExpression));
+        m_counters.push_back(GPA_PublicCounter(index, definition, m_pInternalCounters));
+
+        CompileExpression(m_counters.back(), m_programs);
+    }
+
+    // the programs are only pointed to once they are all compiled, as compiling may move them
+    for (vector< GPA_PublicCounter >::iterator it = m_counters.begin(); it != m_counters.end(); ++it)
+    {
+        it->m_pProgram = (0 != it->m_programLength) ? &m_programs[it->m_programOffset] : nullptr;
+    }
+
+    m_countersExpanded.store(true, std::memory_order_release);
 }
 
 
 void GPA_PublicCounters::Clear()
 {
+    m_pCounterDefs = nullptr;
+    m_numCounterDefs = 0;
+    m_pInternalCounters = nullptr;
     m_counters.clear();
+    m_programs.clear();
+    m_countersExpanded = false;
     m_countersGenerated = false;
 }
 
 
 gpa_uint32 GPA_PublicCounters::GetNumCounters()
 {
-    return (gpa_uint32) m_counters.size();
+    return m_numCounterDefs;
 }
 
 
@@ -522,77 +793,244 @@ static void EvaluateExpression(const char* pExpression, void* pResult, vector< c
     delete[] pBuf;
 }
 
-void GPA_PublicCounters::ComputeCounterValue(gpa_uint32 counterIndex, vector< char* >& results, vector< GPA_Type >& internalCounterTypes, void* pResult, GPA_HWInfo* pHwInfo)
+/// Reads a pre-parsed expression constant as the public counter type
+/// \param constant the constant
+/// \return the constant value
+template<class T>
+static inline T GetExpressionConstant(const GPA_CounterExpressionConstant& constant);
+
+template<> inline gpa_float32 GetExpressionConstant(const GPA_CounterExpressionConstant& constant) { return constant.m_float32; }
+template<> inline gpa_float64 GetExpressionConstant(const GPA_CounterExpressionConstant& constant) { return constant.m_float64; }
+template<> inline gpa_uint32 GetExpressionConstant(const GPA_CounterExpressionConstant& constant) { return constant.m_uint32; }
+template<> inline gpa_uint64 GetExpressionConstant(const GPA_CounterExpressionConstant& constant) { return constant.m_uint64; }
+template<> inline gpa_int32 GetExpressionConstant(const GPA_CounterExpressionConstant& constant) { return constant.m_int32; }
+template<> inline gpa_int64 GetExpressionConstant(const GPA_CounterExpressionConstant& constant) { return constant.m_int64; }
+
+/// Evaluates a compiled counter formula
+/// T is public counter type
+/// \param counter the public counter whose compiled expression is evaluated
+/// \param[out] pResult the result value
+/// \param results list of the hardware counter results
+/// \param pHwInfo the hardware info
+template<class T, class InternalCounterType>
+static void ExecuteProgram(const GPA_PublicCounter& counter, void* pResult, vector< char* >& results, const GPA_HWInfo* pHwInfo)
 {
-    if (nullptr != m_counters[counterIndex].m_pComputeExpression)
+    assert(nullptr != pHwInfo);
+
+    T* pWriteResult = (T*)pResult;
+
+    // CompileExpression has verified the operand counts, the stack depth and the internal counter slots,
+    // so the only thing left to check is that the caller supplied all the required results
+    if (0 == counter.m_programLength || results.size() < counter.m_numInternalCountersRequired)
     {
-#ifdef AMDT_INTERNAL
-        GPA_LogDebugCounterDefs("'%s' equation is %s", m_counters[counterIndex].m_pName, m_counters[counterIndex].m_pComputeExpression);
-#endif
+        assert(!"unable to evaluate counter");
+        *pWriteResult = (T)0;
+        return;
+    }
 
-        if (internalCounterTypes[0] == GPA_TYPE_UINT64)
+    T stack[MAX_EXPRESSION_STACK_DEPTH];
+    T* pTop = stack; // one past the top of the stack
+
+    char* const* ppResults = results.data();
+    const GPA_CounterExpressionInstruction* pInstruction = counter.m_pProgram;
+    const GPA_CounterExpressionInstruction* pEnd = pInstruction + counter.m_programLength;
+
+    for (; pInstruction != pEnd; ++pInstruction)
+    {
+        switch (pInstruction->m_op)
         {
-            if (m_counters[counterIndex].m_dataType == GPA_TYPE_FLOAT32)
+            case EXPR_OP_PUSH_COUNTER:
+                *pTop++ = (T)(*((InternalCounterType*)ppResults[pInstruction->m_operand]));
+                break;
+
+            case EXPR_OP_PUSH_CONSTANT:
+                *pTop++ = GetExpressionConstant<T>(pInstruction->m_constant);
+                break;
+
+            case EXPR_OP_PUSH_NUM_SHADER_ENGINES:
+                *pTop++ = (T)pHwInfo->GetNumberShaderEngines();
+                break;
+
+            case EXPR_OP_PUSH_NUM_SIMDS:
+                *pTop++ = (T)pHwInfo->GetNumberSIMDs();
+                break;
+
+            case EXPR_OP_PUSH_SU_CLOCKS_PRIM:
+                *pTop++ = (T)pHwInfo->GetSUClocksPrim();
+                break;
+
+            case EXPR_OP_PUSH_NUM_PRIM_PIPES:
+                *pTop++ = (T)pHwInfo->GetNumberPrimPipes();
+                break;
+
+            case EXPR_OP_PUSH_TS_FREQ:
+                *pTop++ = (T)pHwInfo->GetTimeStampFrequency();
+                break;
+
+            case EXPR_OP_ADD:
+                --pTop;
+                pTop[-1] = pTop[-1] + pTop[0];
+                break;
+
+            case EXPR_OP_SUB:
+                --pTop;
+                pTop[-1] = pTop[-1] - pTop[0];
+                break;
+
+            case EXPR_OP_MUL:
+                --pTop;
+                pTop[-1] = pTop[-1] * pTop[0];
+                break;
+
+            case EXPR_OP_DIV:
+                --pTop;
+                pTop[-1] = (pTop[0] != (T)0) ? (pTop[-1] / pTop[0]) : (T)0;
+                break;
+
+            case EXPR_OP_MAX:
+                --pTop;
+                pTop[-1] = (pTop[-1] > pTop[0]) ? pTop[-1] : pTop[0];
+                break;
+
+            case EXPR_OP_MIN:
+                --pTop;
+                pTop[-1] = (pTop[-1] < pTop[0]) ? pTop[-1] : pTop[0];
+                break;
+
+            case EXPR_OP_IFNOTZERO:
             {
-                EvaluateExpression<gpa_float32, gpa_uint64>(m_counters[counterIndex].m_pComputeExpression, pResult, results, internalCounterTypes, m_counters[counterIndex].m_dataType, pHwInfo);
+                // the condition is on top, followed by the true result and then the false result
+                T condition = pTop[-1];
+                pTop -= 2;
+                pTop[-1] = (condition != 0) ? pTop[0] : pTop[-1];
+                break;
             }
-            else if (m_counters[counterIndex].m_dataType == GPA_TYPE_FLOAT64)
-            {
-                EvaluateExpression<gpa_float64, gpa_uint64>(m_counters[counterIndex].m_pComputeExpression, pResult, results, internalCounterTypes, m_counters[counterIndex].m_dataType, pHwInfo);
-            }
-            else if (m_counters[counterIndex].m_dataType == GPA_TYPE_UINT32)
-            {
-                EvaluateExpression<gpa_uint32, gpa_uint64>(m_counters[counterIndex].m_pComputeExpression, pResult, results, internalCounterTypes, m_counters[counterIndex].m_dataType, pHwInfo);
-            }
-            else if (m_counters[counterIndex].m_dataType == GPA_TYPE_UINT64)
-            {
-                EvaluateExpression<gpa_uint64, gpa_uint64>(m_counters[counterIndex].m_pComputeExpression, pResult, results, internalCounterTypes, m_counters[counterIndex].m_dataType, pHwInfo);
-            }
-            else if (m_counters[counterIndex].m_dataType == GPA_TYPE_INT32)
-            {
-                EvaluateExpression<gpa_int32, gpa_uint64>(m_counters[counterIndex].m_pComputeExpression, pResult, results, internalCounterTypes, m_counters[counterIndex].m_dataType, pHwInfo);
-            }
-            else if (m_counters[counterIndex].m_dataType == GPA_TYPE_INT64)
+
+            case EXPR_OP_MAX_N:
             {
-                EvaluateExpression<gpa_int64, gpa_uint64>(m_counters[counterIndex].m_pComputeExpression, pResult, results, internalCounterTypes, m_counters[counterIndex].m_dataType, pHwInfo);
+                // visit the values from the top of the stack down, as the original expression evaluator did
+                T maxValue = pTop[-1];
+
+                for (gpa_uint32 i = 2; i <= pInstruction->m_operand; i++)
+                {
+                    T value = pTop[-(int)i];
+                    maxValue = (maxValue > value) ? maxValue : value;
+                }
+
+                pTop -= pInstruction->m_operand - 1;
+                pTop[-1] = maxValue;
+                break;
             }
-            else
+
+            case EXPR_OP_SUM_N:
             {
-                // public counter type not recognized or not currently supported.
-                assert(false);
+                // add the values from the top of the stack down, as the original expression evaluator did
+                T sum = 0;
+
+                for (gpa_uint32 i = 1; i <= pInstruction->m_operand; i++)
+                {
+                    sum += pTop[-(int)i];
+                }
+
+                pTop -= pInstruction->m_operand - 1;
+                pTop[-1] = sum;
+                break;
             }
+
+            default:
+                assert(!"unknown expression op");
+                break;
+        }
+    }
+
+    assert(pTop == stack + 1);
+    *pWriteResult = stack[0];
+}
+
+/// Evaluates a public counter, either by running its compiled expression or by interpreting its expression string
+/// T is public counter type
+/// \param counter the public counter to evaluate
+/// \param useExpressionString true to interpret the expression string rather than the compiled expression
+/// \param[out] pResult the result value
+/// \param results list of the hardware counter results
+/// \param internalCounterTypes list of the hardware counter types
+/// \param pHwInfo the hardware info
+template<class T, class InternalCounterType>
+static void EvaluateCounter(const GPA_PublicCounter& counter, bool useExpressionString, void* pResult, vector< char* >& results, vector< GPA_Type >& internalCounterTypes, const GPA_HWInfo* pHwInfo)
+{
+    if (useExpressionString)
+    {
+        EvaluateExpression<T, InternalCounterType>(counter.m_pComputeExpression, pResult, results, internalCounterTypes, counter.m_dataType, pHwInfo);
+    }
+    else
+    {
+        ExecuteProgram<T, InternalCounterType>(counter, pResult, results, pHwInfo);
+    }
+}
+
+/// Evaluates a public counter based on its data type and the type of its internal counters
+/// \param counter the public counter to evaluate
+/// \param useExpressionString true to interpret the expression string rather than the compiled expression
+/// \param[out] pResult the result value
+/// \param results list of the hardware counter results
+/// \param internalCounterTypes list of the hardware counter types
+/// \param pHwInfo the hardware info
+template<class InternalCounterType>
+static void EvaluateCounterForInternalType(const GPA_PublicCounter& counter, bool useExpressionString, void* pResult, vector< char* >& results, vector< GPA_Type >& internalCounterTypes, const GPA_HWInfo* pHwInfo)
+{
+    if (counter.m_dataType == GPA_TYPE_FLOAT32)
+    {
+        EvaluateCounter<gpa_float32, InternalCounterType>(counter, useExpressionString, pResult, results, internalCounterTypes, pHwInfo);
+    }
+    else if (counter.m_dataType == GPA_TYPE_FLOAT64)
+    {
+        EvaluateCounter<gpa_float64, InternalCounterType>(counter, useExpressionString, pResult, results, internalCounterTypes, pHwInfo);
+    }
+    else if (counter.m_dataType == GPA_TYPE_UINT32)
+    {
+        EvaluateCounter<gpa_uint32, InternalCounterType>(counter, useExpressionString, pResult, results, internalCounterTypes, pHwInfo);
+    }
+    else if (counter.m_dataType == GPA_TYPE_UINT64)
+    {
+        EvaluateCounter<gpa_uint64, InternalCounterType>(counter, useExpressionString, pResult, results, internalCounterTypes, pHwInfo);
+    }
+    else if (counter.m_dataType == GPA_TYPE_INT32)
+    {
+        EvaluateCounter<gpa_int32, InternalCounterType>(counter, useExpressionString, pResult, results, internalCounterTypes, pHwInfo);
+    }
+    else if (counter.m_dataType == GPA_TYPE_INT64)
+    {
+        EvaluateCounter<gpa_int64, InternalCounterType>(counter, useExpressionString, pResult, results, internalCounterTypes, pHwInfo);
+    }
+    else
+    {
+        // public counter type not recognized or not currently supported.
+        assert(false);
+    }
+}
+
+/// Evaluates a public counter
+/// \param counter the public counter to evaluate
+/// \param useExpressionString true to interpret the expression string rather than the compiled expression
+/// \param[out] pResult the result value
+/// \param results list of the hardware counter results
+/// \param internalCounterTypes list of the hardware counter types
+/// \param pHwInfo the hardware info
+static void EvaluatePublicCounter(const GPA_PublicCounter& counter, bool useExpressionString, void* pResult, vector< char* >& results, vector< GPA_Type >& internalCounterTypes, const GPA_HWInfo* pHwInfo)
+{
+    if (nullptr != counter.m_pComputeExpression)
+    {
+#ifdef AMDT_INTERNAL
+        GPA_LogDebugCounterDefs("'%s' equation is %s", counter.m_pName, counter.m_pComputeExpression);
+#endif
+
+        if (internalCounterTypes[0] == GPA_TYPE_UINT64)
+        {
+            EvaluateCounterForInternalType<gpa_uint64>(counter, useExpressionString, pResult, results, internalCounterTypes, pHwInfo);
         }
         else if (internalCounterTypes[0] == GPA_TYPE_UINT32)
         {
-            if (m_counters[counterIndex].m_dataType == GPA_TYPE_FLOAT32)
-            {
-                EvaluateExpression<gpa_float32, gpa_uint32>(m_counters[counterIndex].m_pComputeExpression, pResult, results, internalCounterTypes, m_counters[counterIndex].m_dataType, pHwInfo);
-            }
-            else if (m_counters[counterIndex].m_dataType == GPA_TYPE_FLOAT64)
-            {
-                EvaluateExpression<gpa_float64, gpa_uint32>(m_counters[counterIndex].m_pComputeExpression, pResult, results, internalCounterTypes, m_counters[counterIndex].m_dataType, pHwInfo);
-            }
-            else if (m_counters[counterIndex].m_dataType == GPA_TYPE_UINT32)
-            {
-                EvaluateExpression<gpa_uint32, gpa_uint32>(m_counters[counterIndex].m_pComputeExpression, pResult, results, internalCounterTypes, m_counters[counterIndex].m_dataType, pHwInfo);
-            }
-            else if (m_counters[counterIndex].m_dataType == GPA_TYPE_UINT64)
-            {
-                EvaluateExpression<gpa_uint64, gpa_uint32>(m_counters[counterIndex].m_pComputeExpression, pResult, results, internalCounterTypes, m_counters[counterIndex].m_dataType, pHwInfo);
-            }
-            else if (m_counters[counterIndex].m_dataType == GPA_TYPE_INT32)
-            {
-                EvaluateExpression<gpa_int32, gpa_uint32>(m_counters[counterIndex].m_pComputeExpression, pResult, results, internalCounterTypes, m_counters[counterIndex].m_dataType, pHwInfo);
-            }
-            else if (m_counters[counterIndex].m_dataType == GPA_TYPE_INT64)
-            {
-                EvaluateExpression<gpa_int64, gpa_uint32>(m_counters[counterIndex].m_pComputeExpression, pResult, results, internalCounterTypes, m_counters[counterIndex].m_dataType, pHwInfo);
-            }
-            else
-            {
-                // public counter type not recognized or not currently supported.
-                assert(false);
-            }
+            EvaluateCounterForInternalType<gpa_uint32>(counter, useExpressionString, pResult, results, internalCounterTypes, pHwInfo);
         }
     }
     else
@@ -602,4 +1040,16 @@ void GPA_PublicCounters::ComputeCounterValue(gpa_uint32 counterIndex, vector< ch
     }
 }
 
+void GPA_PublicCounters::ComputeCounterValue(gpa_uint32 counterIndex, vector< char* >& results, vector< GPA_Type >& internalCounterTypes, void* pResult, GPA_HWInfo* pHwInfo)
+{
+    assert(m_countersExpanded.load(std::memory_order_relaxed));
+    assert(counterIndex < m_counters.size());
+    EvaluatePublicCounter(m_counters[counterIndex], false, pResult, results, internalCounterTypes, pHwInfo);
+}
 
+void GPA_PublicCounters::ComputeCounterValueFromExpression(gpa_uint32 counterIndex, vector< char* >& results, vector< GPA_Type >& internalCounterTypes, void* pResult, GPA_HWInfo* pHwInfo)
+{
+    assert(m_countersExpanded.load(std::memory_order_relaxed));
+    assert(counterIndex < m_counters.size());
+    EvaluatePublicCounter(m_counters[counterIndex], true, pResult, results, internalCounterTypes, pHwInfo);
+}
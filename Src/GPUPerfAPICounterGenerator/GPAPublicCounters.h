@@ -11,16 +11,74 @@
 #include <assert.h>
 #include "GPUPerfAPIOS.h"
 #include <vector>
+#include <atomic>
+#include <mutex>
 #include "GPAHWInfo.h"
 using std::vector;
 
+/// Operations that make up a compiled public counter expression
+enum GPA_CounterExpressionOp
+{
+    EXPR_OP_PUSH_COUNTER,            ///< push the result of the internal counter in slot m_operand
+    EXPR_OP_PUSH_CONSTANT,           ///< push m_constant
+    EXPR_OP_PUSH_NUM_SHADER_ENGINES, ///< push the number of shader engines
+    EXPR_OP_PUSH_NUM_SIMDS,          ///< push the number of SIMDs
+    EXPR_OP_PUSH_SU_CLOCKS_PRIM,     ///< push the number of SU clocks per primitive
+    EXPR_OP_PUSH_NUM_PRIM_PIPES,     ///< push the number of primitive pipes
+    EXPR_OP_PUSH_TS_FREQ,            ///< push the timestamp frequency
+    EXPR_OP_ADD,                     ///< pop two values, push their sum
+    EXPR_OP_SUB,                     ///< pop two values, push their difference
+    EXPR_OP_MUL,                     ///< pop two values, push their product
+    EXPR_OP_DIV,                     ///< pop two values, push their quotient (zero if the divisor is zero)
+    EXPR_OP_MAX,                     ///< pop two values, push the larger
+    EXPR_OP_MIN,                     ///< pop two values, push the smaller
+    EXPR_OP_IFNOTZERO,               ///< pop a condition, a true value and a false value, push the selected value
+    EXPR_OP_MAX_N,                   ///< pop m_operand values, push the largest
+    EXPR_OP_SUM_N,                   ///< pop m_operand values, push their sum
+};
+
+/// A constant in a compiled expression, pre-parsed as the data type of the public counter
+union GPA_CounterExpressionConstant
+{
+    gpa_float32 m_float32; ///< value for GPA_TYPE_FLOAT32 counters
+    gpa_float64 m_float64; ///< value for GPA_TYPE_FLOAT64 counters
+    gpa_uint32 m_uint32;   ///< value for GPA_TYPE_UINT32 counters
+    gpa_uint64 m_uint64;   ///< value for GPA_TYPE_UINT64 counters
+    gpa_int32 m_int32;     ///< value for GPA_TYPE_INT32 counters
+    gpa_int64 m_int64;     ///< value for GPA_TYPE_INT64 counters
+};
+
+/// A single instruction of a compiled public counter expression
+struct GPA_CounterExpressionInstruction
+{
+    GPA_CounterExpressionOp m_op;             ///< the operation to perform
+    gpa_uint32 m_operand;                     ///< internal counter slot for EXPR_OP_PUSH_COUNTER, value count for EXPR_OP_MAX_N and EXPR_OP_SUM_N
+    GPA_CounterExpressionConstant m_constant; ///< the value pushed by EXPR_OP_PUSH_CONSTANT
+};
+
+/// Definition of a public counter, as emitted by the PublicCounterCompiler into a read-only table
+struct GPA_PublicCounterDef
+{
+    const char* m_pName;                ///< the name of the counter
+    const char* m_pDescription;         ///< the description of the counter
+    GPA_Type m_dataType;                ///< the data type of the counter
+    GPA_Usage_Type m_usageType;         ///< how the counter should be interpreted
+    GPA_CounterType m_counterType;      ///< the type of the counter
+    gpa_uint32 m_internalCounterOffset; ///< offset of the first internal counter required by the counter in the table's internal counter array
+    gpa_uint32 m_numInternalCounters;   ///< the number of internal counters required by the counter
+    const char* m_pComputeExpression;   ///< the compute expression of the counter
+};
+
 /// Information about a public counter that is exposed through the interface
 class GPA_PublicCounter
 {
 public:
 
-    /// constructor taking a compute expression string
-    GPA_PublicCounter(unsigned int index, const char* pName, const char* pDescription, GPA_Type dataType, GPA_Usage_Type usageType, GPA_CounterType counterType, vector< gpa_uint32 >& internalCountersRequired, const char* pComputeExpression);
+    /// constructor taking a counter definition
+    /// \param index the index of the counter
+    /// \param definition the definition of the counter
+    /// \param pInternalCounters the internal counter array of the definition's table
+    GPA_PublicCounter(unsigned int index, const GPA_PublicCounterDef& definition, const gpa_uint32* pInternalCounters);
 
     /// Default Constructor.
     /// temporary addition of a default constructor to allow vector to build and execute.
@@ -46,11 +104,23 @@ public:
     /// The counter type
     GPA_CounterType m_counterType;
 
-    /// List of internal counters that are needed to calculate this public counter
-    vector< gpa_uint32 > m_internalCountersRequired;
+    /// List of internal counters that are needed to calculate this public counter (points into a read-only counter table)
+    const gpa_uint32* m_pInternalCountersRequired;
+
+    /// The number of internal counters in m_pInternalCountersRequired
+    gpa_uint32 m_numInternalCountersRequired;
 
     /// A string expression that shows how to calculate this counter.
     const char* m_pComputeExpression;
+
+    /// m_pComputeExpression compiled to bytecode (points into the compiled programs of the owning GPA_PublicCounters)
+    const GPA_CounterExpressionInstruction* m_pProgram;
+
+    /// The number of instructions in m_pProgram; zero if the expression is invalid
+    gpa_uint32 m_programLength;
+
+    /// The offset of m_pProgram in the compiled programs of the owning GPA_PublicCounters
+    gpa_uint32 m_programOffset;
 };
 
 /// The set of available public counters
@@ -60,7 +130,11 @@ public:
 
     /// Initializes an instance of the GPA_PublicCounters class.
     GPA_PublicCounters():
-        m_countersGenerated(false)
+        m_countersGenerated(false),
+        m_pCounterDefs(nullptr),
+        m_numCounterDefs(0),
+        m_pInternalCounters(nullptr),
+        m_countersExpanded(false)
     {
     }
 
@@ -77,8 +151,8 @@ public:
     /// \return the counter's name
     virtual const char* GetCounterName(gpa_uint32 index)
     {
-        assert(index < m_counters.size());
-        return m_counters[index].m_pName;
+        assert(index < m_numCounterDefs);
+        return m_pCounterDefs[index].m_pName;
     }
 
     /// Gets a counter's description
@@ -86,8 +160,8 @@ public:
     /// \return the counter's description
     virtual const char* GetCounterDescription(gpa_uint32 index)
     {
-        assert(index < m_counters.size());
-        return m_counters[index].m_pDescription;
+        assert(index < m_numCounterDefs);
+        return m_pCounterDefs[index].m_pDescription;
     }
 
     /// Gets a counter's usage type
@@ -95,8 +169,8 @@ public:
     /// \return the counter's usage type
     virtual GPA_Usage_Type GetCounterUsageType(gpa_uint32 index)
     {
-        assert(index < m_counters.size());
-        return m_counters[index].m_usageType;
+        assert(index < m_numCounterDefs);
+        return m_pCounterDefs[index].m_usageType;
     }
 
     /// Gets a counter's data type
@@ -104,8 +178,8 @@ public:
     /// \return the counter's data type
     virtual GPA_Type GetCounterDataType(gpa_uint32 index)
     {
-        assert(index < m_counters.size());
-        return m_counters[index].m_dataType;
+        assert(index < m_numCounterDefs);
+        return m_pCounterDefs[index].m_dataType;
     }
 
     /// Gets a counter's type
@@ -113,32 +187,25 @@ public:
     /// \return the counter's type
     virtual GPA_CounterType GetCounterType(gpa_uint32 index)
     {
-        assert(index < m_counters.size());
-        return m_counters[index].m_counterType;
+        assert(index < m_numCounterDefs);
+        return m_pCounterDefs[index].m_counterType;
     }
 
-    /// Defines a public counter based on an expression
-    /// \param pName the name of the counter
-    /// \param pDescription the description of the counter
-    /// \param dataType the data type of the counter
-    /// \param usageType the usage type of the counter
-    /// \param counterType the type of the counter
-    /// \param internalCountersRequired the list of required internal counters
-    /// \param pComputeExpression the compute expression of the counter
-    virtual void DefinePublicCounter(const char* pName, const char* pDescription, GPA_Type dataType, GPA_Usage_Type usageType, GPA_CounterType counterType, vector< gpa_uint32 >& internalCountersRequired, const char* pComputeExpression);
-
-    /// Adds a public counter to the set of available counters
-    /// \param publicCounter the public counter to add
-    virtual void AddPublicCounter(GPA_PublicCounter& publicCounter)
-    {
-        m_counters.push_back(publicCounter);
-    }
+    /// Registers the public counters of a read-only counter table.
+    /// The table is referenced rather than copied, so it must outlive this instance. Names, types and required
+    /// internal counters are read straight from the table; the counters are only expanded (and their expressions
+    /// compiled) by ExpandCounters, or the first time one of them is retrieved with GetCounter.
+    /// \param pCounterDefs the counter definitions
+    /// \param numCounterDefs the number of counter definitions
+    /// \param pInternalCounters the internal counters required by the counters, referenced by offset from the definitions
+    virtual void DefinePublicCounters(const GPA_PublicCounterDef* pCounterDefs, gpa_uint32 numCounterDefs, const gpa_uint32* pInternalCounters);
 
     /// Get the counter at the specified index
     /// \param index the index of the requested counter
     /// \return the counter at the specified index
     virtual const GPA_PublicCounter* GetCounter(gpa_uint32 index)
     {
+        ExpandCounters();
         assert(index < m_counters.size());
         return &m_counters[index];
     }
@@ -146,16 +213,22 @@ public:
     /// Clears the list of available counters
     virtual void Clear();
 
+    /// Expands the registered counter table into the list of counters and compiles the counters' expressions, if not already done.
+    /// This must be done before the counters are computed, so that computing a result does not need to check for it.
+    /// Several threads may expand the counters at the same time.
+    void ExpandCounters();
+
     /// Gets the list of internal counters that are required for a public counter
     /// \param index the index of the requested counter
     /// \return the list of internal counters
-    virtual vector< gpa_uint32 >& GetInternalCountersRequired(gpa_uint32 index)
+    virtual vector< gpa_uint32 > GetInternalCountersRequired(gpa_uint32 index)
     {
-        assert(index < m_counters.size());
-        return m_counters[index].m_internalCountersRequired;
+        assert(index < m_numCounterDefs);
+        const gpa_uint32* pInternalCountersRequired = m_pInternalCounters + m_pCounterDefs[index].m_internalCounterOffset;
+        return vector< gpa_uint32 >(pInternalCountersRequired, pInternalCountersRequired + m_pCounterDefs[index].m_numInternalCounters);
     }
 
-    /// Computes a counter's result
+    /// Computes a counter's result; the counters must have been expanded
     /// \param counterIndex the index of the counter
     /// \param results the counter results buffer
     /// \param internalCounterTypes the list of internal counter types
@@ -163,12 +236,40 @@ public:
     /// \param pHwInfo the hardware info for the current hardware
     virtual void ComputeCounterValue(gpa_uint32 counterIndex, vector< char* >& results, vector< GPA_Type >& internalCounterTypes, void* pResult, GPA_HWInfo* pHwInfo);
 
+    /// Computes a counter's result by interpreting its compute expression string.
+    /// This is much slower than ComputeCounterValue and is kept as a reference for validating and benchmarking the compiled expressions.
+    /// The counters must have been expanded.
+    /// \param counterIndex the index of the counter
+    /// \param results the counter results buffer
+    /// \param internalCounterTypes the list of internal counter types
+    /// \param pResult the result of the computation
+    /// \param pHwInfo the hardware info for the current hardware
+    virtual void ComputeCounterValueFromExpression(gpa_uint32 counterIndex, vector< char* >& results, vector< GPA_Type >& internalCounterTypes, void* pResult, GPA_HWInfo* pHwInfo);
+
     /// indicates that the public counters have been generated
     bool m_countersGenerated;
 
 protected:
-    /// The set of available public counters
+    /// The registered counter table
+    const GPA_PublicCounterDef* m_pCounterDefs;
+
+    /// The number of counters in m_pCounterDefs
+    gpa_uint32 m_numCounterDefs;
+
+    /// The internal counters required by the counters in m_pCounterDefs
+    const gpa_uint32* m_pInternalCounters;
+
+    /// The set of available public counters; empty until the registered table is expanded
     vector< GPA_PublicCounter > m_counters;
+
+    /// The compiled expressions of all the public counters, one after the other
+    vector< GPA_CounterExpressionInstruction > m_programs;
+
+    /// indicates that m_counters and m_programs hold the expanded counter table
+    std::atomic<bool> m_countersExpanded;
+
+    /// serializes expanding the counter table when counters are first retrieved from several threads
+    std::mutex m_expandMutex;
 };
 
 #endif // _GPA_PUBLIC_COUNTERS_H_
@@ -13,6 +13,7 @@
 #include "GPASplitCountersMaxPerPass.h"
 #include "GPASplitCountersOnePerPass.h"
 #include "GPASplitCountersConsolidated.h"
+#include "GPASplitCountersOptimal.h"
 #ifdef _WIN32
     #include "GPASplitCountersConsolidatedDX12.h"
 #endif // _WIN32
@@ -36,6 +37,10 @@ enum GPACounterSplitterAlgorithm
 
     // Consolidated algorithm for DX12
     CONSOLIDATED_DX12,
+
+    /// like CONSOLIDATED, but searches for the placement of the counters that needs the fewest passes,
+    /// with no fixed limit on the number of counters in a single pass
+    OPTIMAL,
 };
 
 /// A factory which can produce various counter splitting implementations.
@@ -79,6 +84,12 @@ public:
                                                          gpuTimestampTopToBottomCounterIndex, maxSQCounters,
                                                          numSQGroups, pSQCounterBlockInfo);
         }
+        else if (OPTIMAL == algorithm)
+        {
+            pSplitter = new(std::nothrow) GPASplitCountersOptimal(gpuTimestampGroupIndex, gpuTimestampBottomToBottomCounterIndex,
+                                                                  gpuTimestampTopToBottomCounterIndex, maxSQCounters,
+                                                                  numSQGroups, pSQCounterBlockInfo);
+        }
 
 #ifdef _WIN32
         else if (CONSOLIDATED_DX12 == algorithm)
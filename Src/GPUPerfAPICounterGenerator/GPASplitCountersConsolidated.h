@@ -51,25 +51,25 @@ public:
     // single-pass counters should not be split into multiple passes,
     // multi-pass counters should not take more passes than required,
     // no more than a fixed number of counters per pass.
-    std::list<GPACounterPass> SplitCounters(const std::vector<const GPA_PublicCounter*>& publicCountersToSplit,
-                                            const std::vector<GPAHardwareCounterIndices> internalCountersToSchedule,
-                                            const std::vector<GPASoftwareCounterIndices> softwareCountersToSchedule,
-                                            IGPACounterAccessor* accessor,
-                                            const std::vector<unsigned int>& maxCountersPerGroup,
-                                            unsigned int& numScheduledCounters)
+    GPACounterPassList SplitCounters(const std::vector<const GPA_PublicCounter*>& publicCountersToSplit,
+                                     const std::vector<GPAHardwareCounterIndices> internalCountersToSchedule,
+                                     const std::vector<GPASoftwareCounterIndices> softwareCountersToSchedule,
+                                     const IGPACounterAccessor* accessor,
+                                     const std::vector<unsigned int>& maxCountersPerGroup,
+                                     unsigned int& numScheduledCounters)
     {
         // The maximum number of internal counters to enable in a single pass. This may be updated if any of the public counters require more than this value
         // to be enabled in a single pass, otherwise the algorithm would get stuck in an infinite loop trying to find a viable pass for the public counter.
         // Adjusting this value makes a big difference in the number of passes that will be generated. Currently a very low value (2) will results in 39 passes.
         // A high value (~180) will result in 17 passes; lowering down to 120 still results in 17 passes, but the actual counters in each pass are slightly changed.
         // Other values I tried: 40=33 passes, 50=28 passes, 60=24 passes, 100=19passes, 120+ = 17 passes.
-        unsigned int maxInternalCountersPerPass = 120;
+        unsigned int maxInternalCountersPerPass = ms_maxInternalCountersPerPass;
 
         // this will eventually be the return value
-        std::list<GPACounterPass> passPartitions;
+        GPACounterPassList passPartitions;
 
         // temporary variable to hold the number of counters assigned to each block during each of the passes.
-        std::list<PerPassData> numUsedCountersPerPassPerBlock;
+        std::vector<PerPassData> numUsedCountersPerPassPerBlock;
 
         // Handle the public counters
         //InsertPublicCounters(passPartitions, numUsedCountersPerPassPerBlock, numBlocks, numScheduledCounters, publicCountersToSplit, accessor, maxCountersPerGroup, maxInternalCountersPerPass);
@@ -84,7 +84,367 @@ public:
         return passPartitions;
     };
 
+    //--------------------------------------------------------------------------
+    // counters that are no longer needed are removed from their passes, and a pass is only removed when all of its remaining counters fit into the other passes,
+    // new public counters are split on their own and each of their passes is put into an existing pass that can hold it before any pass is added.
+    bool UpdatePasses(GPACounterPassList& passPartitions,
+                      const std::vector<unsigned int>& countersToRemove,
+                      const std::vector<const GPA_PublicCounter*>& publicCountersToAdd,
+                      const std::vector<GPAHardwareCounterIndices>& hardwareCountersToAdd,
+                      const IGPACounterAccessor* pAccessor,
+                      const std::vector<unsigned int>& maxCountersPerGroup)
+    {
+        bool removedInternalCounters = !countersToRemove.empty() && RemoveCounters(passPartitions, countersToRemove);
+
+        // the number of counters assigned to each block in each of the passes is not kept between updates, so rebuild it from the passes
+        std::vector<PerPassData> numUsedCountersPerPassPerBlock(passPartitions.size());
+
+        for (unsigned int passIndex = 0; passIndex < passPartitions.size(); passIndex++)
+        {
+            const std::vector<unsigned int>& counters = passPartitions[passIndex].m_counters;
+
+            for (size_t i = 0; i < counters.size(); i++)
+            {
+                const GPACounterGroupLocation counterLocation = pAccessor->GetCounterLocation(counters[i]);
+                AddCounterToPassData(counterLocation, numUsedCountersPerPassPerBlock[passIndex]);
+            }
+        }
+
+        // the passes only have room for more counters if internal counters were removed from them
+        if (removedInternalCounters)
+        {
+            // start from the last pass, so that removing a pass does not change the index of the passes still to be checked
+            for (unsigned int passIndex = (unsigned int)passPartitions.size(); passIndex > 0; passIndex--)
+            {
+                RemovePassIfCountersFitElsewhere(passIndex - 1, passPartitions, numUsedCountersPerPassPerBlock, pAccessor, maxCountersPerGroup);
+            }
+        }
+
+        for (auto publicIter = publicCountersToAdd.cbegin(); publicIter != publicCountersToAdd.cend(); ++publicIter)
+        {
+            const GPACounterPassList singleCounterPasses = SplitSingleCounter(*publicIter, pAccessor, maxCountersPerGroup);
+
+            for (auto singleCounterPassIter = singleCounterPasses.cbegin(); singleCounterPassIter != singleCounterPasses.cend(); ++singleCounterPassIter)
+            {
+                unsigned int passIndex;
+
+                if (!AddCountersToExistingPass(*singleCounterPassIter, (unsigned int)passPartitions.size(), passPartitions, numUsedCountersPerPassPerBlock, pAccessor, maxCountersPerGroup, passIndex))
+                {
+                    // the counters do not fit into any of the passes, so they get a pass of their own
+                    passIndex = (unsigned int)passPartitions.size();
+                    AddNewPassInfo(passIndex + 1, passPartitions, numUsedCountersPerPassPerBlock);
+
+                    for (auto internalCounterIter = singleCounterPassIter->m_counters.cbegin(); internalCounterIter != singleCounterPassIter->m_counters.cend(); ++internalCounterIter)
+                    {
+                        const GPACounterGroupLocation counterLocation = pAccessor->GetCounterLocation(*internalCounterIter);
+                        AddCounterToPass(counterLocation, *internalCounterIter, passPartitions[passIndex], numUsedCountersPerPassPerBlock[passIndex]);
+                    }
+                }
+
+                for (auto internalCounterIter = singleCounterPassIter->m_counters.cbegin(); internalCounterIter != singleCounterPassIter->m_counters.cend(); ++internalCounterIter)
+                {
+                    AddCounterResultLocation((*publicIter)->m_index, *internalCounterIter, passIndex, passPartitions[passIndex].GetCounterOffset(*internalCounterIter));
+                }
+            }
+        }
+
+        // hardware counters are already placed into the first pass that can hold them
+        unsigned int numScheduledCounters = 0;
+        InsertHardwareCounters(passPartitions, hardwareCountersToAdd, pAccessor, numUsedCountersPerPassPerBlock, maxCountersPerGroup, numScheduledCounters);
+
+        return true;
+    }
+
 protected:
+    /// The maximum number of internal counters to enable in a single pass, unless a public counter needs more than this in a single pass
+    static const unsigned int ms_maxInternalCountersPerPass = 120;
+
+    /// Removes the result locations of counters that are no longer enabled, along with the internal counters that no remaining result location refers to.
+    /// Passes which are left without counters are removed.
+    /// \param[in,out] passPartitions the passes to remove the counters from
+    /// \param countersToRemove the indices of the counters that are no longer enabled
+    /// \return true if any internal counter was removed, false if all of the internal counters are still used
+    bool RemoveCounters(GPACounterPassList& passPartitions, const std::vector<unsigned int>& countersToRemove)
+    {
+        for (auto counterIter = countersToRemove.cbegin(); counterIter != countersToRemove.cend(); ++counterIter)
+        {
+            m_counterResultLocationMap.erase(*counterIter);
+        }
+
+        // find the results that are still read by one of the enabled counters
+        std::vector< std::vector<bool> > resultUsed(passPartitions.size());
+
+        for (unsigned int passIndex = 0; passIndex < passPartitions.size(); passIndex++)
+        {
+            resultUsed[passIndex].resize(passPartitions[passIndex].m_counters.size(), false);
+        }
+
+        for (auto publicIter = m_counterResultLocationMap.cbegin(); publicIter != m_counterResultLocationMap.cend(); ++publicIter)
+        {
+            for (auto locationIter = publicIter->second.cbegin(); locationIter != publicIter->second.cend(); ++locationIter)
+            {
+                resultUsed[locationIter->second.m_pass][locationIter->second.m_offset] = true;
+            }
+        }
+
+        bool removedInternalCounters = false;
+
+        for (unsigned int passIndex = 0; passIndex < passPartitions.size() && !removedInternalCounters; passIndex++)
+        {
+            removedInternalCounters = std::find(resultUsed[passIndex].begin(), resultUsed[passIndex].end(), false) != resultUsed[passIndex].end();
+        }
+
+        if (!removedInternalCounters)
+        {
+            return false;
+        }
+
+        // rebuild the passes from the counters whose results are used, recording where each result moved to
+        GPACounterPassList remainingPasses;
+        std::vector<unsigned int> newPassIndices(passPartitions.size());
+        std::vector< std::vector<unsigned int> > newOffsets(passPartitions.size());
+
+        for (unsigned int passIndex = 0; passIndex < passPartitions.size(); passIndex++)
+        {
+            const std::vector<unsigned int>& counters = passPartitions[passIndex].m_counters;
+            GPACounterPass remainingPass;
+            newOffsets[passIndex].resize(counters.size());
+
+            for (size_t i = 0; i < counters.size(); i++)
+            {
+                if (resultUsed[passIndex][i])
+                {
+                    newOffsets[passIndex][i] = (unsigned int)remainingPass.m_counters.size();
+                    remainingPass.AddCounter(counters[i]);
+                }
+            }
+
+            newPassIndices[passIndex] = (unsigned int)remainingPasses.size();
+
+            if (!remainingPass.m_counters.empty())
+            {
+                remainingPasses.push_back(remainingPass);
+            }
+        }
+
+        for (auto publicIter = m_counterResultLocationMap.begin(); publicIter != m_counterResultLocationMap.end(); ++publicIter)
+        {
+            for (auto locationIter = publicIter->second.begin(); locationIter != publicIter->second.end(); ++locationIter)
+            {
+                GPA_CounterResultLocation& location = locationIter->second;
+                location.m_offset = (gpa_uint16)newOffsets[location.m_pass][location.m_offset];
+                location.m_pass = (gpa_uint16)newPassIndices[location.m_pass];
+            }
+        }
+
+        passPartitions.swap(remainingPasses);
+        return true;
+    }
+
+    /// Moves the counters of a pass into the other passes and removes the pass, if all of its counters fit into the other passes.
+    /// The counters which an enabled counter reads from the pass are kept together, so that each public counter is still collected in as few passes as before.
+    /// \param passIndex the pass to remove
+    /// \param[in,out] passPartitions the passes
+    /// \param[in,out] numUsedCountersPerPassPerBlock the number of counters scheduled on each block in each of the passes
+    /// \param pAccessor A interface that accesses the internal counters
+    /// \param maxCountersPerGroup A vector containing the maximum number of simultaneous counters for each block
+    /// \return true if the pass was removed, false if the passes are unchanged
+    bool RemovePassIfCountersFitElsewhere(unsigned int passIndex,
+                                          GPACounterPassList& passPartitions,
+                                          std::vector<PerPassData>& numUsedCountersPerPassPerBlock,
+                                          const IGPACounterAccessor* pAccessor,
+                                          const std::vector<unsigned int>& maxCountersPerGroup)
+    {
+        // collect the counters which each enabled counter reads from the pass
+        std::map<unsigned int, GPACounterPass> countersReadFromPass;
+
+        for (auto publicIter = m_counterResultLocationMap.cbegin(); publicIter != m_counterResultLocationMap.cend(); ++publicIter)
+        {
+            for (auto locationIter = publicIter->second.cbegin(); locationIter != publicIter->second.cend(); ++locationIter)
+            {
+                if (locationIter->second.m_pass == passIndex)
+                {
+                    countersReadFromPass[publicIter->first].AddCounter(locationIter->first);
+                }
+            }
+        }
+
+        // most passes cannot be removed, which is usually found by one set of counters that does not fit into any other pass on its own.
+        // Check the largest sets first, before paying for the copies of the passes.
+        std::vector< std::map<unsigned int, GPACounterPass>::const_iterator > readIters;
+
+        for (auto readIter = countersReadFromPass.cbegin(); readIter != countersReadFromPass.cend(); ++readIter)
+        {
+            readIters.push_back(readIter);
+        }
+
+        std::stable_sort(readIters.begin(), readIters.end(), [](std::map<unsigned int, GPACounterPass>::const_iterator a, std::map<unsigned int, GPACounterPass>::const_iterator b)
+        {
+            return a->second.m_counters.size() > b->second.m_counters.size();
+        });
+
+        for (auto readIter = readIters.cbegin(); readIter != readIters.cend(); ++readIter)
+        {
+            bool countersFit = false;
+
+            for (unsigned int otherPassIndex = 0; otherPassIndex < passPartitions.size() && !countersFit; otherPassIndex++)
+            {
+                PerPassData newCountersUsed;
+                countersFit = otherPassIndex != passIndex &&
+                              ((*readIter)->second.m_counterBits.IsSubsetOf(passPartitions[otherPassIndex].m_counterBits) ||
+                               CanCountersBeAddedToPass((*readIter)->second, passPartitions[otherPassIndex], numUsedCountersPerPassPerBlock[otherPassIndex], pAccessor, maxCountersPerGroup, newCountersUsed));
+            }
+
+            if (!countersFit)
+            {
+                return false;
+            }
+        }
+
+        // try the move on copies of the passes, so that nothing changes unless all of the counters fit
+        GPACounterPassList newPassPartitions(passPartitions);
+        std::vector<PerPassData> newNumUsedCountersPerPassPerBlock(numUsedCountersPerPassPerBlock);
+        std::map<unsigned int, unsigned int> newPassPerCounter;
+
+        for (auto readIter = readIters.cbegin(); readIter != readIters.cend(); ++readIter)
+        {
+            unsigned int newPassIndex;
+
+            if (!AddCountersToExistingPass((*readIter)->second, passIndex, newPassPartitions, newNumUsedCountersPerPassPerBlock, pAccessor, maxCountersPerGroup, newPassIndex))
+            {
+                return false;
+            }
+
+            newPassPerCounter[(*readIter)->first] = newPassIndex;
+        }
+
+        newPassPartitions.erase(newPassPartitions.begin() + passIndex);
+        newNumUsedCountersPerPassPerBlock.erase(newNumUsedCountersPerPassPerBlock.begin() + passIndex);
+
+        for (auto publicIter = m_counterResultLocationMap.begin(); publicIter != m_counterResultLocationMap.end(); ++publicIter)
+        {
+            for (auto locationIter = publicIter->second.begin(); locationIter != publicIter->second.end(); ++locationIter)
+            {
+                GPA_CounterResultLocation& location = locationIter->second;
+
+                if (location.m_pass == passIndex)
+                {
+                    location.m_pass = (gpa_uint16)newPassPerCounter[publicIter->first];
+                }
+
+                // the passes after the removed pass move up by one
+                if (location.m_pass > passIndex)
+                {
+                    location.m_pass--;
+                }
+
+                location.m_offset = (gpa_uint16)newPassPartitions[location.m_pass].GetCounterOffset(locationIter->first);
+            }
+        }
+
+        passPartitions.swap(newPassPartitions);
+        numUsedCountersPerPassPerBlock.swap(newNumUsedCountersPerPassPerBlock);
+        return true;
+    }
+
+    /// Checks if a set of counters can be added to a pass.
+    /// \param counters the counters which must be scheduled in the same pass
+    /// \param pass the pass to check
+    /// \param countersUsed the number of counters scheduled on each block in the pass
+    /// \param pAccessor A interface that accesses the internal counters
+    /// \param maxCountersPerGroup A vector containing the maximum number of simultaneous counters for each block
+    /// \param[out] newCountersUsed the number of counters scheduled on each block in the pass once the counters are added
+    /// \return true if all of the counters can be added to the pass, false otherwise
+    bool CanCountersBeAddedToPass(const GPACounterPass& counters,
+                                  const GPACounterPass& pass,
+                                  const PerPassData& countersUsed,
+                                  const IGPACounterAccessor* pAccessor,
+                                  const std::vector<unsigned int>& maxCountersPerGroup,
+                                  PerPassData& newCountersUsed) const
+    {
+        // make sure that the counters have a chance of fitting, as InsertPublicCounters does
+        unsigned int maxInternalCountersPerPass = ms_maxInternalCountersPerPass;
+        maxInternalCountersPerPass = std::max<unsigned int>(maxInternalCountersPerPass, (unsigned int)counters.m_counters.size());
+
+        if (pass.m_counters.size() + counters.m_counters.size() > maxInternalCountersPerPass)
+        {
+            return false;
+        }
+
+        newCountersUsed = countersUsed;
+
+        for (auto internalCounterIter = counters.m_counters.cbegin(); internalCounterIter != counters.m_counters.cend(); ++internalCounterIter)
+        {
+            if (!pass.ContainsCounter(*internalCounterIter))
+            {
+                const GPACounterGroupLocation counterLocation = pAccessor->GetCounterLocation(*internalCounterIter);
+
+                if (this->CheckForTimestampCounters(counterLocation, *internalCounterIter, pass) == false ||
+                    this->CanCounterBeAdded(counterLocation, newCountersUsed, maxCountersPerGroup) == false ||
+                    this->CheckForSQCounters(counterLocation, newCountersUsed, m_maxSQCounters) == false)
+                {
+                    return false;
+                }
+
+                AddCounterToPassData(counterLocation, newCountersUsed);
+            }
+        }
+
+        return true;
+    }
+
+    /// Finds an existing pass that already contains a set of counters, or adds the counters to the first existing pass that can hold all of them.
+    /// \param counters the counters which must be scheduled in the same pass
+    /// \param excludedPassIndex a pass that must not be used, or the number of passes if any pass can be used
+    /// \param[in,out] passPartitions the passes
+    /// \param[in,out] numUsedCountersPerPassPerBlock the number of counters scheduled on each block in each of the passes
+    /// \param pAccessor A interface that accesses the internal counters
+    /// \param maxCountersPerGroup A vector containing the maximum number of simultaneous counters for each block
+    /// \param[out] passIndex the pass which contains the counters
+    /// \return true if the counters are in an existing pass, false if none of the passes can hold them
+    bool AddCountersToExistingPass(const GPACounterPass& counters,
+                                   unsigned int excludedPassIndex,
+                                   GPACounterPassList& passPartitions,
+                                   std::vector<PerPassData>& numUsedCountersPerPassPerBlock,
+                                   const IGPACounterAccessor* pAccessor,
+                                   const std::vector<unsigned int>& maxCountersPerGroup,
+                                   unsigned int& passIndex)
+    {
+        unsigned int numPasses = (unsigned int)passPartitions.size();
+
+        for (passIndex = 0; passIndex < numPasses; passIndex++)
+        {
+            if (passIndex != excludedPassIndex && counters.m_counterBits.IsSubsetOf(passPartitions[passIndex].m_counterBits))
+            {
+                return true;
+            }
+        }
+
+        for (passIndex = 0; passIndex < numPasses; passIndex++)
+        {
+            PerPassData newCountersUsed;
+
+            if (passIndex != excludedPassIndex &&
+                CanCountersBeAddedToPass(counters, passPartitions[passIndex], numUsedCountersPerPassPerBlock[passIndex], pAccessor, maxCountersPerGroup, newCountersUsed))
+            {
+                GPACounterPass& pass = passPartitions[passIndex];
+
+                for (auto internalCounterIter = counters.m_counters.cbegin(); internalCounterIter != counters.m_counters.cend(); ++internalCounterIter)
+                {
+                    if (!pass.ContainsCounter(*internalCounterIter))
+                    {
+                        pass.AddCounter(*internalCounterIter);
+                    }
+                }
+
+                numUsedCountersPerPassPerBlock[passIndex] = newCountersUsed;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     /// Test if this is a timestamp query based counter.
     /// Normally only the time counter is based on the timestamp query.
     /// \return True if the counter is based on the timestamp query, false if not
@@ -133,48 +493,34 @@ protected:
         return isTimestampQuery;
     }
 
-private:
-
     /// Checks passes created for previous public counters to see if the counters in the specified pass are already all scheduled in the same pass
     /// If they are, then we can reuse that pass rather than creating a new pass for the current counter
     /// \param passPartitions the list of passes created for all previously scheduled public counters
     /// \param pass the pass whose counters we are checking to see if they are all already scheduled in a single pass
     /// \param[out] passIndex if the specified pass' counters are already scheduled, this will contain the passindex where they are scheduled
     /// \return true if the specifed pass' counters are already scheduled in a single pass, false otherwise
-    bool CheckAllCountersScheduledInSamePass(std::list<GPACounterPass>& passPartitions, GPACounterPass pass, unsigned int& passIndex)
+    bool CheckAllCountersScheduledInSamePass(const GPACounterPassList& passPartitions, const GPACounterPass& pass, unsigned int& passIndex)
     {
-        bool retVal = false;
+        unsigned int numPasses = (unsigned int)passPartitions.size();
 
-        passIndex = 0;
-
-        for (auto iterator = passPartitions.cbegin(); iterator != passPartitions.cend(); ++iterator, passIndex++)
+        for (passIndex = 0; passIndex < numPasses; passIndex++)
         {
-            if (iterator->m_counters.size() < pass.m_counters.size())
+            const GPACounterPass& existingPass = passPartitions[passIndex];
+
+            if (existingPass.m_counters.size() < pass.m_counters.size())
             {
                 // current pass has fewer counters than pass to be scheduled
                 continue;
             }
 
             // for each pre-existing pass, see if the current pass' counters are already scheduled
-            bool allCountersInSamePass = true;
-
-            for (auto passIter = pass.m_counters.cbegin(); passIter != pass.m_counters.cend(); ++passIter)
+            if (pass.m_counterBits.IsSubsetOf(existingPass.m_counterBits))
             {
-                if (this->VectorContains<unsigned int>(iterator->m_counters, *passIter) == -1)
-                {
-                    allCountersInSamePass = false;
-                    break;
-                }
-            }
-
-            if (allCountersInSamePass)
-            {
-                retVal = true;
-                break;
+                return true;
             }
         }
 
-        return retVal;
+        return false;
     }
 
     /// Inserts each public counter into the earliest possible pass.
@@ -185,10 +531,10 @@ private:
     /// \param maxCountersPerGroup A vector containing the maximum number of simultaneous counters for each block
     /// \param[in,out] numScheduledCounters The total number of counters that were scheduled
     /// \param maxInternalCountersPerPass the maximum number of counters per pass
-    void InsertPublicCounters(std::list<GPACounterPass>& passPartitions,
+    void InsertPublicCounters(GPACounterPassList& passPartitions,
                               const std::vector<const GPA_PublicCounter*>& publicCountersToSplit,
-                              IGPACounterAccessor* accessor,
-                              std::list<PerPassData>& numUsedCountersPerPassPerBlock,
+                              const IGPACounterAccessor* accessor,
+                              std::vector<PerPassData>& numUsedCountersPerPassPerBlock,
                               const std::vector<unsigned int>& maxCountersPerGroup,
                               unsigned int& numScheduledCounters,
                               unsigned int maxInternalCountersPerPass)
@@ -203,12 +549,8 @@ private:
             // make sure there is enough space for the next pass
             AddNewPassInfo(1, passPartitions, numUsedCountersPerPassPerBlock);
 
-            // reset the iterators to the beginning each time we are trying to schedule a different public counter
-            auto countersUsedIter = numUsedCountersPerPassPerBlock.begin();
-            auto counterPassIter = passPartitions.begin();
-
             // find out the minimum required passes for the public counter
-            const std::list<GPACounterPass> singleCounterPasses = SplitSingleCounter(*publicIter, accessor, maxCountersPerGroup);
+            const GPACounterPassList singleCounterPasses = SplitSingleCounter(*publicIter, accessor, maxCountersPerGroup);
 
             /// contains a map between the pass index for a single split public counter and the pass index
             /// for a previously scheduled pass that contains all of the hw counters for that pass
@@ -229,8 +571,6 @@ private:
             {
                 // these variables keep track of which pass within the single counter is currently being evaluated
                 unsigned int singleCounterPassIndex = 0;
-                auto tmpCountersUsedIter = countersUsedIter;
-                auto tmpCounterPassIter = counterPassIter;
 
                 bool allPassesAreGood = true;
                 unsigned int singlePassIndex = 0;
@@ -254,35 +594,30 @@ private:
                     // make sure there is enough space for the next pass
                     AddNewPassInfo(singleCounterPassIndex + startCounterPassIndex + 1, passPartitions, numUsedCountersPerPassPerBlock);
 
-                    if (singleCounterPassIndex > 0)
-                    {
-                        ++tmpCountersUsedIter;
-                        ++tmpCounterPassIter;
-                    }
+                    const GPACounterPass& tmpCounterPass = passPartitions[startCounterPassIndex + singleCounterPassIndex];
 
                     // limit the pass to a maximum number of counters
-                    if (tmpCounterPassIter->m_counters.size() + singleCounterPassIter->m_counters.size() > maxInternalCountersPerPass)
+                    if (tmpCounterPass.m_counters.size() + singleCounterPassIter->m_counters.size() > maxInternalCountersPerPass)
                     {
                         allPassesAreGood = false;
                     }
                     else
                     {
                         // local temp copy of the current pass info so that internal counters can be properly tracked for our 'testing' of the counters.
-                        PerPassData tmpCurCountersUsed = *tmpCountersUsedIter;
+                        PerPassData tmpCurCountersUsed = numUsedCountersPerPassPerBlock[startCounterPassIndex + singleCounterPassIndex];
 
                         // test each internal counter to see if they can all fit in the current consolidated passes
                         for (auto internalCounterIter = singleCounterPassIter->m_counters.cbegin(); internalCounterIter != singleCounterPassIter->m_counters.cend(); ++internalCounterIter)
                         {
                             // if the counter is already there, no need to add it
-                            if (this->VectorContains<unsigned int>(tmpCounterPassIter->m_counters, *internalCounterIter) == -1)
+                            if (!tmpCounterPass.ContainsCounter(*internalCounterIter))
                             {
                                 // check to see if the counter can be added
-                                accessor->SetCounterIndex(*internalCounterIter);
-                                unsigned int groupIndex = accessor->GroupIndex();
+                                const GPACounterGroupLocation counterLocation = accessor->GetCounterLocation(*internalCounterIter);
 
-                                if (this->CheckForTimestampCounters(accessor, *internalCounterIter, *counterPassIter) == false ||
-                                    this->CanCounterBeAdded(accessor, tmpCurCountersUsed, maxCountersPerGroup) == false ||
-                                    this->CheckForSQCounters(accessor, tmpCurCountersUsed, m_maxSQCounters) == false)
+                                if (this->CheckForTimestampCounters(counterLocation, *internalCounterIter, passPartitions[startCounterPassIndex]) == false ||
+                                    this->CanCounterBeAdded(counterLocation, tmpCurCountersUsed, maxCountersPerGroup) == false ||
+                                    this->CheckForSQCounters(counterLocation, tmpCurCountersUsed, m_maxSQCounters) == false)
                                 {
                                     allPassesAreGood = false;
                                     break;
@@ -290,7 +625,7 @@ private:
                                 else
                                 {
                                     // track that the internal counters was 'scheduled'
-                                    tmpCurCountersUsed.m_numUsedCountersPerBlock[groupIndex].push_back(accessor->CounterIndex());
+                                    AddCounterToPassData(counterLocation, tmpCurCountersUsed);
                                 }
                             }
                         }
@@ -303,8 +638,6 @@ private:
                         // iterate to the next pass and see if the counters are better here.
                         ++singleCounterPassIndex;
                         AddNewPassInfo(singleCounterPassIndex + startCounterPassIndex + 1, passPartitions, numUsedCountersPerPassPerBlock);
-                        ++countersUsedIter;
-                        ++counterPassIter;
                         break;
                     }
                     else
@@ -330,7 +663,7 @@ private:
 
             // now actually add the counter to the found pass
             // iterate through all the internal counters and add them to the appropriate passes
-            unsigned int passIndex = startCounterPassIndex;
+            unsigned int counterPassIndex = startCounterPassIndex;
 
             unsigned int singlePassIndex = 0;
 
@@ -339,25 +672,14 @@ private:
                 // Check if the existingPasses mapping contains this pass -- if so, then we have to use the counter result location already added to the m_counterResultLocationMap member
                 if (existingPasses.find(singlePassIndex) != existingPasses.cend())
                 {
-                    passIndex = existingPasses[singlePassIndex];
+                    unsigned int passIndex = existingPasses[singlePassIndex];
 
                     for (auto internalCounterIter = singleCounterPassIter->m_counters.cbegin(); internalCounterIter != singleCounterPassIter->m_counters.cend(); ++internalCounterIter)
                     {
                         unsigned int publicCounterIndex = (*publicIter)->m_index;
                         unsigned int hardwareCounterIndex = *internalCounterIter;
 
-                        unsigned int curPass = 0;
-                        auto it = passPartitions.cbegin();
-
-                        for (; it != passPartitions.cend(); ++it, curPass++)
-                        {
-                            if (curPass == passIndex)
-                            {
-                                break;
-                            }
-                        }
-
-                        int existingIndex = this->VectorContains<unsigned int>(it->m_counters, hardwareCounterIndex);
+                        int existingIndex = passPartitions[passIndex].GetCounterOffset(hardwareCounterIndex);
 
                         // we don't expect this to fail since we found these counters in "existingPasses"
                         assert(-1 != existingIndex);
@@ -374,32 +696,29 @@ private:
                         unsigned int hardwareCounterIndex = *internalCounterIter;
 
                         // only add the counter if it is not already there
-                        int existingIndex = this->VectorContains<unsigned int>(counterPassIter->m_counters, hardwareCounterIndex);
+                        int existingIndex = passPartitions[counterPassIndex].GetCounterOffset(hardwareCounterIndex);
 
                         if (existingIndex == -1)
                         {
-                            accessor->SetCounterIndex(*internalCounterIter);
-                            counterPassIter->m_counters.push_back(*internalCounterIter);
-                            countersUsedIter->m_numUsedCountersPerBlock[accessor->GroupIndex()].push_back(accessor->CounterIndex());
+                            const GPACounterGroupLocation counterLocation = accessor->GetCounterLocation(*internalCounterIter);
+                            AddCounterToPass(counterLocation, *internalCounterIter, passPartitions[counterPassIndex], numUsedCountersPerPassPerBlock[counterPassIndex]);
                             numScheduledCounters += 1;
 
-                            unsigned int offset = (unsigned int)counterPassIter->m_counters.size() - 1;
-                            AddCounterResultLocation(publicCounterIndex, hardwareCounterIndex, passIndex, offset);
+                            unsigned int offset = (unsigned int)passPartitions[counterPassIndex].m_counters.size() - 1;
+                            AddCounterResultLocation(publicCounterIndex, hardwareCounterIndex, counterPassIndex, offset);
                         }
                         else
                         {
                             unsigned int offset = (unsigned int)existingIndex;
-                            AddCounterResultLocation(publicCounterIndex, hardwareCounterIndex, passIndex, offset);
+                            AddCounterResultLocation(publicCounterIndex, hardwareCounterIndex, counterPassIndex, offset);
                         }
                     }
 
                     // increment to the next pass
-                    ++counterPassIter;
-                    ++countersUsedIter;
+                    ++counterPassIndex;
                 }
 
                 singlePassIndex++;
-                passIndex++;
             }
         }
     }
@@ -412,10 +731,10 @@ private:
     /// \param numUsedCountersPerPassPerBlock A list of passes, each consisting of the number of counters scheduled on each block
     /// \param maxCountersPerGroup A vector containing the maximum number of simultaneous counters for each block
     /// \param[in,out] numScheduledCounters The total number of internal counters that were scheduled
-    void InsertHardwareCounters(std::list<GPACounterPass>& passPartitions,
+    void InsertHardwareCounters(GPACounterPassList& passPartitions,
                                 const std::vector<GPAHardwareCounterIndices> internalCounters,
-                                IGPACounterAccessor* pAccessor,
-                                std::list<PerPassData>& numUsedCountersPerPassPerBlock,
+                                const IGPACounterAccessor* pAccessor,
+                                std::vector<PerPassData>& numUsedCountersPerPassPerBlock,
                                 const std::vector<unsigned int>& maxCountersPerGroup,
                                 unsigned int& numScheduledCounters)
     {
@@ -428,7 +747,7 @@ private:
 
             for (auto passIter = passPartitions.cbegin(); passIter != passPartitions.cend(); ++passIter)
             {
-                int existingOffset = VectorContains<unsigned int>(passIter->m_counters, internalCounterIter->m_hardwareIndex);
+                int existingOffset = passIter->GetCounterOffset(internalCounterIter->m_hardwareIndex);
 
                 if (existingOffset >= 0)
                 {
@@ -453,37 +772,31 @@ private:
             // make sure there is enough space for the first pass
             AddNewPassInfo(1, passPartitions, numUsedCountersPerPassPerBlock);
 
-            pAccessor->SetCounterIndex(internalCounterIter->m_hardwareIndex);
+            const GPACounterGroupLocation counterLocation = pAccessor->GetCounterLocation(internalCounterIter->m_hardwareIndex);
 
             // Iterate through the passes again and find one where the counter can be inserted.
-            passIndex = 0;
-            auto countersUsedIter = numUsedCountersPerPassPerBlock.begin();
-
-            for (auto passIter = passPartitions.begin(); passIter != passPartitions.end(); ++passIter)
+            for (passIndex = 0; passIndex < passPartitions.size(); ++passIndex)
             {
-                if (this->CheckForTimestampCounters(pAccessor, internalCounterIter->m_hardwareIndex, *passIter) == true &&
-                    this->CanCounterBeAdded(pAccessor, *countersUsedIter, maxCountersPerGroup) == true &&
-                    this->CheckForSQCounters(pAccessor, *countersUsedIter, m_maxSQCounters) == true)
+                GPACounterPass& pass = passPartitions[passIndex];
+                PerPassData& countersUsed = numUsedCountersPerPassPerBlock[passIndex];
+
+                if (this->CheckForTimestampCounters(counterLocation, internalCounterIter->m_hardwareIndex, pass) == true &&
+                    this->CanCounterBeAdded(counterLocation, countersUsed, maxCountersPerGroup) == true &&
+                    this->CheckForSQCounters(counterLocation, countersUsed, m_maxSQCounters) == true)
                 {
                     // the counter can be scheduled here.
-                    passIter->m_counters.push_back(internalCounterIter->m_hardwareIndex);
-                    countersUsedIter->m_numUsedCountersPerBlock[pAccessor->GroupIndex()].push_back(pAccessor->CounterIndex());
+                    AddCounterToPass(counterLocation, internalCounterIter->m_hardwareIndex, pass, countersUsed);
                     numScheduledCounters += 1;
 
                     // record where the result will be located
-                    unsigned int offset = (unsigned int)passIter->m_counters.size() - 1;
+                    unsigned int offset = (unsigned int)pass.m_counters.size() - 1;
                     AddCounterResultLocation(internalCounterIter->m_publicIndex, internalCounterIter->m_hardwareIndex, passIndex, offset);
                     break;
                 }
                 else
                 {
-                    ++passIndex;
-
                     // make sure there is enough space for the next pass
-                    AddNewPassInfo(passIndex + 1, passPartitions, numUsedCountersPerPassPerBlock);
-
-                    // increment the iterator after any necessary new passes have been allocated.
-                    ++countersUsedIter;
+                    AddNewPassInfo(passIndex + 2, passPartitions, numUsedCountersPerPassPerBlock);
                 }
             }
         }
@@ -497,10 +810,10 @@ private:
     /// \param numUsedCountersPerPassPerBlock A list of passes, each consisting of the number of counters scheduled on each block
     /// \param maxCountersPerGroup A vector containing the maximum number of simultaneous counters for each block
     /// \param[in,out] numScheduledCounters The total number of internal counters that were scheduled
-    void InsertSoftwareCounters(std::list<GPACounterPass>& passPartitions,
+    void InsertSoftwareCounters(GPACounterPassList& passPartitions,
                                 const std::vector<GPASoftwareCounterIndices> swCountersToSchedule,
-                                IGPACounterAccessor* pAccessor,
-                                std::list<PerPassData>& numUsedCountersPerPassPerBlock,
+                                const IGPACounterAccessor* pAccessor,
+                                std::vector<PerPassData>& numUsedCountersPerPassPerBlock,
                                 const std::vector<unsigned int>& maxCountersPerGroup,
                                 unsigned int& numScheduledCounters)
     {
@@ -526,8 +839,7 @@ private:
 
                 while ((passPartitions.end() != passIter) && (!counterAlreadyScheduled))
                 {
-                    int existingOffset =
-                        VectorContains<unsigned int>(passIter->m_counters, swCounter.m_softwareIndex);
+                    int existingOffset = passIter->GetCounterOffset(swCounter.m_softwareIndex);
 
                     if (existingOffset >= 0)
                     {
@@ -542,27 +854,22 @@ private:
 
                 if (!counterAlreadyScheduled)
                 {
-                    auto revPassIter = passPartitions.rbegin();
                     passIndex = static_cast<unsigned int>(passPartitions.size() - 1);
-                    auto countersUsedIter = numUsedCountersPerPassPerBlock.begin();
                     swTimePass = IsTimestampQueryCounter(swCounter.m_publicIndex);
 
-                    if ((revPassIter->m_counters.size() >= maxScheduledCountersInPassCount) || (!swTimePass && s_pSwCounterManager->SwGPUTimeCounterEnabled()))
+                    if ((passPartitions[passIndex].m_counters.size() >= maxScheduledCountersInPassCount) || (!swTimePass && s_pSwCounterManager->SwGPUTimeCounterEnabled()))
                     {
                         if (firstNonTimeCounter)
                         {
                             ++passIndex;
                             AddNewPassInfo(passIndex + 1, passPartitions, numUsedCountersPerPassPerBlock);
-                            revPassIter = passPartitions.rbegin();
                             firstNonTimeCounter = false;
                         }
                     }
 
-                    revPassIter->m_counters.push_back(swCounter.m_softwareIndex);
-                    pAccessor->SetCounterIndex(swCounter.m_softwareIndex);
-                    countersUsedIter->m_numUsedCountersPerBlock[pAccessor->GroupIndex()].push_back(
-                        pAccessor->CounterIndex());
-                    unsigned int offset = static_cast<unsigned int>(revPassIter->m_counters.size() - 1);
+                    const GPACounterGroupLocation counterLocation = pAccessor->GetCounterLocation(swCounter.m_softwareIndex);
+                    AddCounterToPass(counterLocation, swCounter.m_softwareIndex, passPartitions[passIndex], numUsedCountersPerPassPerBlock[passIndex]);
+                    unsigned int offset = static_cast<unsigned int>(passPartitions[passIndex].m_counters.size() - 1);
                     AddCounterResultLocation(
                         swCounter.m_publicIndex, swCounter.m_softwareIndex, passIndex, offset);
                     s_pSwCounterManager->AddSwCounterMap(
@@ -581,63 +888,39 @@ private:
     /// \param pAccessor the counter accessor for the counter
     /// \param maxCountersPerGroup the list of max counters per group
     /// \return a list of passes
-    std::list<GPACounterPass> SplitSingleCounter(const GPA_PublicCounter* pPublicCounter, IGPACounterAccessor* pAccessor, const std::vector<unsigned int>& maxCountersPerGroup)
+    GPACounterPassList SplitSingleCounter(const GPA_PublicCounter* pPublicCounter, const IGPACounterAccessor* pAccessor, const std::vector<unsigned int>& maxCountersPerGroup)
     {
         // this will eventually be the return value
-        std::list<GPACounterPass> passPartitions;
-        GPACounterPass counterPass;
-        passPartitions.push_back(counterPass);
+        GPACounterPassList passPartitions(1);
 
         // temporary variable to hold the number of counters assigned to each block during each of the passes.
-        std::list<PerPassData> numUsedCountersPerPassPerBlock;
-        PerPassData newPass;
-        numUsedCountersPerPassPerBlock.push_back(newPass);
-
-        // copy the set of unallocated counters
-        std::vector<gpa_uint32> countersUnallocated = pPublicCounter->m_internalCountersRequired;
+        std::vector<PerPassData> numUsedCountersPerPassPerBlock(1);
 
         // iterate through the unallocated counters and put them into the appropriate pass
-        for (auto counterIter = countersUnallocated.cbegin(); counterIter != countersUnallocated.cend(); ++counterIter)
+        const gpa_uint32* pInternalCountersEnd = pPublicCounter->m_pInternalCountersRequired + pPublicCounter->m_numInternalCountersRequired;
+
+        for (const gpa_uint32* counterIter = pPublicCounter->m_pInternalCountersRequired; counterIter != pInternalCountersEnd; ++counterIter)
         {
             unsigned int passIndex = 0;
-            auto countersUsedIter = numUsedCountersPerPassPerBlock.begin();
-            auto counterPassIter = passPartitions.begin();
 
             bool doneAllocatingCounter = false;
 
+            const GPACounterGroupLocation counterLocation = pAccessor->GetCounterLocation(*counterIter);
+
             while (doneAllocatingCounter == false)
             {
-                // make sure there is a partition for current pass
-                while (passIndex >= passPartitions.size())
-                {
-                    GPACounterPass counterPassInner;
-                    passPartitions.push_back(counterPassInner);
-                }
-
-                // make sure there are counts for the number of used counters for current pass
-                while (passIndex >= numUsedCountersPerPassPerBlock.size())
-                {
-                    PerPassData newPassInner;
-                    numUsedCountersPerPassPerBlock.push_back(newPassInner);
-                }
-
-                // increment the pass iterator if past the first loop
-                if (passIndex > 0)
-                {
-                    ++countersUsedIter;
-                    ++counterPassIter;
-                }
+                // make sure there is a partition and counts for the number of used counters for current pass
+                AddNewPassInfo(passIndex + 1, passPartitions, numUsedCountersPerPassPerBlock);
 
-                pAccessor->SetCounterIndex(*counterIter);
-                unsigned int groupIndex = pAccessor->GroupIndex();
+                GPACounterPass& counterPass = passPartitions[passIndex];
+                PerPassData& countersUsed = numUsedCountersPerPassPerBlock[passIndex];
 
                 // try to add the counter to the current pass
-                if (this->CheckForTimestampCounters(pAccessor, *counterIter, *counterPassIter) &&
-                    this->CanCounterBeAdded(pAccessor, *countersUsedIter, maxCountersPerGroup) &&
-                    this->CheckForSQCounters(pAccessor, *countersUsedIter, m_maxSQCounters))
+                if (this->CheckForTimestampCounters(counterLocation, *counterIter, counterPass) &&
+                    this->CanCounterBeAdded(counterLocation, countersUsed, maxCountersPerGroup) &&
+                    this->CheckForSQCounters(counterLocation, countersUsed, m_maxSQCounters))
                 {
-                    counterPassIter->m_counters.push_back(*counterIter);
-                    countersUsedIter->m_numUsedCountersPerBlock[groupIndex].push_back(pAccessor->CounterIndex());
+                    AddCounterToPass(counterLocation, *counterIter, counterPass, countersUsed);
                     doneAllocatingCounter = true;
                 }
                 else
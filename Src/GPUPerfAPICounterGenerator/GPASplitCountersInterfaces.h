@@ -9,7 +9,6 @@
 #define _GPA_SPLIT_COUNTER_INTERFACES_H_
 
 #include "GPAPublicCounters.h"
-#include <list>
 #include <vector>
 #include <map>
 #include <algorithm>
@@ -36,20 +35,146 @@ struct GPA_SQCounterGroupDesc
     GPA_SQShaderStage m_stage;          ///< the shader stage for this group
 };
 
+/// A set of counter indices, stored as one bit per index so that membership and subset tests do not need to scan a list of counters.
+class GPACounterBitSet
+{
+public:
+    /// Checks if an index is in the set.
+    /// \param index The index to check.
+    /// \return True if the index is in the set, false otherwise.
+    bool Test(unsigned int index) const
+    {
+        size_t wordIndex = index / ms_bitsPerWord;
+        return wordIndex < m_words.size() && 0 != (m_words[wordIndex] & (static_cast<gpa_uint64>(1) << (index % ms_bitsPerWord)));
+    }
+
+    /// Adds an index to the set.
+    /// \param index The index to add.
+    void Set(unsigned int index)
+    {
+        size_t wordIndex = index / ms_bitsPerWord;
+
+        if (wordIndex >= m_words.size())
+        {
+            m_words.resize(wordIndex + 1, 0);
+        }
+
+        m_words[wordIndex] |= static_cast<gpa_uint64>(1) << (index % ms_bitsPerWord);
+    }
+
+    /// Removes an index from the set.
+    /// \param index The index to remove.
+    void Reset(unsigned int index)
+    {
+        size_t wordIndex = index / ms_bitsPerWord;
+
+        if (wordIndex < m_words.size())
+        {
+            m_words[wordIndex] &= ~(static_cast<gpa_uint64>(1) << (index % ms_bitsPerWord));
+        }
+    }
+
+    /// Checks if every index in this set is also in another set.
+    /// \param other The set to compare against.
+    /// \return True if this set is a subset of other, false otherwise.
+    bool IsSubsetOf(const GPACounterBitSet& other) const
+    {
+        for (size_t i = 0; i < m_words.size(); i++)
+        {
+            gpa_uint64 otherWord = i < other.m_words.size() ? other.m_words[i] : 0;
+
+            if (0 != (m_words[i] & ~otherWord))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+private:
+    static const unsigned int ms_bitsPerWord = 64; ///< The number of indices stored in each word
+    std::vector<gpa_uint64> m_words;               ///< The bits of the set; bit i of word w represents index (w * 64 + i)
+};
+
 /// structure to store the counters that are assigned to a particular pass.
 struct GPACounterPass
 {
-    /// The counters assigned to a profile pass.
+    /// The counters assigned to a profile pass, in the order in which their results are returned.
     std::vector<unsigned int> m_counters;
+
+    /// The same counters as m_counters, used for membership tests.
+    GPACounterBitSet m_counterBits;
+
+    /// Checks if a counter is assigned to the pass.
+    /// \param counterIndex The counter to check.
+    /// \return True if the counter is in the pass, false otherwise.
+    bool ContainsCounter(unsigned int counterIndex) const
+    {
+        return m_counterBits.Test(counterIndex);
+    }
+
+    /// Gets the offset of a counter within the pass.
+    /// \param counterIndex The counter to find.
+    /// \return -1 if the counter is not in the pass.
+    /// \return The offset of the counter within the pass if it is.
+    int GetCounterOffset(unsigned int counterIndex) const
+    {
+        if (!m_counterBits.Test(counterIndex))
+        {
+            return -1;
+        }
+
+        int numCounters = (int)m_counters.size();
+
+        for (int i = 0; i < numCounters; i++)
+        {
+            if (m_counters[i] == counterIndex)
+            {
+                return i;
+            }
+        }
+
+        return -1;
+    }
+
+    /// Appends a counter to the pass.
+    /// \param counterIndex The counter to add.
+    void AddCounter(unsigned int counterIndex)
+    {
+        m_counters.push_back(counterIndex);
+        m_counterBits.Set(counterIndex);
+    }
+
+    /// Removes the counter that was most recently appended to the pass.
+    void RemoveLastCounter()
+    {
+        m_counterBits.Reset(m_counters.back());
+        m_counters.pop_back();
+    }
 };
 
-typedef std::list<GPACounterPass> GPACounterPassList; ///< Typedef for a list of counter passes
+typedef std::vector<GPACounterPass> GPACounterPassList; ///< Typedef for a list of counter passes
 
 /// Stores the number of counters from each block that are used in a particular pass.
 struct PerPassData
 {
-    /// The list of counters used from each HW block. Map from group index to list of counters
-    std::map<unsigned int, std::vector<gpa_uint32> > m_numUsedCountersPerBlock;
+    /// Initializes a new instance of the PerPassData struct.
+    PerPassData() : m_sqStage(-1)
+    {
+    }
+
+    /// The number of counters used from each HW block or SW group, indexed by global group index.
+    std::vector<unsigned int> m_numUsedCountersPerGroup;
+
+    /// The SQ shader stage of the SQ counters used in the pass, or -1 if the pass does not use any SQ counters.
+    int m_sqStage;
+
+    /// The distinct SQ counters used in the pass (a counter enabled on several shader engines only appears once).
+    std::vector<unsigned int> m_sqCounters;
+
+    /// The number of SQ groups on which each of the counters in m_sqCounters is enabled.
+    std::vector<unsigned int> m_sqCounterUseCounts;
 };
 
 /// Stores the counter indices for hardware counters
@@ -74,7 +199,19 @@ public:
     gpa_uint16 m_offset; ///< offset within pass ( 0 is first counter )
 };
 
+/// The group and counter of an internal counter, as resolved by IGPACounterAccessor
+struct GPACounterGroupLocation
+{
+    unsigned int m_groupIndex;       ///< 0-based group index of the internal counter
+    unsigned int m_counterIndex;     ///< 0-based counter index of the internal counter within its group
+    unsigned int m_globalGroupIndex; ///< global group index (the full index of the software groups that come after the hardware groups)
+    bool m_isHW;                     ///< true if the counter is a hardware counter
+    bool m_isAdditionalHW;           ///< true if the counter is an additional hardware counter (one exposed by the driver, but not by GPA)
+    bool m_isSW;                     ///< true if the counter is a software counter
+};
+
 /// Interface for accessing information of an internal counter.
+/// Implementations are not modified by lookups, so that a single accessor can be shared by the splitters and between threads.
 class IGPACounterAccessor
 {
 public:
@@ -85,29 +222,10 @@ public:
     /// Virtual destructor
     virtual ~IGPACounterAccessor() {};
 
-    /// Sets the counter index of which to get the group and counter Id.
-    /// \param index The counter index.
-    virtual void SetCounterIndex(unsigned int index) = 0;
-
-    /// Get the 0-based group index of the internal counter.
-    /// \return The group index.
-    virtual unsigned int GroupIndex() const = 0;
-
-    /// Get the 0-based counter index of the internal counter.
-    /// \return The counter index.
-    virtual unsigned int CounterIndex() const = 0;
-
-    /// Get the hardware counter bool
-    /// \return True if the counter is a hardware counter
-    virtual bool IsHWCounter() const = 0;
-
-    /// Get the software counter bool
-    /// \return True if the counter is a software counter
-    virtual bool  IsSWCounter() const = 0;
-
-    /// Get the global group group index (the full index of the software groups that come after the hardware groups)
-    /// \return The total number of groups
-    virtual unsigned int GlobalGroupIndex() const = 0;
+    /// Gets the group and counter of an internal counter.
+    /// \param index The global index of the internal counter.
+    /// \return The location of the counter.
+    virtual GPACounterGroupLocation GetCounterLocation(unsigned int index) const = 0;
 };
 
 /// Interface for a class that can split public and internal counters into separate passes.
@@ -134,16 +252,21 @@ public:
     {
         for (unsigned int i = 0; i < numSQGroups; i++)
         {
-            m_sqCounterIndexMap[pSQCounterBlockInfo[i].m_groupIndex] = pSQCounterBlockInfo[i];
-            m_sqShaderStageGroupMap[pSQCounterBlockInfo[i].m_stage].push_back(pSQCounterBlockInfo[i].m_groupIndex);
+            gpa_uint32 groupIndex = pSQCounterBlockInfo[i].m_groupIndex;
+
+            if (groupIndex >= m_sqStagePerGroup.size())
+            {
+                m_sqStagePerGroup.resize(groupIndex + 1, -1);
+            }
+
+            m_sqStagePerGroup[groupIndex] = pSQCounterBlockInfo[i].m_stage;
         }
     }
 
     /// Destructor
     virtual ~IGPASplitCounters()
     {
-        m_sqCounterIndexMap.clear();
-        m_sqShaderStageGroupMap.clear();
+        m_sqStagePerGroup.clear();
     }
 
     /// Splits counters into multiple passes.
@@ -154,12 +277,38 @@ public:
     /// \param maxCountersPerGroup The maximum number of counters that can be enabled in a single pass on each HW block or SW group.
     /// \param[out] numScheduledCounters Indicates the total number of internal counters that were assigned to a pass.
     /// \return The list of passes that the counters are separated into.
-    virtual std::list<GPACounterPass> SplitCounters(const std::vector<const GPA_PublicCounter*>& publicCountersToSplit,
-                                                    const std::vector<GPAHardwareCounterIndices> internalCountersToSchedule,
-                                                    const std::vector<GPASoftwareCounterIndices>  softwareCountersToSchedule,
-                                                    IGPACounterAccessor* pAccessor,
-                                                    const std::vector<unsigned int>& maxCountersPerGroup,
-                                                    unsigned int& numScheduledCounters) = 0;
+    virtual GPACounterPassList SplitCounters(const std::vector<const GPA_PublicCounter*>& publicCountersToSplit,
+                                             const std::vector<GPAHardwareCounterIndices> internalCountersToSchedule,
+                                             const std::vector<GPASoftwareCounterIndices>  softwareCountersToSchedule,
+                                             const IGPACounterAccessor* pAccessor,
+                                             const std::vector<unsigned int>& maxCountersPerGroup,
+                                             unsigned int& numScheduledCounters) = 0;
+
+    /// Updates passes that were previously computed by this kind of splitter for counters that were enabled or disabled since, instead of splitting
+    /// all of the enabled counters again. The result locations of the counters in the passes must be set with SwapCounterResultLocations first.
+    /// The default implementation does not support updating passes.
+    /// \param[in,out] passPartitions The passes to update.
+    /// \param countersToRemove The indices of the counters that are no longer enabled.
+    /// \param publicCountersToAdd The public counters that were enabled.
+    /// \param hardwareCountersToAdd The hardware counters that were enabled.
+    /// \param pAccessor A class to access the internal counters.
+    /// \param maxCountersPerGroup The maximum number of counters that can be enabled in a single pass on each HW block or SW group.
+    /// \return True if the passes and result locations were updated; false if the counters need to be split again, in which case the passes are unchanged.
+    virtual bool UpdatePasses(GPACounterPassList& passPartitions,
+                              const std::vector<unsigned int>& countersToRemove,
+                              const std::vector<const GPA_PublicCounter*>& publicCountersToAdd,
+                              const std::vector<GPAHardwareCounterIndices>& hardwareCountersToAdd,
+                              const IGPACounterAccessor* pAccessor,
+                              const std::vector<unsigned int>& maxCountersPerGroup)
+    {
+        UNREFERENCED_PARAMETER(passPartitions);
+        UNREFERENCED_PARAMETER(countersToRemove);
+        UNREFERENCED_PARAMETER(publicCountersToAdd);
+        UNREFERENCED_PARAMETER(hardwareCountersToAdd);
+        UNREFERENCED_PARAMETER(pAccessor);
+        UNREFERENCED_PARAMETER(maxCountersPerGroup);
+        return false;
+    }
 
     /// Get the counter result locations
     /// \return The map of counter result locations
@@ -168,6 +317,13 @@ public:
         return m_counterResultLocationMap;
     }
 
+    /// Exchange the counter result locations with those of previously computed passes, so that they can be updated by UpdatePasses without copying them
+    /// \param[in,out] counterResultLocations The map of counter result locations
+    void SwapCounterResultLocations(std::map< unsigned int, std::map<unsigned int, GPA_CounterResultLocation> >& counterResultLocations)
+    {
+        m_counterResultLocationMap.swap(counterResultLocations);
+    }
+
 protected:
 
     unsigned int m_gpuTimestampGroupIndex; ///< index of the GPUTimestamp group (-1 if it doesn't exist)
@@ -175,8 +331,7 @@ protected:
     unsigned int m_gpuTimestampTopToBottomCounterIndex;      ///< index of the Top-to-Bottom GPUTime counter (-1 if it doesn't exist)
     unsigned int m_maxSQCounters; ///< The maximum number of counters that can be enabled in the SQ group
 
-    std::map<gpa_uint32, GPA_SQCounterGroupDesc> m_sqCounterIndexMap;           ///< map from group index to the SQ counter group description for that group
-    std::map<GPA_SQShaderStage, vector<unsigned int> > m_sqShaderStageGroupMap; ///< map from shader stage to the list of SQ groups for that stage
+    std::vector<int> m_sqStagePerGroup; ///< the SQ shader stage of each group, indexed by global group index (-1 for groups that are not SQ groups)
 
     /// A map between a public counter index and the set of hardware counters that compose the public counter.
     /// For each hardware counter, there is a map from the hardware counter to the counter result location (pass and offset) for that specific counter.
@@ -199,57 +354,124 @@ protected:
         m_counterResultLocationMap[publicCounterIndex][hardwareCounterIndex] = location;
     }
 
-    /// Scans a vector to determine if it contains a specified element.
-    /// \param array The vector to scan.
-    /// \param element The item to search for.
-    /// \return -1 if the vector does not contain the element.
-    /// \return The index of the element if the vector does contain it.
-    template <class T> int VectorContains(const vector<T>& array, const T& element)
+    /// Gets the SQ shader stage of a group.
+    /// \param groupIndex The global index of the group.
+    /// \return The shader stage of the group, or -1 if the group is not an SQ group.
+    int GetSQStage(unsigned int groupIndex) const
     {
-        int arraySize = (int)array.size();
+        return groupIndex < m_sqStagePerGroup.size() ? m_sqStagePerGroup[groupIndex] : -1;
+    }
 
-        for (int i = 0; i < arraySize; i++)
+    //--------------------------------------------------------------------------
+    /// Ensures that there are enough pass partitions and per pass data for the number of required passes.
+    /// \param numRequiredPasses The number of passes that must be available in the arrays.
+    /// \param[in,out] passPartitions The list to add additional pass partitions.
+    /// \param[in,out] numUsedCountersPerPassPerBlock The list to which additional used counter info should be added.
+    void AddNewPassInfo(unsigned int numRequiredPasses, GPACounterPassList& passPartitions, std::vector<PerPassData>& numUsedCountersPerPassPerBlock)
+    {
+        if (passPartitions.size() < numRequiredPasses)
+        {
+            passPartitions.resize(numRequiredPasses);
+            numUsedCountersPerPassPerBlock.resize(numRequiredPasses);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /// Records that a counter is used in a pass, so that later checks against the pass account for it.
+    /// \param location The location of the counter being added.
+    /// \param[in,out] passData The counters used in the pass.
+    void AddCounterToPassData(const GPACounterGroupLocation& location, PerPassData& passData) const
+    {
+        unsigned int groupIndex = location.m_globalGroupIndex;
+
+        if (groupIndex >= passData.m_numUsedCountersPerGroup.size())
         {
-            if (array[i] == element)
+            passData.m_numUsedCountersPerGroup.resize(groupIndex + 1, 0);
+        }
+
+        passData.m_numUsedCountersPerGroup[groupIndex]++;
+
+        int sqStage = GetSQStage(groupIndex);
+
+        if (sqStage >= 0)
+        {
+            passData.m_sqStage = sqStage;
+            unsigned int counterIndex = location.m_counterIndex;
+
+            for (size_t i = 0; i < passData.m_sqCounters.size(); i++)
             {
-                return i;
+                if (passData.m_sqCounters[i] == counterIndex)
+                {
+                    passData.m_sqCounterUseCounts[i]++;
+                    return;
+                }
             }
-        }
 
-        return -1;
-    };
+            passData.m_sqCounters.push_back(counterIndex);
+            passData.m_sqCounterUseCounts.push_back(1);
+        }
+    }
 
     //--------------------------------------------------------------------------
-    /// Ensures that there are enough pass partitions and per pass data for the number of required passes.
-    /// \param numRequiredPasses The number of passes that must be available in the arrays.
-    /// \param[in,out] passPartitions The list to add additional pass partitions.
-    /// \param[in,out] numUsedCountersPerPassPerBlock The list to which additional used counter info should be added.
-    void AddNewPassInfo(unsigned int numRequiredPasses, std::list<GPACounterPass>& passPartitions, std::list<PerPassData>& numUsedCountersPerPassPerBlock)
+    /// Reverts AddCounterToPassData for a counter.
+    /// \param location The location of the counter being removed.
+    /// \param[in,out] passData The counters used in the pass.
+    void RemoveCounterFromPassData(const GPACounterGroupLocation& location, PerPassData& passData) const
     {
-        while (passPartitions.size() < numRequiredPasses)
+        unsigned int groupIndex = location.m_globalGroupIndex;
+        passData.m_numUsedCountersPerGroup[groupIndex]--;
+
+        if (GetSQStage(groupIndex) >= 0)
         {
-            GPACounterPass counterPass;
-            passPartitions.push_back(counterPass);
+            unsigned int counterIndex = location.m_counterIndex;
+
+            for (size_t i = 0; i < passData.m_sqCounters.size(); i++)
+            {
+                if (passData.m_sqCounters[i] == counterIndex)
+                {
+                    if (--passData.m_sqCounterUseCounts[i] == 0)
+                    {
+                        passData.m_sqCounters.erase(passData.m_sqCounters.begin() + i);
+                        passData.m_sqCounterUseCounts.erase(passData.m_sqCounterUseCounts.begin() + i);
+                    }
+
+                    break;
+                }
+            }
 
-            PerPassData newPass;
-            numUsedCountersPerPassPerBlock.push_back(newPass);
+            if (passData.m_sqCounters.empty())
+            {
+                passData.m_sqStage = -1;
+            }
         }
     }
 
+    //--------------------------------------------------------------------------
+    /// Adds a counter to a pass and records its use in the pass data.
+    /// \param location The location of the counter, as returned by the counter accessor for counterIndex.
+    /// \param counterIndex the index of the counter to add.
+    /// \param[in,out] pass The pass to add the counter to.
+    /// \param[in,out] passData The counters used in the pass.
+    void AddCounterToPass(const GPACounterGroupLocation& location, unsigned int counterIndex, GPACounterPass& pass, PerPassData& passData) const
+    {
+        pass.AddCounter(counterIndex);
+        AddCounterToPassData(location, passData);
+    }
+
     //--------------------------------------------------------------------------
     /// Tests to see if a counter can be added to the specified groupIndex based on the number of counters allowed in a single pass for a particular block / group.
-    /// \param pAccessor The counter accessor that describes the counter that needs to be scheduled.
+    /// \param location The location of the counter that needs to be scheduled.
     /// \param currentPassData Contains the number of counters enabled on each block in the current pass.
     /// \param maxCountersPerGroup Contains the maximum number of counters allowed on each block in a single pass.
     /// \return True if a counter can be added; false if not.
-    bool CanCounterBeAdded(const IGPACounterAccessor* pAccessor, PerPassData& currentPassData, const std::vector<unsigned int>& maxCountersPerGroup)
+    bool CanCounterBeAdded(const GPACounterGroupLocation& location, const PerPassData& currentPassData, const std::vector<unsigned int>& maxCountersPerGroup) const
     {
-        unsigned int groupIndex = pAccessor->GlobalGroupIndex();
-        size_t newGroupUsedCount = 1 ;
+        unsigned int groupIndex = location.m_globalGroupIndex;
+        unsigned int newGroupUsedCount = 1;
 
-        if (currentPassData.m_numUsedCountersPerBlock.count(groupIndex) > 0)
+        if (groupIndex < currentPassData.m_numUsedCountersPerGroup.size())
         {
-            newGroupUsedCount += currentPassData.m_numUsedCountersPerBlock[groupIndex].size();
+            newGroupUsedCount += currentPassData.m_numUsedCountersPerGroup[groupIndex];
         }
 
         unsigned int groupLimit = maxCountersPerGroup[groupIndex];
@@ -259,108 +481,53 @@ protected:
 
     //--------------------------------------------------------------------------
     /// Checks the current pass data to see if there are SQ counters on it, and will only allow counters belonging to the same SQ stage.
-    /// \param pAccessor counter accessor that describes the counter that needs to be scheduled.
+    /// \param location The location of the counter that needs to be scheduled.
     /// \param currentPassData The number of counters enabled on each block in the current pass.
     /// \param maxSQCounters The maximum number of simultaneous counters allowed on the SQ block.
     /// \return True if a counter can be added to the block specified by blockIndex; false if the counter cannot be scheduled.
-    bool CheckForSQCounters(const IGPACounterAccessor* pAccessor, PerPassData& currentPassData, unsigned int maxSQCounters)
+    bool CheckForSQCounters(const GPACounterGroupLocation& location, const PerPassData& currentPassData, unsigned int maxSQCounters) const
     {
-        unsigned int groupIndex = pAccessor->GlobalGroupIndex();
-        unsigned int counterIndex = pAccessor->CounterIndex();
+        int sqStage = GetSQStage(location.m_globalGroupIndex);
 
-        if (m_sqCounterIndexMap.count(groupIndex) == 0)
+        if (sqStage < 0)
         {
             // this counter is not an SQ counter so return true
             return true;
         }
 
-        GPA_SQCounterGroupDesc sqCounterGroup = m_sqCounterIndexMap[groupIndex];
-        vector<unsigned int> groups = m_sqShaderStageGroupMap[sqCounterGroup.m_stage]; // groups for this stage
-
-        //std::map<GPA_SQShaderStage, vector<unsigned int>> uniqueStageCounters;
-        vector<unsigned int> thisStageCounters;
-
-        // check if this counter has already been added (either via the current or a different shader engine)
-        for (vector<unsigned int>::const_iterator it = groups.begin(); it != groups.end(); ++it)
-        {
-            unsigned int thisGroupIndex = m_sqCounterIndexMap[*it].m_groupIndex;
-
-            if (currentPassData.m_numUsedCountersPerBlock.count(thisGroupIndex) > 0)
-            {
-                for (unsigned int i = 0; i < currentPassData.m_numUsedCountersPerBlock[thisGroupIndex].size(); i++)
-                {
-                    unsigned int curCounter = currentPassData.m_numUsedCountersPerBlock[thisGroupIndex][i];
-                    vector<unsigned int>::const_iterator it2 = std::find(thisStageCounters.begin(), thisStageCounters.end(), curCounter);
-
-                    if (it2 == thisStageCounters.end())
-                    {
-                        thisStageCounters.push_back(curCounter);
-                    }
-
-                    if (currentPassData.m_numUsedCountersPerBlock[thisGroupIndex][i] == counterIndex)
-                    {
-                        // this counter was already added via a different shader engine so allow it here
-                        return true;
-                    }
-                }
-            }
-        }
-
-        // now check that we haven't exceeded the max number of SQ counters in this stage
-        if (thisStageCounters.size() >= maxSQCounters)
+        if (currentPassData.m_sqStage >= 0 && currentPassData.m_sqStage != sqStage)
         {
+            // counters from a different stage are already enabled
             return false;
         }
 
-        // check that no counters from other stages are enabled
-
-        for (unsigned int i = SQ_ALL; i <= SQ_LAST; i++)
+        // check if this counter has already been added (either via the current or a different shader engine)
+        if (std::find(currentPassData.m_sqCounters.begin(), currentPassData.m_sqCounters.end(), location.m_counterIndex) != currentPassData.m_sqCounters.end())
         {
-            if ((GPA_SQShaderStage)i == sqCounterGroup.m_stage)
-            {
-                continue;
-            }
-
-            for (vector<unsigned int>::const_iterator it = m_sqShaderStageGroupMap[(GPA_SQShaderStage)i].begin(); it != m_sqShaderStageGroupMap[(GPA_SQShaderStage)i].end(); ++it)
-            {
-                if (currentPassData.m_numUsedCountersPerBlock[*it].size() > 0)
-                {
-                    return false;
-                }
-            }
+            return true;
         }
 
-        return true;
+        // now check that we haven't exceeded the max number of SQ counters in this stage
+        return currentPassData.m_sqCounters.size() < maxSQCounters;
     };
 
     //--------------------------------------------------------------------------
     /// Checks if there are timestamp counters -- the counters need to go in their own pass.
     /// This is because idle's must not be active when they are read, and when measuring counters idles are used.
-    /// \param pAccessor counter accessor that describes the counter that needs to be scheduled.
+    /// \param location The location of the counter that needs to be scheduled.
     /// \param counterIndex the counter index of the counter beign checked.
     /// \param currentPassCounters list of counters in current pass.
     /// \return true if the counter passes this check (not a timestamp, or it is a timestamp and can be added); false if the counter is a timestamp and cannot be added.
-    bool CheckForTimestampCounters(const IGPACounterAccessor* pAccessor, const unsigned int counterIndex, const GPACounterPass& currentPassCounters)
+    bool CheckForTimestampCounters(const GPACounterGroupLocation& location, const unsigned int counterIndex, const GPACounterPass& currentPassCounters) const
     {
-        unsigned int blockIndex = pAccessor->GlobalGroupIndex();
+        unsigned int blockIndex = location.m_globalGroupIndex;
 
         // if this is not a gpuTime counter, it can potentially be added.
         if (blockIndex != m_gpuTimestampGroupIndex)
         {
             // but only if there are no timestamp counters in the current pass.
-            bool passContainsGPUTimeCounter = false;
-
-            for (size_t i = 0; i < currentPassCounters.m_counters.size(); i++)
-            {
-                if (currentPassCounters.m_counters[i] == m_gpuTimestampBottomToBottomCounterIndex ||
-                    currentPassCounters.m_counters[i] == m_gpuTimestampTopToBottomCounterIndex)
-                {
-                    passContainsGPUTimeCounter = true;
-                    break;
-                }
-            }
-
-            return !passContainsGPUTimeCounter;
+            return !currentPassCounters.ContainsCounter(m_gpuTimestampBottomToBottomCounterIndex) &&
+                   !currentPassCounters.ContainsCounter(m_gpuTimestampTopToBottomCounterIndex);
         }
 
         // the counter is a GPUTimestamp counter.
@@ -43,15 +43,15 @@ public:
 
     //--------------------------------------------------------------------------
     // puts as many counters in the first pass as will fit based on the maxCountersPerGroup, will expand to additional passes as required by the hardware.
-    std::list<GPACounterPass> SplitCounters(const std::vector<const GPA_PublicCounter*>& publicCountersToSplit,
-                                            const std::vector<GPAHardwareCounterIndices> internalCountersToSchedule,
-                                            const std::vector<GPASoftwareCounterIndices>  softwareCountersToSchedule,
-                                            IGPACounterAccessor* accessor,
-                                            const std::vector<unsigned int>& maxCountersPerGroup,
-                                            unsigned int& numScheduledCounters)
+    GPACounterPassList SplitCounters(const std::vector<const GPA_PublicCounter*>& publicCountersToSplit,
+                                     const std::vector<GPAHardwareCounterIndices> internalCountersToSchedule,
+                                     const std::vector<GPASoftwareCounterIndices>  softwareCountersToSchedule,
+                                     const IGPACounterAccessor* accessor,
+                                     const std::vector<unsigned int>& maxCountersPerGroup,
+                                     unsigned int& numScheduledCounters)
     {
         // this will eventually be the return value
-        std::list<GPACounterPass> passPartitions;
+        GPACounterPassList passPartitions;
 
         // make sure there are counters to schedule
         if (publicCountersToSplit.size() == 0 && internalCountersToSchedule.size() == 0)
@@ -60,7 +60,7 @@ public:
         }
 
         // temporary variable to hold the number of counters assigned to each block during each of the passes.
-        std::list<PerPassData> numUsedCountersPerPassPerBlock;
+        std::vector<PerPassData> numUsedCountersPerPassPerBlock;
 
         // add initial pass information
         AddNewPassInfo(1, passPartitions, numUsedCountersPerPassPerBlock);
@@ -72,7 +72,9 @@ public:
         for (std::vector<const GPA_PublicCounter*>::const_iterator publicIter = publicCountersToSplit.begin(); publicIter != publicCountersToSplit.end(); ++publicIter)
         {
             // iterate through the internal counters and put them into the appropriate pass (first available pass)
-            for (std::vector<gpa_uint32>::const_iterator counterIter = (*publicIter)->m_internalCountersRequired.begin(); counterIter != (*publicIter)->m_internalCountersRequired.end(); ++counterIter)
+            const gpa_uint32* pInternalCountersEnd = (*publicIter)->m_pInternalCountersRequired + (*publicIter)->m_numInternalCountersRequired;
+
+            for (const gpa_uint32* counterIter = (*publicIter)->m_pInternalCountersRequired; counterIter != pInternalCountersEnd; ++counterIter)
             {
                 // see if the internal counter has already been scheduled
                 std::map<unsigned int, GPA_CounterResultLocation>::iterator foundCounter = internalCounterResultLocations.find(*counterIter);
@@ -88,40 +90,32 @@ public:
                     // counter has not been scheduled
                     // so need to find a pass to put it in
                     unsigned int passIndex = 0;
-                    std::list<PerPassData>::iterator countersUsedIter = numUsedCountersPerPassPerBlock.begin();
-                    std::list<GPACounterPass>::iterator counterPassIter = passPartitions.begin();
 
                     bool doneAllocatingCounter = false;
 
+                    const GPACounterGroupLocation counterLocation = accessor->GetCounterLocation(*counterIter);
+
                     while (doneAllocatingCounter == false)
                     {
                         // make sure there is a partition for current pass
                         AddNewPassInfo(passIndex + 1, passPartitions, numUsedCountersPerPassPerBlock);
 
-                        // increment the pass iterator if past the first loop
-                        if (passIndex > 0)
-                        {
-                            ++countersUsedIter;
-                            ++counterPassIter;
-                        }
-
-                        accessor->SetCounterIndex(*counterIter);
-                        unsigned int groupIndex = accessor->GroupIndex();
+                        GPACounterPass& counterPass = passPartitions[passIndex];
+                        PerPassData& countersUsed = numUsedCountersPerPassPerBlock[passIndex];
 
                         // try to add the counter to the current pass
-                        if (this->CheckForTimestampCounters(accessor, *counterIter, *counterPassIter) &&
-                            this->CanCounterBeAdded(accessor, *countersUsedIter, maxCountersPerGroup) &&
-                            this->CheckForSQCounters(accessor, *countersUsedIter, m_maxSQCounters) &&
-                            counterPassIter->m_counters.size() < 300)
+                        if (this->CheckForTimestampCounters(counterLocation, *counterIter, counterPass) &&
+                            this->CanCounterBeAdded(counterLocation, countersUsed, maxCountersPerGroup) &&
+                            this->CheckForSQCounters(counterLocation, countersUsed, m_maxSQCounters) &&
+                            counterPass.m_counters.size() < 300)
                         {
-                            counterPassIter->m_counters.push_back(*counterIter);
-                            countersUsedIter->m_numUsedCountersPerBlock[groupIndex].push_back(accessor->CounterIndex());
+                            AddCounterToPass(counterLocation, *counterIter, counterPass, countersUsed);
                             doneAllocatingCounter = true;
 
                             // record where the internal counter was scheduled
                             GPA_CounterResultLocation location;
                             location.m_pass = (gpa_uint16)passIndex;
-                            location.m_offset = (gpa_uint16)counterPassIter->m_counters.size() - 1;
+                            location.m_offset = (gpa_uint16)counterPass.m_counters.size() - 1;
                             internalCounterResultLocations[*counterIter] = location;
 
                             // record where to get the result from
@@ -154,7 +148,7 @@ private:
     /// \param numUsedCountersPerPassPerBlock A list of passes, each consisting of the number of counters scheduled on each block
     /// \param maxCountersPerGroup A vector containing the maximum number of simultaneous counters for each block
     /// \param[in,out] numScheduledCounters The total number of internal counters that were scheduled
-    void InsertHardwareCounters(std::list<GPACounterPass>& passPartitions, const std::vector<GPAHardwareCounterIndices> internalCounters, IGPACounterAccessor* accessor, std::list<PerPassData> numUsedCountersPerPassPerBlock, const std::vector<unsigned int>& maxCountersPerGroup, unsigned int& numScheduledCounters)
+    void InsertHardwareCounters(GPACounterPassList& passPartitions, const std::vector<GPAHardwareCounterIndices> internalCounters, const IGPACounterAccessor* accessor, std::vector<PerPassData> numUsedCountersPerPassPerBlock, const std::vector<unsigned int>& maxCountersPerGroup, unsigned int& numScheduledCounters)
     {
         // schedule each of the internal counters
         for (std::vector<GPAHardwareCounterIndices>::const_iterator internalCounterIter = internalCounters.begin(); internalCounterIter != internalCounters.end(); ++internalCounterIter)
@@ -163,9 +157,9 @@ private:
             bool counterAlreadyScheduled = false;
             unsigned int passIndex = 0;
 
-            for (std::list<GPACounterPass>::iterator passIter = passPartitions.begin(); passIter != passPartitions.end(); ++passIter)
+            for (GPACounterPassList::const_iterator passIter = passPartitions.begin(); passIter != passPartitions.end(); ++passIter)
             {
-                int existingOffset = VectorContains<unsigned int>(passIter->m_counters, internalCounterIter->m_hardwareIndex);
+                int existingOffset = passIter->GetCounterOffset(internalCounterIter->m_hardwareIndex);
 
                 if (existingOffset >= 0)
                 {
@@ -190,37 +184,31 @@ private:
             // make sure there is enough space for the first pass
             AddNewPassInfo(1, passPartitions, numUsedCountersPerPassPerBlock);
 
-            accessor->SetCounterIndex(internalCounterIter->m_hardwareIndex);
+            const GPACounterGroupLocation counterLocation = accessor->GetCounterLocation(internalCounterIter->m_hardwareIndex);
 
             // Iterate through the passes again and find one where the counter can be inserted.
-            passIndex = 0;
-            std::list<PerPassData>::iterator countersUsedIter = numUsedCountersPerPassPerBlock.begin();
-
-            for (std::list<GPACounterPass>::iterator passIter = passPartitions.begin(); passIter != passPartitions.end(); ++passIter)
+            for (passIndex = 0; passIndex < passPartitions.size(); ++passIndex)
             {
-                if (this->CheckForTimestampCounters(accessor, internalCounterIter->m_hardwareIndex, *passIter) == true &&
-                    this->CanCounterBeAdded(accessor, *countersUsedIter, maxCountersPerGroup) == true &&
-                    this->CheckForSQCounters(accessor, *countersUsedIter, m_maxSQCounters) == true)
+                GPACounterPass& pass = passPartitions[passIndex];
+                PerPassData& countersUsed = numUsedCountersPerPassPerBlock[passIndex];
+
+                if (this->CheckForTimestampCounters(counterLocation, internalCounterIter->m_hardwareIndex, pass) == true &&
+                    this->CanCounterBeAdded(counterLocation, countersUsed, maxCountersPerGroup) == true &&
+                    this->CheckForSQCounters(counterLocation, countersUsed, m_maxSQCounters) == true)
                 {
                     // the counter can be scheduled here.
-                    passIter->m_counters.push_back(internalCounterIter->m_hardwareIndex);
-                    countersUsedIter->m_numUsedCountersPerBlock[accessor->GroupIndex()].push_back(accessor->CounterIndex());
+                    AddCounterToPass(counterLocation, internalCounterIter->m_hardwareIndex, pass, countersUsed);
                     numScheduledCounters += 1;
 
                     // record where the result will be located
-                    unsigned int offset = (unsigned int)passIter->m_counters.size() - 1;
+                    unsigned int offset = (unsigned int)pass.m_counters.size() - 1;
                     AddCounterResultLocation(internalCounterIter->m_publicIndex, internalCounterIter->m_hardwareIndex, passIndex, offset);
                     break;
                 }
                 else
                 {
-                    ++passIndex;
-
                     // make sure there is enough space for the next pass
-                    AddNewPassInfo(passIndex + 1, passPartitions, numUsedCountersPerPassPerBlock);
-
-                    // increment the iterator after any necessary new passes have been allocated.
-                    ++countersUsedIter;
+                    AddNewPassInfo(passIndex + 2, passPartitions, numUsedCountersPerPassPerBlock);
                 }
             }
         }
@@ -40,15 +40,15 @@ public:
 
     //--------------------------------------------------------------------------
     // puts each public counter into its own pass (or set of passes) and each hardware counter into its own pass if not already scheduled
-    std::list<GPACounterPass> SplitCounters(const std::vector<const GPA_PublicCounter*>& publicCountersToSplit,
-                                            const std::vector<GPAHardwareCounterIndices> internalCountersToSchedule,
-                                            const std::vector<GPASoftwareCounterIndices>  softwareCountersToSchedule,
-                                            IGPACounterAccessor* accessor,
-                                            const std::vector<unsigned int>& maxCountersPerGroup,
-                                            unsigned int& numScheduledCounters)
+    GPACounterPassList SplitCounters(const std::vector<const GPA_PublicCounter*>& publicCountersToSplit,
+                                     const std::vector<GPAHardwareCounterIndices> internalCountersToSchedule,
+                                     const std::vector<GPASoftwareCounterIndices>  softwareCountersToSchedule,
+                                     const IGPACounterAccessor* accessor,
+                                     const std::vector<unsigned int>& maxCountersPerGroup,
+                                     unsigned int& numScheduledCounters)
     {
         // this will be the return value
-        std::list<GPACounterPass> passPartitions;
+        GPACounterPassList passPartitions;
 
         // make sure there are counters to schedule
         if (publicCountersToSplit.size() == 0 && internalCountersToSchedule.size() == 0)
@@ -57,14 +57,13 @@ public:
         }
 
         // temporary variable to hold the number of counters assigned to each block during each of the passes.
-        std::list<PerPassData> numUsedCountersPerPassPerBlock;
+        std::vector<PerPassData> numUsedCountersPerPassPerBlock;
 
         // add initial pass partition and used counters per block
         AddNewPassInfo(1, passPartitions, numUsedCountersPerPassPerBlock);
 
         unsigned int passIndex = 0;
-        std::list<PerPassData>::iterator countersUsedIter = numUsedCountersPerPassPerBlock.begin();
-        std::list<GPACounterPass>::iterator counterPassIter = passPartitions.begin();
+        unsigned int counterPassIndex = 0;
 
         // iterate through each public counter
         for (std::vector<const GPA_PublicCounter*>::const_iterator publicIter = publicCountersToSplit.begin(); publicIter != publicCountersToSplit.end(); ++publicIter)
@@ -73,15 +72,13 @@ public:
             unsigned int currentPassForThisIntCounter = passIndex;
 
             // iterate through the internal counters and put them into the appropriate pass
-            for (std::vector<gpa_uint32>::const_iterator counterIter = (*publicIter)->m_internalCountersRequired.begin(); counterIter != (*publicIter)->m_internalCountersRequired.end(); ++counterIter)
+            const gpa_uint32* pInternalCountersEnd = (*publicIter)->m_pInternalCountersRequired + (*publicIter)->m_numInternalCountersRequired;
+
+            for (const gpa_uint32* counterIter = (*publicIter)->m_pInternalCountersRequired; counterIter != pInternalCountersEnd; ++counterIter)
             {
                 // each internal counter should try to go into the first pass of this public counter
-                // reset iterators...
-                for (unsigned int i = currentPassForThisIntCounter; i > initialPassForThisPubCounter; --i)
-                {
-                    --countersUsedIter;
-                    --counterPassIter;
-                }
+                // reset the pass being filled...
+                counterPassIndex -= currentPassForThisIntCounter - initialPassForThisPubCounter;
 
                 // .. and reset current pass for this internal counter
                 currentPassForThisIntCounter = initialPassForThisPubCounter;
@@ -90,22 +87,23 @@ public:
 
                 while (doneAllocatingCounter == false)
                 {
-                    accessor->SetCounterIndex(*counterIter);
-                    unsigned int groupIndex = accessor->GroupIndex();
+                    const GPACounterGroupLocation counterLocation = accessor->GetCounterLocation(*counterIter);
+
+                    GPACounterPass& counterPass = passPartitions[counterPassIndex];
+                    PerPassData& countersUsed = numUsedCountersPerPassPerBlock[counterPassIndex];
 
                     // try to add the counter to the current pass
-                    if (this->CheckForTimestampCounters(accessor, *counterIter, *counterPassIter) &&
-                        this->CanCounterBeAdded(accessor, *countersUsedIter, maxCountersPerGroup) &&
-                        this->CheckForSQCounters(accessor, *countersUsedIter, m_maxSQCounters) &&
-                        counterPassIter->m_counters.size() < 300)
+                    if (this->CheckForTimestampCounters(counterLocation, *counterIter, counterPass) &&
+                        this->CanCounterBeAdded(counterLocation, countersUsed, maxCountersPerGroup) &&
+                        this->CheckForSQCounters(counterLocation, countersUsed, m_maxSQCounters) &&
+                        counterPass.m_counters.size() < 300)
                     {
-                        counterPassIter->m_counters.push_back(*counterIter);
-                        countersUsedIter->m_numUsedCountersPerBlock[groupIndex].push_back(accessor->CounterIndex());
+                        AddCounterToPass(counterLocation, *counterIter, counterPass, countersUsed);
                         numScheduledCounters += 1;
                         doneAllocatingCounter = true;
 
                         // record where to get the result from
-                        AddCounterResultLocation((*publicIter)->m_index, *counterIter, currentPassForThisIntCounter, (unsigned int)counterPassIter->m_counters.size() - 1);
+                        AddCounterResultLocation((*publicIter)->m_index, *counterIter, currentPassForThisIntCounter, (unsigned int)counterPass.m_counters.size() - 1);
                     }
                     else
                     {
@@ -119,8 +117,7 @@ public:
                             AddNewPassInfo(passIndex + 1, passPartitions, numUsedCountersPerPassPerBlock);
                         }
 
-                        ++countersUsedIter;
-                        ++counterPassIter;
+                        ++counterPassIndex;
                     }
                 } // end while loop to find a suitable pass for the current counter
             } // end for loop over each of the internal counters
@@ -130,14 +127,10 @@ public:
                 // next counter will be in another pass
                 ++passIndex;
 
-                GPACounterPass counterPass;
-                passPartitions.push_back(counterPass);
-
-                PerPassData newPass;
-                numUsedCountersPerPassPerBlock.push_back(newPass);
+                passPartitions.push_back(GPACounterPass());
+                numUsedCountersPerPassPerBlock.push_back(PerPassData());
 
-                ++countersUsedIter;
-                ++counterPassIter;
+                ++counterPassIndex;
             }
         }
 
@@ -154,7 +147,7 @@ private:
     /// \param pAccessor A interface that accesses the internal counters
     /// \param numUsedCountersPerPassPerBlock A list of passes, each consisting of the number of counters scheduled on each block
     /// \param[in,out] numScheduledCounters The total number of internal counters that were scheduled
-    void InsertInternalCounters(std::list<GPACounterPass>& passPartitions, const std::vector<GPAHardwareCounterIndices> internalCounters, IGPACounterAccessor* pAccessor, std::list<PerPassData> numUsedCountersPerPassPerBlock, unsigned int& numScheduledCounters)
+    void InsertInternalCounters(GPACounterPassList& passPartitions, const std::vector<GPAHardwareCounterIndices> internalCounters, const IGPACounterAccessor* pAccessor, std::vector<PerPassData> numUsedCountersPerPassPerBlock, unsigned int& numScheduledCounters)
     {
         if (internalCounters.size() == 0)
         {
@@ -168,13 +161,10 @@ private:
         // make sure there is room for the first pass
         AddNewPassInfo(1, passPartitions, numUsedCountersPerPassPerBlock);
 
-        std::list<GPACounterPass>::iterator currentPassIter = passPartitions.end();
-        std::list<PerPassData>::iterator currentUsedCountersIter = numUsedCountersPerPassPerBlock.end();
         unsigned int passIndex = (unsigned int)passPartitions.size();
 
-        // back up the iterators so that they point to the last pass.
-        --currentPassIter;
-        --currentUsedCountersIter;
+        // start with the last pass.
+        unsigned int currentPassIndex = passIndex - 1;
 
         // schedule each of the internal counters in its own pass, unless it is already scheduled from one of the public counters
         for (std::vector<GPAHardwareCounterIndices>::const_iterator internalCounterIter = internalCounters.begin(); internalCounterIter != internalCounters.end(); ++internalCounterIter)
@@ -183,9 +173,9 @@ private:
             bool counterAlreadyScheduled = false;
             gpa_uint16 searchPassIndex = 0;
 
-            for (std::list<GPACounterPass>::iterator tmpPassIter = passPartitions.begin(); tmpPassIter != passPartitions.end(); ++tmpPassIter)
+            for (GPACounterPassList::const_iterator tmpPassIter = passPartitions.begin(); tmpPassIter != passPartitions.end(); ++tmpPassIter)
             {
-                int existingOffset = VectorContains<unsigned int>(tmpPassIter->m_counters, internalCounterIter->m_hardwareIndex);
+                int existingOffset = tmpPassIter->GetCounterOffset(internalCounterIter->m_hardwareIndex);
 
                 if (existingOffset >= 0)
                 {
@@ -213,8 +203,7 @@ private:
                 // make sure there is enough space for the next pass
                 ++passIndex;
                 AddNewPassInfo(passIndex, passPartitions, numUsedCountersPerPassPerBlock);
-                ++currentPassIter;
-                ++currentUsedCountersIter;
+                ++currentPassIndex;
             }
             else
             {
@@ -224,13 +213,12 @@ private:
             }
 
             // the counter can be scheduled here.
-            currentPassIter->m_counters.push_back(internalCounterIter->m_hardwareIndex);
-
-            currentUsedCountersIter->m_numUsedCountersPerBlock[pAccessor->GroupIndex()].push_back(pAccessor->CounterIndex());
+            const GPACounterGroupLocation counterLocation = pAccessor->GetCounterLocation(internalCounterIter->m_hardwareIndex);
+            AddCounterToPass(counterLocation, internalCounterIter->m_hardwareIndex, passPartitions[currentPassIndex], numUsedCountersPerPassPerBlock[currentPassIndex]);
             numScheduledCounters += 1;
 
             // record where the result will be located
-            unsigned int offset = (unsigned int)currentPassIter->m_counters.size() - 1;
+            unsigned int offset = (unsigned int)passPartitions[currentPassIndex].m_counters.size() - 1;
             AddCounterResultLocation(internalCounterIter->m_publicIndex, internalCounterIter->m_hardwareIndex, passIndex, offset);
         }
     }
@@ -0,0 +1,611 @@
+//==============================================================================
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  This file implements the "optimal" counter splitter
+//==============================================================================
+
+
+#ifndef _GPA_SPLITCOUNTERSOPTIMAL_H_
+#define _GPA_SPLITCOUNTERSOPTIMAL_H_
+
+#include <vector>
+#include <chrono>
+#include <climits>
+#include <cassert>
+#include "GPASplitCountersConsolidated.h"
+
+/// The time after which the optimal splitter stops searching for fewer passes and keeps the best split found so far, in milliseconds
+static const unsigned int GPA_OPTIMAL_SPLIT_TIME_BUDGET_MS = 100;
+
+/// The number of placements after which the optimal splitter stops searching for fewer passes.
+/// This keeps the split independent of the speed of the machine for all but the largest counter selections.
+static const unsigned int GPA_OPTIMAL_SPLIT_NODE_BUDGET = 200000;
+
+/// Splits counters into as few passes as possible.
+/// Each public counter is first split on its own, exactly as the consolidated splitter does, and each of the resulting passes becomes a chunk of
+/// counters which must be scheduled in the same pass. A first-fit packing of the chunks gives a first solution, then a branch and bound search
+/// looks for a packing with fewer passes until it reaches a lower bound on the number of passes or runs out of budget. Unlike the consolidated splitter, there is no limit on the number of counters in a pass other than the limits of each block.
+/// If the search finds no packing with fewer passes than the consolidated splitter, the consolidated split is used, so the result never needs more passes.
+class GPASplitCountersOptimal : public GPASplitCountersConsolidated
+{
+public:
+    /// Initialize an instance of the GPASplitCountersOptimal class.
+    /// \param gpuTimestampGroupIndex The index of the GPUTimestamp group
+    /// \param gpuTimestampBottomToBottomCounterIndex The global counter index of the bottom-bottom counter
+    /// \param gpuTimestampTopToBottomCounterIndex The global counter index of the top-bottom counter
+    /// \param maxSQCounters The maximum number of counters that can be simultaneously enabled on the SQ block
+    /// \param numSQGroups The number of SQ counter groups.
+    /// \param pSQCounterBlockInfo The list of SQ counter groups.
+    GPASplitCountersOptimal(unsigned int gpuTimestampGroupIndex,
+                            unsigned int gpuTimestampBottomToBottomCounterIndex,
+                            unsigned int gpuTimestampTopToBottomCounterIndex,
+                            unsigned int maxSQCounters,
+                            unsigned int numSQGroups,
+                            GPA_SQCounterGroupDesc* pSQCounterBlockInfo)
+        :   GPASplitCountersConsolidated(gpuTimestampGroupIndex, gpuTimestampBottomToBottomCounterIndex,
+                                         gpuTimestampTopToBottomCounterIndex, maxSQCounters,
+                                         numSQGroups, pSQCounterBlockInfo),
+            m_pAccessor(nullptr),
+            m_pMaxCountersPerGroup(nullptr),
+            m_lowerBound(0),
+            m_bestPassCount(UINT_MAX),
+            m_numSearchedNodes(0),
+            m_searchStopped(false)
+    {
+    };
+
+    /// Destructor
+    virtual ~GPASplitCountersOptimal() {};
+
+    //--------------------------------------------------------------------------
+    // public counters that can fit in a single pass will be enabled in the same pass,
+    // single-pass counters should not be split into multiple passes,
+    // multi-pass counters should not take more passes than required,
+    // the total number of passes is as small as the search budget allows, and never more than with the consolidated splitter.
+    GPACounterPassList SplitCounters(const std::vector<const GPA_PublicCounter*>& publicCountersToSplit,
+                                     const std::vector<GPAHardwareCounterIndices> internalCountersToSchedule,
+                                     const std::vector<GPASoftwareCounterIndices> softwareCountersToSchedule,
+                                     const IGPACounterAccessor* accessor,
+                                     const std::vector<unsigned int>& maxCountersPerGroup,
+                                     unsigned int& numScheduledCounters)
+    {
+        // the consolidated split is kept aside in case the search does not find fewer passes before it runs out of budget
+        unsigned int numConsolidatedScheduledCounters = 0;
+        GPACounterPassList consolidatedPasses = GPASplitCountersConsolidated::SplitCounters(publicCountersToSplit, internalCountersToSchedule, softwareCountersToSchedule,
+                                                                                            accessor, maxCountersPerGroup, numConsolidatedScheduledCounters);
+
+        std::map< unsigned int, std::map<unsigned int, GPA_CounterResultLocation> > consolidatedResultLocations;
+        SwapCounterResultLocations(consolidatedResultLocations);
+
+        m_pAccessor = accessor;
+        m_pMaxCountersPerGroup = &maxCountersPerGroup;
+
+        BuildChunks(publicCountersToSplit, internalCountersToSchedule);
+
+        m_lowerBound = GetLowerBoundPassCount();
+        m_bestPassCount = UINT_MAX;
+        m_numSearchedNodes = 0;
+        m_searchStopped = false;
+        m_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(GPA_OPTIMAL_SPLIT_TIME_BUDGET_MS);
+
+        // a first-fit placement in the order the counters were enabled gives a first solution,
+        // it is often as good as the one the consolidated splitter finds
+        m_order.resize(m_chunks.size());
+
+        for (unsigned int i = 0; i < m_order.size(); i++)
+        {
+            m_order[i] = i;
+        }
+
+        PlaceFirstFit();
+
+        // then search with the largest chunks first, they are the hardest to fit once the passes fill up, so the search starts with the first-fit decreasing placement
+        std::stable_sort(m_order.begin(), m_order.end(), [this](unsigned int left, unsigned int right)
+        {
+            return m_chunks[left].m_counters.size() > m_chunks[right].m_counters.size();
+        });
+
+        m_assignment.resize(m_order.size());
+        m_passes.clear();
+
+        if (m_bestPassCount > m_lowerBound)
+        {
+            SearchPasses();
+        }
+
+        // replay the best placement to build the passes, the counters end up at the same offsets as during the search
+        std::vector<SearchPass> bestPasses(m_bestPassCount);
+
+        for (unsigned int orderIndex = 0; orderIndex < m_bestOrder.size(); orderIndex++)
+        {
+            unsigned int numAdded = 0;
+            bool added = AddChunkToPass(m_chunks[m_bestOrder[orderIndex]], bestPasses[m_bestAssignment[orderIndex]], numAdded);
+            assert(added);
+            (void)added;
+        }
+
+        for (unsigned int orderIndex = 0; orderIndex < m_bestOrder.size(); orderIndex++)
+        {
+            const CounterChunk& chunk = m_chunks[m_bestOrder[orderIndex]];
+            unsigned int passIndex = m_bestAssignment[orderIndex];
+
+            for (auto counterIter = chunk.m_counters.cbegin(); counterIter != chunk.m_counters.cend(); ++counterIter)
+            {
+                int offset = bestPasses[passIndex].m_pass.GetCounterOffset(*counterIter);
+                assert(-1 != offset);
+
+                AddCounterResultLocation(chunk.m_publicIndex, *counterIter, passIndex, (unsigned int)offset);
+            }
+        }
+
+        // this will eventually be the return value
+        GPACounterPassList passPartitions;
+
+        // temporary variable to hold the number of counters assigned to each block during each of the passes.
+        std::vector<PerPassData> numUsedCountersPerPassPerBlock;
+
+        unsigned int numSearchedScheduledCounters = 0;
+
+        for (auto passIter = bestPasses.begin(); passIter != bestPasses.end(); ++passIter)
+        {
+            numSearchedScheduledCounters += (unsigned int)passIter->m_pass.m_counters.size();
+            passPartitions.push_back(passIter->m_pass);
+            numUsedCountersPerPassPerBlock.push_back(passIter->m_usedCounters);
+        }
+
+        // Handle the software counters
+        InsertSoftwareCounters(passPartitions, softwareCountersToSchedule, accessor, numUsedCountersPerPassPerBlock, maxCountersPerGroup, numSearchedScheduledCounters);
+
+        if (passPartitions.size() >= consolidatedPasses.size())
+        {
+            SwapCounterResultLocations(consolidatedResultLocations);
+            numScheduledCounters += numConsolidatedScheduledCounters;
+            return consolidatedPasses;
+        }
+
+        numScheduledCounters += numSearchedScheduledCounters;
+        return passPartitions;
+    };
+
+    //--------------------------------------------------------------------------
+    // the fewest passes can only be found by searching the placements of all of the enabled counters,
+    // so the counters are always split again.
+    bool UpdatePasses(GPACounterPassList& passPartitions,
+                      const std::vector<unsigned int>& countersToRemove,
+                      const std::vector<const GPA_PublicCounter*>& publicCountersToAdd,
+                      const std::vector<GPAHardwareCounterIndices>& hardwareCountersToAdd,
+                      const IGPACounterAccessor* pAccessor,
+                      const std::vector<unsigned int>& maxCountersPerGroup)
+    {
+        UNREFERENCED_PARAMETER(passPartitions);
+        UNREFERENCED_PARAMETER(countersToRemove);
+        UNREFERENCED_PARAMETER(publicCountersToAdd);
+        UNREFERENCED_PARAMETER(hardwareCountersToAdd);
+        UNREFERENCED_PARAMETER(pAccessor);
+        UNREFERENCED_PARAMETER(maxCountersPerGroup);
+        return false;
+    }
+
+private:
+
+    /// A set of internal counters which must be scheduled in the same pass
+    struct CounterChunk
+    {
+        unsigned int m_publicIndex;           ///< the index of the public or hardware counter whose results come from these counters
+        std::vector<unsigned int> m_counters; ///< the internal counters
+        GPACounterBitSet m_counterBits;       ///< the same counters as m_counters, used to check if a pass already contains them all
+    };
+
+    /// A pass that is being filled by the search
+    struct SearchPass
+    {
+        GPACounterPass m_pass;      ///< the counters in the pass
+        PerPassData m_usedCounters; ///< the counters used from each block in the pass
+    };
+
+    /// The search state of a chunk being placed
+    struct SearchFrame
+    {
+        unsigned int m_numPasses;  ///< the number of passes before the chunk was placed, a chunk placed in this pass opened it
+        unsigned int m_nextPass;   ///< the next pass to try the chunk in
+        unsigned int m_placedPass; ///< the pass the chunk is placed in, UINT_MAX if it is not placed
+        unsigned int m_numAdded;   ///< the number of counters added to m_placedPass for the chunk
+        bool m_isContained;        ///< true if m_nextPass already contains all the counters of the chunk, so it is the only pass to try
+    };
+
+    /// Builds the chunks of counters to place: one for each pass of each public counter when it is split on its own, and one for each hardware counter.
+    /// \param publicCountersToSplit The public counters to schedule
+    /// \param internalCountersToSchedule The hardware counters to schedule
+    void BuildChunks(const std::vector<const GPA_PublicCounter*>& publicCountersToSplit,
+                     const std::vector<GPAHardwareCounterIndices>& internalCountersToSchedule)
+    {
+        m_chunks.clear();
+
+        for (auto publicIter = publicCountersToSplit.cbegin(); publicIter != publicCountersToSplit.cend(); ++publicIter)
+        {
+            const GPACounterPassList singleCounterPasses = SplitSingleCounter(*publicIter, m_pAccessor, *m_pMaxCountersPerGroup);
+
+            for (auto singleCounterPassIter = singleCounterPasses.cbegin(); singleCounterPassIter != singleCounterPasses.cend(); ++singleCounterPassIter)
+            {
+                if (!singleCounterPassIter->m_counters.empty())
+                {
+                    CounterChunk chunk;
+                    chunk.m_publicIndex = (*publicIter)->m_index;
+                    chunk.m_counters = singleCounterPassIter->m_counters;
+                    chunk.m_counterBits = singleCounterPassIter->m_counterBits;
+                    m_chunks.push_back(chunk);
+                }
+            }
+        }
+
+        for (auto internalCounterIter = internalCountersToSchedule.cbegin(); internalCounterIter != internalCountersToSchedule.cend(); ++internalCounterIter)
+        {
+            CounterChunk chunk;
+            chunk.m_publicIndex = internalCounterIter->m_publicIndex;
+            chunk.m_counters.push_back(internalCounterIter->m_hardwareIndex);
+            chunk.m_counterBits.Set(internalCounterIter->m_hardwareIndex);
+
+            // a counter which does not fit in an empty pass can not be scheduled at all
+            SearchPass emptyPass;
+            unsigned int numAdded = 0;
+
+            if (AddChunkToPass(chunk, emptyPass, numAdded))
+            {
+                m_chunks.push_back(chunk);
+            }
+            else
+            {
+                assert(!"Hardware counter can not be scheduled in any pass.");
+            }
+        }
+    }
+
+    /// Computes a number of passes which no split of the chunks can go below.
+    /// Each block needs enough passes for all of its distinct counters, each SQ shader stage needs its own passes,
+    /// and the GPUTime counters need a pass of their own.
+    /// \return the lower bound on the number of passes
+    unsigned int GetLowerBoundPassCount()
+    {
+        std::map<unsigned int, std::vector<unsigned int> > countersPerGroup;
+        std::map<int, std::vector<unsigned int> > countersPerSQStage;
+        GPACounterBitSet countedCounters;
+        bool hasGPUTimeCounter = false;
+
+        for (auto chunkIter = m_chunks.cbegin(); chunkIter != m_chunks.cend(); ++chunkIter)
+        {
+            for (auto counterIter = chunkIter->m_counters.cbegin(); counterIter != chunkIter->m_counters.cend(); ++counterIter)
+            {
+                if (countedCounters.Test(*counterIter))
+                {
+                    continue;
+                }
+
+                countedCounters.Set(*counterIter);
+
+                if (*counterIter == m_gpuTimestampBottomToBottomCounterIndex || *counterIter == m_gpuTimestampTopToBottomCounterIndex)
+                {
+                    hasGPUTimeCounter = true;
+                    continue;
+                }
+
+                const GPACounterGroupLocation counterLocation = m_pAccessor->GetCounterLocation(*counterIter);
+                unsigned int groupIndex = counterLocation.m_globalGroupIndex;
+                countersPerGroup[groupIndex].push_back(counterLocation.m_counterIndex);
+
+                int sqStage = GetSQStage(groupIndex);
+
+                if (sqStage >= 0)
+                {
+                    // the same counter on different shader engines only counts once against the SQ limit
+                    std::vector<unsigned int>& stageCounters = countersPerSQStage[sqStage];
+
+                    if (std::find(stageCounters.begin(), stageCounters.end(), counterLocation.m_counterIndex) == stageCounters.end())
+                    {
+                        stageCounters.push_back(counterLocation.m_counterIndex);
+                    }
+                }
+            }
+        }
+
+        unsigned int lowerBound = 0;
+
+        for (auto groupIter = countersPerGroup.cbegin(); groupIter != countersPerGroup.cend(); ++groupIter)
+        {
+            unsigned int groupLimit = (*m_pMaxCountersPerGroup)[groupIter->first];
+
+            if (groupLimit > 0)
+            {
+                unsigned int groupPasses = ((unsigned int)groupIter->second.size() + groupLimit - 1) / groupLimit;
+                lowerBound = std::max<unsigned int>(lowerBound, groupPasses);
+            }
+        }
+
+        if (m_maxSQCounters > 0)
+        {
+            unsigned int sqPasses = 0;
+
+            for (auto stageIter = countersPerSQStage.cbegin(); stageIter != countersPerSQStage.cend(); ++stageIter)
+            {
+                sqPasses += ((unsigned int)stageIter->second.size() + m_maxSQCounters - 1) / m_maxSQCounters;
+            }
+
+            lowerBound = std::max<unsigned int>(lowerBound, sqPasses);
+        }
+
+        if (hasGPUTimeCounter)
+        {
+            lowerBound++;
+        }
+
+        return lowerBound;
+    }
+
+    /// Tries to add the counters of a chunk to a pass. If any of them can not be added, the pass is left unchanged.
+    /// \param chunk the chunk to add
+    /// \param[in,out] pass the pass to add the chunk to
+    /// \param[out] numAdded the number of counters which were added, excluding the ones already in the pass
+    /// \return true if all the counters of the chunk are now in the pass
+    bool AddChunkToPass(const CounterChunk& chunk, SearchPass& pass, unsigned int& numAdded)
+    {
+        numAdded = 0;
+
+        for (auto counterIter = chunk.m_counters.cbegin(); counterIter != chunk.m_counters.cend(); ++counterIter)
+        {
+            // if the counter is already there, no need to add it
+            if (pass.m_pass.ContainsCounter(*counterIter))
+            {
+                continue;
+            }
+
+            const GPACounterGroupLocation counterLocation = m_pAccessor->GetCounterLocation(*counterIter);
+
+            if (this->CheckForTimestampCounters(counterLocation, *counterIter, pass.m_pass) == false ||
+                this->CanCounterBeAdded(counterLocation, pass.m_usedCounters, *m_pMaxCountersPerGroup) == false ||
+                this->CheckForSQCounters(counterLocation, pass.m_usedCounters, m_maxSQCounters) == false)
+            {
+                RemoveCountersFromPass(pass, numAdded);
+                numAdded = 0;
+                return false;
+            }
+
+            AddCounterToPass(counterLocation, *counterIter, pass.m_pass, pass.m_usedCounters);
+            numAdded++;
+        }
+
+        return true;
+    }
+
+    /// Removes the most recently added counters from a pass.
+    /// \param[in,out] pass the pass to remove the counters from
+    /// \param numCounters the number of counters to remove
+    void RemoveCountersFromPass(SearchPass& pass, unsigned int numCounters)
+    {
+        for (unsigned int i = 0; i < numCounters; i++)
+        {
+            const GPACounterGroupLocation counterLocation = m_pAccessor->GetCounterLocation(pass.m_pass.m_counters.back());
+            RemoveCounterFromPassData(counterLocation, pass.m_usedCounters);
+            pass.m_pass.RemoveLastCounter();
+        }
+    }
+
+    /// Checks if all the counters of a chunk are already in a pass
+    /// \param chunk the chunk to check
+    /// \param pass the pass to check
+    /// \return true if the pass contains all the counters of the chunk
+    bool PassContainsChunk(const CounterChunk& chunk, const SearchPass& pass) const
+    {
+        return chunk.m_counterBits.IsSubsetOf(pass.m_pass.m_counterBits);
+    }
+
+    /// Places each chunk in m_order in the first pass it fits in, and keeps the placement if it has fewer passes than the best placement so far.
+    void PlaceFirstFit()
+    {
+        m_passes.clear();
+        m_assignment.resize(m_order.size());
+
+        for (unsigned int orderIndex = 0; orderIndex < m_order.size(); orderIndex++)
+        {
+            const CounterChunk& chunk = m_chunks[m_order[orderIndex]];
+            unsigned int passIndex = 0;
+            unsigned int numAdded = 0;
+
+            while (passIndex < m_passes.size() && !AddChunkToPass(chunk, m_passes[passIndex], numAdded))
+            {
+                passIndex++;
+            }
+
+            if (passIndex == m_passes.size())
+            {
+                m_passes.push_back(SearchPass());
+                AddChunkToPass(chunk, m_passes.back(), numAdded);
+            }
+
+            m_assignment[orderIndex] = passIndex;
+        }
+
+        if (m_passes.size() < m_bestPassCount)
+        {
+            m_bestPassCount = (unsigned int)m_passes.size();
+            m_bestOrder = m_order;
+            m_bestAssignment = m_assignment;
+        }
+    }
+
+    /// Starts placing the chunk at the specified position in m_order: counts the placement against the search budget,
+    /// and looks for a pass which already contains all of its counters.
+    /// \param orderIndex the position in m_order of the chunk to place
+    /// \param[out] frame the search state of the chunk
+    void BeginSearchFrame(unsigned int orderIndex, SearchFrame& frame)
+    {
+        frame.m_numPasses = (unsigned int)m_passes.size();
+        frame.m_nextPass = 0;
+        frame.m_placedPass = UINT_MAX;
+        frame.m_numAdded = 0;
+        frame.m_isContained = false;
+
+        m_numSearchedNodes++;
+
+        if (m_numSearchedNodes >= GPA_OPTIMAL_SPLIT_NODE_BUDGET ||
+            (0 == (m_numSearchedNodes & 0xFF) && std::chrono::steady_clock::now() > m_deadline))
+        {
+            // only stop once there is a solution to return
+            m_searchStopped = m_bestPassCount != UINT_MAX;
+        }
+
+        const CounterChunk& chunk = m_chunks[m_order[orderIndex]];
+
+        // a chunk whose counters are all in a pass already costs nothing there, so there is no better place for it
+        for (unsigned int passIndex = 0; passIndex < frame.m_numPasses; passIndex++)
+        {
+            if (PassContainsChunk(chunk, m_passes[passIndex]))
+            {
+                frame.m_nextPass = passIndex;
+                frame.m_isContained = true;
+                break;
+            }
+        }
+    }
+
+    /// Removes the chunk of a search frame from the pass it was placed in, and removes the pass if it was opened for the chunk.
+    /// \param[in,out] frame the search state of the chunk
+    void RemoveSearchFramePlacement(SearchFrame& frame)
+    {
+        if (UINT_MAX == frame.m_placedPass)
+        {
+            return;
+        }
+
+        if (frame.m_placedPass == frame.m_numPasses)
+        {
+            m_passes.pop_back();
+        }
+        else
+        {
+            RemoveCountersFromPass(m_passes[frame.m_placedPass], frame.m_numAdded);
+        }
+
+        frame.m_placedPass = UINT_MAX;
+        frame.m_numAdded = 0;
+    }
+
+    /// Places the chunk of a search frame in the next pass it fits in: one of the existing passes, then a new pass.
+    /// \param orderIndex the position in m_order of the chunk to place
+    /// \param[in,out] frame the search state of the chunk
+    /// \return true if the chunk was placed, false if there is no other pass to try
+    bool PlaceSearchFrameChunk(unsigned int orderIndex, SearchFrame& frame)
+    {
+        if (m_searchStopped)
+        {
+            return false;
+        }
+
+        const CounterChunk& chunk = m_chunks[m_order[orderIndex]];
+
+        if (frame.m_isContained)
+        {
+            if (frame.m_nextPass == frame.m_numPasses)
+            {
+                return false;
+            }
+
+            frame.m_placedPass = frame.m_nextPass;
+            frame.m_nextPass = frame.m_numPasses;
+            return true;
+        }
+
+        while (frame.m_nextPass < frame.m_numPasses)
+        {
+            unsigned int passIndex = frame.m_nextPass++;
+
+            if (AddChunkToPass(chunk, m_passes[passIndex], frame.m_numAdded))
+            {
+                frame.m_placedPass = passIndex;
+                return true;
+            }
+        }
+
+        // only open a new pass if that can still lead to fewer passes than the best placement so far
+        if (frame.m_nextPass == frame.m_numPasses)
+        {
+            frame.m_nextPass++;
+
+            if (m_passes.size() + 1 < m_bestPassCount)
+            {
+                m_passes.push_back(SearchPass());
+
+                if (AddChunkToPass(chunk, m_passes.back(), frame.m_numAdded))
+                {
+                    frame.m_placedPass = frame.m_numPasses;
+                    return true;
+                }
+
+                m_passes.pop_back();
+            }
+        }
+
+        return false;
+    }
+
+    /// Places the chunks in m_order in every pass they fit in, keeping the placement with the fewest passes.
+    /// The search is depth first, with an explicit stack holding one frame for each chunk being placed.
+    void SearchPasses()
+    {
+        if (m_order.empty())
+        {
+            return;
+        }
+
+        std::vector<SearchFrame> frames(m_order.size());
+        unsigned int orderIndex = 0;
+        BeginSearchFrame(orderIndex, frames[orderIndex]);
+
+        for (;;)
+        {
+            SearchFrame& frame = frames[orderIndex];
+            RemoveSearchFramePlacement(frame);
+
+            if (PlaceSearchFrameChunk(orderIndex, frame))
+            {
+                m_assignment[orderIndex] = frame.m_placedPass;
+
+                if (orderIndex + 1 < m_order.size())
+                {
+                    orderIndex++;
+                    BeginSearchFrame(orderIndex, frames[orderIndex]);
+                }
+                else if (m_passes.size() < m_bestPassCount)
+                {
+                    m_bestPassCount = (unsigned int)m_passes.size();
+                    m_bestOrder = m_order;
+                    m_bestAssignment = m_assignment;
+                    m_searchStopped = m_bestPassCount <= m_lowerBound;
+                }
+            }
+            else if (0 == orderIndex)
+            {
+                break;
+            }
+            else
+            {
+                orderIndex--;
+            }
+        }
+    }
+
+    const IGPACounterAccessor* m_pAccessor;                    ///< the accessor of the counters being split
+    const std::vector<unsigned int>* m_pMaxCountersPerGroup;   ///< the maximum number of counters in a pass for each group
+    std::vector<CounterChunk> m_chunks;                        ///< the chunks of counters to place
+    std::vector<unsigned int> m_order;                         ///< the indices of the chunks in m_chunks, in the order they are placed
+    std::vector<SearchPass> m_passes;                          ///< the passes of the placement being searched
+    std::vector<unsigned int> m_assignment;                    ///< the pass of each chunk in m_order for the placement being searched
+    std::vector<unsigned int> m_bestOrder;                     ///< the order of the chunks for the best placement found
+    std::vector<unsigned int> m_bestAssignment;                ///< the pass of each chunk in m_bestOrder for the best placement found
+    unsigned int m_lowerBound;                                 ///< no placement has fewer passes than this
+    unsigned int m_bestPassCount;                              ///< the number of passes of the best placement found
+    unsigned int m_numSearchedNodes;                           ///< the number of chunk placements tried so far
+    bool m_searchStopped;                                      ///< true once the search has found an optimal placement or run out of budget
+    std::chrono::steady_clock::time_point m_deadline;          ///< the time at which the search stops
+};
+
+#endif // _GPA_SPLITCOUNTERSOPTIMAL_H_
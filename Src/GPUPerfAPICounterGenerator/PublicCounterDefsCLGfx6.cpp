@@ -9,199 +9,54 @@
 
 // *** Note, this is an auto-generated file. Do not edit. Execute PublicCounterCompiler to rebuild.
 
-void AutoDefinePublicCountersCLGfx6(GPA_PublicCounters& p)
+/// Internal counters required by the public counters for CLGFX6, referenced by offset from the counter definitions
+static constexpr gpa_uint32 s_internalCountersCLGfx6[] =
 {
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1639);
-
-        p.DefinePublicCounter("Wavefronts", "#General#Total wavefronts.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1649);
-        internalCounters.push_back(1639);
-
-        p.DefinePublicCounter("VALUInsts", "#General#The average number of vector ALU instructions executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,/");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1653);
-        internalCounters.push_back(1639);
-
-        p.DefinePublicCounter("SALUInsts", "#General#The average number of scalar ALU instructions executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,/");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1651);
-        internalCounters.push_back(1639);
-
-        p.DefinePublicCounter("VFetchInsts", "#General#The average number of vector fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,/");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1654);
-        internalCounters.push_back(1639);
-
-        p.DefinePublicCounter("SFetchInsts", "#General#The average number of scalar fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,/");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1650);
-        internalCounters.push_back(1639);
-
-        p.DefinePublicCounter("VWriteInsts", "#General#The average number of vector write instructions to the video memory executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,/");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1655);
-        internalCounters.push_back(1639);
-
-        p.DefinePublicCounter("LDSInsts", "#LocalMemory#The average number of LDS read or LDS write instructions executed per work item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,/");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1656);
-        internalCounters.push_back(1639);
-
-        p.DefinePublicCounter("GDSInsts", "#General#The average number of GDS read or GDS write instructions executed per work item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,/");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1693);
-        internalCounters.push_back(1685);
-
-        p.DefinePublicCounter("VALUUtilization", "#General#The percentage of active vector ALU threads in a wave. A lower number can mean either more thread divergence in a wave or that the work-group size is not a multiple of 64. Value range: 0% (bad), 100% (ideal - no thread divergence).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,(64),*,/,(100),*,(100),min");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1685);
-        internalCounters.push_back(976);
-
-        p.DefinePublicCounter("VALUBusy", "#General#The percentage of GPUTime vector ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,(4),*,NUM_SIMDS,/,1,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1690);
-        internalCounters.push_back(976);
-
-        p.DefinePublicCounter("SALUBusy", "#General#The percentage of GPUTime scalar ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,(4),*,NUM_SIMDS,NUM_SHADER_ENGINES,/,/,1,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5801);
-        internalCounters.push_back(5929);
-        internalCounters.push_back(6057);
-        internalCounters.push_back(6185);
-        internalCounters.push_back(6313);
-        internalCounters.push_back(6441);
-        internalCounters.push_back(6569);
-        internalCounters.push_back(6697);
-        internalCounters.push_back(6825);
-        internalCounters.push_back(6953);
-        internalCounters.push_back(7081);
-        internalCounters.push_back(7209);
-
-        p.DefinePublicCounter("FetchSize", "#GlobalMemory#The total kilobytes fetched from the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,sum12,(32),*,(1024),/");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5795);
-        internalCounters.push_back(5923);
-        internalCounters.push_back(6051);
-        internalCounters.push_back(6179);
-        internalCounters.push_back(6307);
-        internalCounters.push_back(6435);
-        internalCounters.push_back(6563);
-        internalCounters.push_back(6691);
-        internalCounters.push_back(6819);
-        internalCounters.push_back(6947);
-        internalCounters.push_back(7075);
-        internalCounters.push_back(7203);
-
-        p.DefinePublicCounter("WriteSize", "#GlobalMemory#The total kilobytes written to the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,sum12,(32),*,(1024),/");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5787);
-        internalCounters.push_back(5915);
-        internalCounters.push_back(6043);
-        internalCounters.push_back(6171);
-        internalCounters.push_back(6299);
-        internalCounters.push_back(6427);
-        internalCounters.push_back(6555);
-        internalCounters.push_back(6683);
-        internalCounters.push_back(6811);
-        internalCounters.push_back(6939);
-        internalCounters.push_back(7067);
-        internalCounters.push_back(7195);
-        internalCounters.push_back(5788);
-        internalCounters.push_back(5916);
-        internalCounters.push_back(6044);
-        internalCounters.push_back(6172);
-        internalCounters.push_back(6300);
-        internalCounters.push_back(6428);
-        internalCounters.push_back(6556);
-        internalCounters.push_back(6684);
-        internalCounters.push_back(6812);
-        internalCounters.push_back(6940);
-        internalCounters.push_back(7068);
-        internalCounters.push_back(7196);
-
-        p.DefinePublicCounter("CacheHit", "#GlobalMemory#The percentage of fetch, write, atomic, and other instructions that hit the data cache. Value range: 0% (no hit) to 100% (optimal).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,sum12,0,1,2,3,4,5,6,7,8,9,10,11,sum12,12,13,14,15,16,17,18,19,20,21,22,23,sum12,+,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4859);
-        internalCounters.push_back(4965);
-        internalCounters.push_back(5071);
-        internalCounters.push_back(5177);
-        internalCounters.push_back(5283);
-        internalCounters.push_back(5389);
-        internalCounters.push_back(5495);
-        internalCounters.push_back(5601);
-        internalCounters.push_back(976);
-
-        p.DefinePublicCounter("MemUnitBusy", "#GlobalMemory#The percentage of GPUTime the memory unit is active. The result includes the stall time (MemUnitStalled). This is measured with all extra fetches and writes and any cache or memory effects taken into account. Value range: 0% to 100% (fetch-bound).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,/,NUM_SHADER_ENGINES,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(7708);
-        internalCounters.push_back(7818);
-        internalCounters.push_back(7928);
-        internalCounters.push_back(8038);
-        internalCounters.push_back(8148);
-        internalCounters.push_back(8258);
-        internalCounters.push_back(8368);
-        internalCounters.push_back(8478);
-        internalCounters.push_back(976);
-
-        p.DefinePublicCounter("MemUnitStalled", "#GlobalMemory#The percentage of GPUTime the memory unit is stalled. Try reducing the number or size of fetches and writes if possible. Value range: 0% (optimal) to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,/,NUM_SHADER_ENGINES,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5796);
-        internalCounters.push_back(5924);
-        internalCounters.push_back(6052);
-        internalCounters.push_back(6180);
-        internalCounters.push_back(6308);
-        internalCounters.push_back(6436);
-        internalCounters.push_back(6564);
-        internalCounters.push_back(6692);
-        internalCounters.push_back(6820);
-        internalCounters.push_back(6948);
-        internalCounters.push_back(7076);
-        internalCounters.push_back(7204);
-        internalCounters.push_back(976);
-
-        p.DefinePublicCounter("WriteUnitStalled", "#GlobalMemory#The percentage of GPUTime the Write unit is stalled. Value range: 0% to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,max,2,max,3,max,4,max,5,max,7,max,8,max,9,max,10,max,11,max,12,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1697);
-        internalCounters.push_back(976);
+    1639,
+    1649, 1639,
+    1653, 1639,
+    1651, 1639,
+    1654, 1639,
+    1650, 1639,
+    1655, 1639,
+    1656, 1639,
+    1693, 1685,
+    1685, 976,
+    1690, 976,
+    5801, 5929, 6057, 6185, 6313, 6441, 6569, 6697, 6825, 6953, 7081, 7209,
+    5795, 5923, 6051, 6179, 6307, 6435, 6563, 6691, 6819, 6947, 7075, 7203,
+    5787, 5915, 6043, 6171, 6299, 6427, 6555, 6683, 6811, 6939, 7067, 7195, 5788, 5916, 6044, 6172, 6300, 6428, 6556, 6684, 6812, 6940, 7068, 7196,
+    4859, 4965, 5071, 5177, 5283, 5389, 5495, 5601, 976,
+    7708, 7818, 7928, 8038, 8148, 8258, 8368, 8478, 976,
+    5796, 5924, 6052, 6180, 6308, 6436, 6564, 6692, 6820, 6948, 7076, 7204, 976,
+    1697, 976,
+};
+
+/// Public counter definitions for CLGFX6
+static constexpr GPA_PublicCounterDef s_publicCountersCLGfx6[] =
+{
+    { "Wavefronts", "#General#Total wavefronts.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 0, 1, "0" },
+    { "VALUInsts", "#General#The average number of vector ALU instructions executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 1, 2, "0,1,/" },
+    { "SALUInsts", "#General#The average number of scalar ALU instructions executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 3, 2, "0,1,/" },
+    { "VFetchInsts", "#General#The average number of vector fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 5, 2, "0,1,/" },
+    { "SFetchInsts", "#General#The average number of scalar fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 7, 2, "0,1,/" },
+    { "VWriteInsts", "#General#The average number of vector write instructions to the video memory executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 9, 2, "0,1,/" },
+    { "LDSInsts", "#LocalMemory#The average number of LDS read or LDS write instructions executed per work item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 11, 2, "0,1,/" },
+    { "GDSInsts", "#General#The average number of GDS read or GDS write instructions executed per work item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 13, 2, "0,1,/" },
+    { "VALUUtilization", "#General#The percentage of active vector ALU threads in a wave. A lower number can mean either more thread divergence in a wave or that the work-group size is not a multiple of 64. Value range: 0% (bad), 100% (ideal - no thread divergence).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 15, 2, "0,1,(64),*,/,(100),*,(100),min" },
+    { "VALUBusy", "#General#The percentage of GPUTime vector ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 17, 2, "0,(4),*,NUM_SIMDS,/,1,/,(100),*" },
+    { "SALUBusy", "#General#The percentage of GPUTime scalar ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 19, 2, "0,(4),*,NUM_SIMDS,NUM_SHADER_ENGINES,/,/,1,/,(100),*" },
+    { "FetchSize", "#GlobalMemory#The total kilobytes fetched from the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, GPA_COUNTER_TYPE_DYNAMIC, 21, 12, "0,1,2,3,4,5,6,7,8,9,10,11,sum12,(32),*,(1024),/" },
+    { "WriteSize", "#GlobalMemory#The total kilobytes written to the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, GPA_COUNTER_TYPE_DYNAMIC, 33, 12, "0,1,2,3,4,5,6,7,8,9,10,11,sum12,(32),*,(1024),/" },
+    { "CacheHit", "#GlobalMemory#The percentage of fetch, write, atomic, and other instructions that hit the data cache. Value range: 0% (no hit) to 100% (optimal).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 45, 24, "0,1,2,3,4,5,6,7,8,9,10,11,sum12,0,1,2,3,4,5,6,7,8,9,10,11,sum12,12,13,14,15,16,17,18,19,20,21,22,23,sum12,+,/,(100),*" },
+    { "MemUnitBusy", "#GlobalMemory#The percentage of GPUTime the memory unit is active. The result includes the stall time (MemUnitStalled). This is measured with all extra fetches and writes and any cache or memory effects taken into account. Value range: 0% to 100% (fetch-bound).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 69, 9, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,/,NUM_SHADER_ENGINES,/,(100),*" },
+    { "MemUnitStalled", "#GlobalMemory#The percentage of GPUTime the memory unit is stalled. Try reducing the number or size of fetches and writes if possible. Value range: 0% (optimal) to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 78, 9, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,/,NUM_SHADER_ENGINES,/,(100),*" },
+    { "WriteUnitStalled", "#GlobalMemory#The percentage of GPUTime the Write unit is stalled. Value range: 0% to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 87, 13, "0,1,max,2,max,3,max,4,max,5,max,7,max,8,max,9,max,10,max,11,max,12,/,(100),*" },
+    { "LDSBankConflict", "#LocalMemory#The percentage of GPUTime LDS is stalled by bank conflicts. Value range: 0% (optimal) to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 100, 2, "0,1,/,NUM_SIMDS,/,(100),*" },
+};
 
-        p.DefinePublicCounter("LDSBankConflict", "#LocalMemory#The percentage of GPUTime LDS is stalled by bank conflicts. Value range: 0% (optimal) to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,/,NUM_SIMDS,/,(100),*");
-    }
+void AutoDefinePublicCountersCLGfx6(GPA_PublicCounters& p)
+{
+    p.DefinePublicCounters(s_publicCountersCLGfx6, sizeof(s_publicCountersCLGfx6) / sizeof(s_publicCountersCLGfx6[0]), s_internalCountersCLGfx6);
 }
 
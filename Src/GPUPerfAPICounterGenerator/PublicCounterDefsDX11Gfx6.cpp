@@ -9,1374 +9,153 @@
 
 // *** Note, this is an auto-generated file. Do not edit. Execute PublicCounterCompiler to rebuild.
 
-void AutoDefinePublicCountersDX11Gfx6(GPA_PublicCounters& p)
+/// Internal counters required by the public counters for DX11GFX6, referenced by offset from the counter definitions
+static constexpr gpa_uint32 s_internalCountersDX11Gfx6[] =
 {
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16886);
-
-        p.DefinePublicCounter("GPUTime", "#Timing#Time this API call took to execute on the GPU in milliseconds. Does not include time that draw calls are processed in parallel.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_API_DYNAMIC, internalCounters, "0,TS_FREQ,/,(1000),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(3892);
-        internalCounters.push_back(3890);
-
-        p.DefinePublicCounter("GPUBusy", "#Timing#The percentage of time GPU was busy.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,/,(100),*,(100),min");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16466);
-        internalCounters.push_back(16606);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("TessellatorBusy", "#Timing#The percentage of time the tessellation engine is busy.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,max,2,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4993);
-        internalCounters.push_back(5182);
-        internalCounters.push_back(5011);
-        internalCounters.push_back(5200);
-        internalCounters.push_back(5029);
-        internalCounters.push_back(5218);
-        internalCounters.push_back(5059);
-        internalCounters.push_back(5248);
-        internalCounters.push_back(5002);
-        internalCounters.push_back(5191);
-        internalCounters.push_back(5017);
-        internalCounters.push_back(5206);
-        internalCounters.push_back(5035);
-        internalCounters.push_back(5224);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("VSBusy", "#Timing#The percentage of time the ShaderUnit has vertex shader work to do.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,8,ifnotzero,2,10,ifnotzero,4,12,ifnotzero,(0),1,9,ifnotzero,3,11,ifnotzero,5,13,ifnotzero,max,14,/,(100),*,(100),min");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16886);
-        internalCounters.push_back(4993);
-        internalCounters.push_back(5182);
-        internalCounters.push_back(5011);
-        internalCounters.push_back(5200);
-        internalCounters.push_back(5029);
-        internalCounters.push_back(5218);
-        internalCounters.push_back(5059);
-        internalCounters.push_back(5248);
-        internalCounters.push_back(5002);
-        internalCounters.push_back(5191);
-        internalCounters.push_back(5017);
-        internalCounters.push_back(5206);
-        internalCounters.push_back(5035);
-        internalCounters.push_back(5224);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("VSTime", "#Timing#Time vertex shaders are busy in milliseconds.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),1,9,ifnotzero,3,11,ifnotzero,5,13,ifnotzero,(0),2,10,ifnotzero,4,12,ifnotzero,6,14,ifnotzero,max,15,/,(1),min,0,TS_FREQ,/,(1000),*,*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5020);
-        internalCounters.push_back(5209);
-        internalCounters.push_back(5026);
-        internalCounters.push_back(5215);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("HSBusy", "#Timing#The percentage of time the ShaderUnit has hull shader work to do.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,2,ifnotzero,(0),1,3,ifnotzero,max,4,/,(100),*,(100),min");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16886);
-        internalCounters.push_back(5020);
-        internalCounters.push_back(5209);
-        internalCounters.push_back(5026);
-        internalCounters.push_back(5215);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("HSTime", "#Timing#Time hull shaders are busy in milliseconds.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),1,3,ifnotzero,(0),2,4,ifnotzero,max,5,/,(1),min,0,TS_FREQ,/,(1000),*,*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4993);
-        internalCounters.push_back(5182);
-        internalCounters.push_back(5011);
-        internalCounters.push_back(5200);
-        internalCounters.push_back(5059);
-        internalCounters.push_back(5248);
-        internalCounters.push_back(5017);
-        internalCounters.push_back(5206);
-        internalCounters.push_back(5035);
-        internalCounters.push_back(5224);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("DSBusy", "#Timing#The percentage of time the ShaderUnit has domain shader work to do.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,2,6,ifnotzero,8,ifnotzero,(0),1,3,7,ifnotzero,9,ifnotzero,max,10,/,(100),*,(100),min");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16886);
-        internalCounters.push_back(4993);
-        internalCounters.push_back(5182);
-        internalCounters.push_back(5011);
-        internalCounters.push_back(5200);
-        internalCounters.push_back(5059);
-        internalCounters.push_back(5248);
-        internalCounters.push_back(5017);
-        internalCounters.push_back(5206);
-        internalCounters.push_back(5035);
-        internalCounters.push_back(5224);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("DSTime", "#Timing#Time domain shaders are busy in milliseconds.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),1,3,7,ifnotzero,9,ifnotzero,(0),2,4,8,ifnotzero,10,ifnotzero,max,11,/,(1),min,0,TS_FREQ,/,(1000),*,*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5005);
-        internalCounters.push_back(5194);
-        internalCounters.push_back(5008);
-        internalCounters.push_back(5197);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("GSBusy", "#Timing#The percentage of time the ShaderUnit has geometry shader work to do.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,2,ifnotzero,(0),1,3,ifnotzero,max,4,/,(100),*,(100),min");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16886);
-        internalCounters.push_back(5005);
-        internalCounters.push_back(5194);
-        internalCounters.push_back(5008);
-        internalCounters.push_back(5197);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("GSTime", "#Timing#Time geometry shaders are busy in milliseconds.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),1,3,ifnotzero,(0),2,4,ifnotzero,max,5,/,(1),min,0,TS_FREQ,/,(1000),*,*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5059);
-        internalCounters.push_back(5248);
-        internalCounters.push_back(5066);
-        internalCounters.push_back(5255);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("PSBusy", "#Timing#The percentage of time the ShaderUnit has pixel shader work to do.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,2,ifnotzero,(0),1,3,ifnotzero,max,4,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16886);
-        internalCounters.push_back(5059);
-        internalCounters.push_back(5248);
-        internalCounters.push_back(5066);
-        internalCounters.push_back(5255);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("PSTime", "#Timing#Time pixel shaders are busy in milliseconds.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),1,3,ifnotzero,(0),2,4,ifnotzero,max,5,/,0,TS_FREQ,/,(1000),*,*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5038);
-        internalCounters.push_back(5227);
-        internalCounters.push_back(5043);
-        internalCounters.push_back(5232);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("CSBusy", "#Timing#The percentage of time the ShaderUnit has compute shader work to do.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,2,ifnotzero,(0),1,3,ifnotzero,max,4,/,(100),*,(100),min");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16886);
-        internalCounters.push_back(5038);
-        internalCounters.push_back(5227);
-        internalCounters.push_back(5043);
-        internalCounters.push_back(5232);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("CSTime", "#Timing#Time compute shaders are busy in milliseconds.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),1,3,ifnotzero,(0),2,4,ifnotzero,max,5,/,(1),min,0,TS_FREQ,/,(1000),*,*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16361);
-        internalCounters.push_back(16501);
-        internalCounters.push_back(16342);
-        internalCounters.push_back(16482);
-        internalCounters.push_back(16437);
-        internalCounters.push_back(16577);
-
-        p.DefinePublicCounter("VSVerticesIn", "#VertexShader#The number of vertices processed by the VS.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,+,2,3,+,2,3,+,ifnotzero,4,5,+,4,5,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16446);
-        internalCounters.push_back(16586);
-
-        p.DefinePublicCounter("HSPatches", "#HullShader#The number of patches processed by the HS.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,+");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16361);
-        internalCounters.push_back(16501);
-        internalCounters.push_back(16342);
-        internalCounters.push_back(16482);
-        internalCounters.push_back(16437);
-        internalCounters.push_back(16577);
-
-        p.DefinePublicCounter("DSVerticesIn", "#DomainShader#The number of vertices processed by the DS.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,2,3,+,2,3,+,ifnotzero,4,5,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16350);
-        internalCounters.push_back(16490);
-
-        p.DefinePublicCounter("GSPrimsIn", "#GeometryShader#The number of primitives passed into the GS.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,+");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(16361);
-        internalCounters.push_back(16501);
-        internalCounters.push_back(16342);
-        internalCounters.push_back(16482);
-
-        p.DefinePublicCounter("GSVerticesOut", "#GeometryShader#The number of vertices output by the GS.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,2,3,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4113);
-        internalCounters.push_back(4249);
-        internalCounters.push_back(4117);
-        internalCounters.push_back(4253);
-        internalCounters.push_back(4069);
-        internalCounters.push_back(4205);
-        internalCounters.push_back(4081);
-        internalCounters.push_back(4217);
-        internalCounters.push_back(4070);
-        internalCounters.push_back(4206);
-        internalCounters.push_back(4082);
-        internalCounters.push_back(4218);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("PrimitiveAssemblyBusy", "#Timing#The percentage of GPUTime that primitive assembly (clipping and culling) is busy. High values may be caused by having many small primitives; mid to low values may indicate pixel shader or output buffer bottleneck.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,2,-,4,6,+,8,+,10,(2),*,+,SU_CLOCKS_PRIM,*,-,1,3,-,5,7,+,9,+,11,(2),*,+,SU_CLOCKS_PRIM,*,-,max,(0),max,12,/,(100),*,(100),min");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4016);
-        internalCounters.push_back(4152);
-
-        p.DefinePublicCounter("PrimitivesIn", "#PrimitiveAssembly#The number of primitives received by the hardware. This includes primitives generated by tessellation.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,+");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4022);
-        internalCounters.push_back(4158);
-        internalCounters.push_back(4062);
-        internalCounters.push_back(4198);
-        internalCounters.push_back(4063);
-        internalCounters.push_back(4199);
-        internalCounters.push_back(4064);
-        internalCounters.push_back(4200);
-        internalCounters.push_back(4065);
-        internalCounters.push_back(4201);
-
-        p.DefinePublicCounter("CulledPrims", "#PrimitiveAssembly#The number of culled primitives. Typical reasons include scissor, the primitive having zero area, and back or front face culling.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,+,2,+,3,+,4,+,5,+,6,+,7,+,8,+,9,+");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4029);
-        internalCounters.push_back(4165);
-
-        p.DefinePublicCounter("ClippedPrims", "#PrimitiveAssembly#The number of primitives that required one or more clipping operations due to intersecting the view volume or user clip planes.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,+");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4117);
-        internalCounters.push_back(4253);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("PAStalledOnRasterizer", "#PrimitiveAssembly#Percentage of GPUTime that primitive assembly waits for rasterization to be ready to accept data. This roughly indicates for what percentage of time the pipeline is bottlenecked by pixel operations.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,max,2,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4876);
-        internalCounters.push_back(4908);
-        internalCounters.push_back(4940);
-        internalCounters.push_back(4972);
-        internalCounters.push_back(4881);
-        internalCounters.push_back(4913);
-        internalCounters.push_back(4945);
-        internalCounters.push_back(4977);
-        internalCounters.push_back(4886);
-        internalCounters.push_back(4918);
-        internalCounters.push_back(4950);
-        internalCounters.push_back(4982);
-        internalCounters.push_back(4891);
-        internalCounters.push_back(4923);
-        internalCounters.push_back(4955);
-        internalCounters.push_back(4987);
-
-        p.DefinePublicCounter("PSPixelsOut", "#PixelShader#Pixels exported from shader to colour buffers. Does not include killed or alpha tested pixels; if there are multiple rendertargets, each rendertarget receives one export, so this will be 2 for 1 pixel written to two RTs.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,12,13,14,15,sum4,sum4");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4878);
-        internalCounters.push_back(4910);
-        internalCounters.push_back(4942);
-        internalCounters.push_back(4974);
-        internalCounters.push_back(4883);
-        internalCounters.push_back(4915);
-        internalCounters.push_back(4947);
-        internalCounters.push_back(4979);
-        internalCounters.push_back(4888);
-        internalCounters.push_back(4920);
-        internalCounters.push_back(4952);
-        internalCounters.push_back(4984);
-        internalCounters.push_back(4893);
-        internalCounters.push_back(4925);
-        internalCounters.push_back(4957);
-        internalCounters.push_back(4989);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("PSExportStalls", "#PixelShader#Pixel shader output stalls. Percentage of GPUBusy. Should be zero for PS or further upstream limited cases; if not zero, indicates a bottleneck in late Z testing or in the colour buffer.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max,16,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSThreadGroups", "#ComputeShader#Total number of thread groups.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,+");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5043);
-        internalCounters.push_back(5232);
-
-        p.DefinePublicCounter("CSWavefronts", "#ComputeShader#The total number of wavefronts used for the CS.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,+");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-        internalCounters.push_back(5379);
-        internalCounters.push_back(5778);
-
-        p.DefinePublicCounter("CSThreads", "#ComputeShader#The number of CS threads processed by the hardware.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),2,3,+,0,1,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5384);
-        internalCounters.push_back(5783);
-        internalCounters.push_back(5374);
-        internalCounters.push_back(5773);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSVALUInsts", "#ComputeShader#The average number of vector ALU instructions executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5428);
-        internalCounters.push_back(5827);
-        internalCounters.push_back(5420);
-        internalCounters.push_back(5819);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSVALUUtilization", "#ComputeShader#The percentage of active vector ALU threads in a wave. A lower number can mean either more thread divergence in a wave or that the work-group size is not a multiple of 64. Value range: 0% (bad), 100% (ideal - no thread divergence).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,2,3,+,(64),*,/,(100),*,4,5,+,ifnotzero,(100),min");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5388);
-        internalCounters.push_back(5787);
-        internalCounters.push_back(5374);
-        internalCounters.push_back(5773);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSSALUInsts", "#ComputeShader#The average number of scalar ALU instructions executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5386);
-        internalCounters.push_back(5785);
-        internalCounters.push_back(5374);
-        internalCounters.push_back(5773);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSVFetchInsts", "#ComputeShader#The average number of vector fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5389);
-        internalCounters.push_back(5788);
-        internalCounters.push_back(5374);
-        internalCounters.push_back(5773);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSSFetchInsts", "#ComputeShader#The average number of scalar fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5385);
-        internalCounters.push_back(5784);
-        internalCounters.push_back(5374);
-        internalCounters.push_back(5773);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSVWriteInsts", "#ComputeShader#The average number of vector write instructions to the video memory executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5420);
-        internalCounters.push_back(5819);
-        internalCounters.push_back(3892);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSVALUBusy", "#ComputeShader#The percentage of GPUTime vector ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,(4),*,NUM_SIMDS,/,2,/,(100),*,3,4,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5425);
-        internalCounters.push_back(5824);
-        internalCounters.push_back(3892);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSSALUBusy", "#ComputeShader#The percentage of GPUTime scalar ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,(4),*,NUM_SIMDS,NUM_SHADER_ENGINES,/,/,2,/,(100),*,3,4,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(6168);
-        internalCounters.push_back(6274);
-        internalCounters.push_back(6380);
-        internalCounters.push_back(6486);
-        internalCounters.push_back(6592);
-        internalCounters.push_back(6698);
-        internalCounters.push_back(6804);
-        internalCounters.push_back(6910);
-        internalCounters.push_back(7016);
-        internalCounters.push_back(7122);
-        internalCounters.push_back(7228);
-        internalCounters.push_back(7334);
-        internalCounters.push_back(7440);
-        internalCounters.push_back(7546);
-        internalCounters.push_back(7652);
-        internalCounters.push_back(7758);
-        internalCounters.push_back(7864);
-        internalCounters.push_back(7970);
-        internalCounters.push_back(8076);
-        internalCounters.push_back(8182);
-        internalCounters.push_back(8288);
-        internalCounters.push_back(8394);
-        internalCounters.push_back(8500);
-        internalCounters.push_back(8606);
-        internalCounters.push_back(8712);
-        internalCounters.push_back(8818);
-        internalCounters.push_back(8924);
-        internalCounters.push_back(9030);
-        internalCounters.push_back(9136);
-        internalCounters.push_back(9242);
-        internalCounters.push_back(9348);
-        internalCounters.push_back(9454);
-        internalCounters.push_back(3892);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSMemUnitBusy", "#ComputeShader#The percentage of GPUTime the memory unit is active. The result includes the stall time (MemUnitStalled). This is measured with all extra fetches and writes and any cache or memory effects taken into account. Value range: 0% to 100% (fetch-bound).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,max32,32,/,(100),*,33,34,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(11131);
-        internalCounters.push_back(11241);
-        internalCounters.push_back(11351);
-        internalCounters.push_back(11461);
-        internalCounters.push_back(11571);
-        internalCounters.push_back(11681);
-        internalCounters.push_back(11791);
-        internalCounters.push_back(11901);
-        internalCounters.push_back(12011);
-        internalCounters.push_back(12121);
-        internalCounters.push_back(12231);
-        internalCounters.push_back(12341);
-        internalCounters.push_back(12451);
-        internalCounters.push_back(12561);
-        internalCounters.push_back(12671);
-        internalCounters.push_back(12781);
-        internalCounters.push_back(12891);
-        internalCounters.push_back(13001);
-        internalCounters.push_back(13111);
-        internalCounters.push_back(13221);
-        internalCounters.push_back(13331);
-        internalCounters.push_back(13441);
-        internalCounters.push_back(13551);
-        internalCounters.push_back(13661);
-        internalCounters.push_back(13771);
-        internalCounters.push_back(13881);
-        internalCounters.push_back(13991);
-        internalCounters.push_back(14101);
-        internalCounters.push_back(14211);
-        internalCounters.push_back(14321);
-        internalCounters.push_back(14431);
-        internalCounters.push_back(14541);
-        internalCounters.push_back(3892);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSMemUnitStalled", "#ComputeShader#The percentage of GPUTime the memory unit is stalled. Try reducing the number or size of fetches and writes if possible. Value range: 0% (optimal) to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,max32,32,/,(100),*,33,34,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(14672);
-        internalCounters.push_back(14800);
-        internalCounters.push_back(14928);
-        internalCounters.push_back(15056);
-        internalCounters.push_back(15184);
-        internalCounters.push_back(15312);
-        internalCounters.push_back(15440);
-        internalCounters.push_back(15568);
-        internalCounters.push_back(15696);
-        internalCounters.push_back(15824);
-        internalCounters.push_back(15952);
-        internalCounters.push_back(16080);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSFetchSize", "#ComputeShader#The total kilobytes fetched from the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,sum12,(32),*,(1024),/,12,13,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(14666);
-        internalCounters.push_back(14794);
-        internalCounters.push_back(14922);
-        internalCounters.push_back(15050);
-        internalCounters.push_back(15178);
-        internalCounters.push_back(15306);
-        internalCounters.push_back(15434);
-        internalCounters.push_back(15562);
-        internalCounters.push_back(15690);
-        internalCounters.push_back(15818);
-        internalCounters.push_back(15946);
-        internalCounters.push_back(16074);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSWriteSize", "#ComputeShader#The total kilobytes written to the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,sum12,(32),*,(1024),/,12,13,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(14658);
-        internalCounters.push_back(14786);
-        internalCounters.push_back(14914);
-        internalCounters.push_back(15042);
-        internalCounters.push_back(15170);
-        internalCounters.push_back(15298);
-        internalCounters.push_back(15426);
-        internalCounters.push_back(15554);
-        internalCounters.push_back(15682);
-        internalCounters.push_back(15810);
-        internalCounters.push_back(15938);
-        internalCounters.push_back(16066);
-        internalCounters.push_back(14659);
-        internalCounters.push_back(14787);
-        internalCounters.push_back(14915);
-        internalCounters.push_back(15043);
-        internalCounters.push_back(15171);
-        internalCounters.push_back(15299);
-        internalCounters.push_back(15427);
-        internalCounters.push_back(15555);
-        internalCounters.push_back(15683);
-        internalCounters.push_back(15811);
-        internalCounters.push_back(15939);
-        internalCounters.push_back(16067);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSCacheHit", "#ComputeShader#The percentage of fetch, write, atomic, and other instructions that hit the data cache. Value range: 0% (no hit) to 100% (optimal).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,2,3,4,5,6,7,8,9,10,11,sum12,0,1,2,3,4,5,6,7,8,9,10,11,sum12,12,13,14,15,16,17,18,19,20,21,22,23,sum12,+,/,(100),*,24,25,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(14667);
-        internalCounters.push_back(14795);
-        internalCounters.push_back(14923);
-        internalCounters.push_back(15051);
-        internalCounters.push_back(15179);
-        internalCounters.push_back(15307);
-        internalCounters.push_back(15435);
-        internalCounters.push_back(15563);
-        internalCounters.push_back(15691);
-        internalCounters.push_back(15819);
-        internalCounters.push_back(15947);
-        internalCounters.push_back(16075);
-        internalCounters.push_back(3892);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSWriteUnitStalled", "#ComputeShader#The percentage of GPUTime the Write unit is stalled. Value range: 0% to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,max,2,max,3,max,4,max,5,max,7,max,8,max,9,max,10,max,11,max,12,/,(100),*,13,14,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5391);
-        internalCounters.push_back(5790);
-        internalCounters.push_back(5374);
-        internalCounters.push_back(5773);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSGDSInsts", "#ComputeShader#The average number of GDS read or GDS write instructions executed per work item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5390);
-        internalCounters.push_back(5789);
-        internalCounters.push_back(5374);
-        internalCounters.push_back(5773);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSLDSInsts", "#ComputeShader#The average number of LDS read/write instructions executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5409);
-        internalCounters.push_back(5808);
-        internalCounters.push_back(5374);
-        internalCounters.push_back(5773);
-        internalCounters.push_back(3892);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSALUStalledByLDS", "#ComputeShader#The percentage of GPUTime ALU units are stalled by the LDS input queue being full or the output queue being not ready. If there are LDS bank conflicts, reduce them. Otherwise, try reducing the number of LDS accesses if possible. Value range: 0% (optimal) to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,2,3,+,/,4,/,NUM_SHADER_ENGINES,/,(100),*,5,6,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(5432);
-        internalCounters.push_back(5831);
-        internalCounters.push_back(3892);
-        internalCounters.push_back(5040);
-        internalCounters.push_back(5229);
-
-        p.DefinePublicCounter("CSLDSBankConflict", "#ComputeShader#The percentage of GPUTime LDS is stalled by bank conflicts. Value range: 0% (optimal) to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "(0),0,1,+,2,/,NUM_SIMDS,/,(100),*,3,4,+,ifnotzero");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(6168);
-        internalCounters.push_back(6274);
-        internalCounters.push_back(6380);
-        internalCounters.push_back(6486);
-        internalCounters.push_back(6592);
-        internalCounters.push_back(6698);
-        internalCounters.push_back(6804);
-        internalCounters.push_back(6910);
-        internalCounters.push_back(7016);
-        internalCounters.push_back(7122);
-        internalCounters.push_back(7228);
-        internalCounters.push_back(7334);
-        internalCounters.push_back(7440);
-        internalCounters.push_back(7546);
-        internalCounters.push_back(7652);
-        internalCounters.push_back(7758);
-        internalCounters.push_back(7864);
-        internalCounters.push_back(7970);
-        internalCounters.push_back(8076);
-        internalCounters.push_back(8182);
-        internalCounters.push_back(8288);
-        internalCounters.push_back(8394);
-        internalCounters.push_back(8500);
-        internalCounters.push_back(8606);
-        internalCounters.push_back(8712);
-        internalCounters.push_back(8818);
-        internalCounters.push_back(8924);
-        internalCounters.push_back(9030);
-        internalCounters.push_back(9136);
-        internalCounters.push_back(9242);
-        internalCounters.push_back(9348);
-        internalCounters.push_back(9454);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("TexUnitBusy", "#Timing#The percentage of GPUTime the texture unit is active. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max,16,max,17,max,18,max,19,max,20,max,21,max,22,max,23,max,24,max,25,max,26,max,27,max,28,max,29,max,30,max,31,max,32,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(6237);
-        internalCounters.push_back(6343);
-        internalCounters.push_back(6449);
-        internalCounters.push_back(6555);
-        internalCounters.push_back(6661);
-        internalCounters.push_back(6767);
-        internalCounters.push_back(6873);
-        internalCounters.push_back(6979);
-        internalCounters.push_back(7085);
-        internalCounters.push_back(7191);
-        internalCounters.push_back(7297);
-        internalCounters.push_back(7403);
-        internalCounters.push_back(7509);
-        internalCounters.push_back(7615);
-        internalCounters.push_back(7721);
-        internalCounters.push_back(7827);
-        internalCounters.push_back(7933);
-        internalCounters.push_back(8039);
-        internalCounters.push_back(8145);
-        internalCounters.push_back(8251);
-        internalCounters.push_back(8357);
-        internalCounters.push_back(8463);
-        internalCounters.push_back(8569);
-        internalCounters.push_back(8675);
-        internalCounters.push_back(8781);
-        internalCounters.push_back(8887);
-        internalCounters.push_back(8993);
-        internalCounters.push_back(9099);
-        internalCounters.push_back(9205);
-        internalCounters.push_back(9311);
-        internalCounters.push_back(9417);
-        internalCounters.push_back(9523);
-        internalCounters.push_back(6236);
-        internalCounters.push_back(6342);
-        internalCounters.push_back(6448);
-        internalCounters.push_back(6554);
-        internalCounters.push_back(6660);
-        internalCounters.push_back(6766);
-        internalCounters.push_back(6872);
-        internalCounters.push_back(6978);
-        internalCounters.push_back(7084);
-        internalCounters.push_back(7190);
-        internalCounters.push_back(7296);
-        internalCounters.push_back(7402);
-        internalCounters.push_back(7508);
-        internalCounters.push_back(7614);
-        internalCounters.push_back(7720);
-        internalCounters.push_back(7826);
-        internalCounters.push_back(7932);
-        internalCounters.push_back(8038);
-        internalCounters.push_back(8144);
-        internalCounters.push_back(8250);
-        internalCounters.push_back(8356);
-        internalCounters.push_back(8462);
-        internalCounters.push_back(8568);
-        internalCounters.push_back(8674);
-        internalCounters.push_back(8780);
-        internalCounters.push_back(8886);
-        internalCounters.push_back(8992);
-        internalCounters.push_back(9098);
-        internalCounters.push_back(9204);
-        internalCounters.push_back(9310);
-        internalCounters.push_back(9416);
-        internalCounters.push_back(9522);
-
-        p.DefinePublicCounter("TexTriFilteringPct", "#TextureUnit#Percentage of pixels that received trilinear filtering. Note that not all pixels for which trilinear filtering is enabled will receive it (e.g. if the texture is magnified).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum32,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum32,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum32,+,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(6239);
-        internalCounters.push_back(6345);
-        internalCounters.push_back(6451);
-        internalCounters.push_back(6557);
-        internalCounters.push_back(6663);
-        internalCounters.push_back(6769);
-        internalCounters.push_back(6875);
-        internalCounters.push_back(6981);
-        internalCounters.push_back(7087);
-        internalCounters.push_back(7193);
-        internalCounters.push_back(7299);
-        internalCounters.push_back(7405);
-        internalCounters.push_back(7511);
-        internalCounters.push_back(7617);
-        internalCounters.push_back(7723);
-        internalCounters.push_back(7829);
-        internalCounters.push_back(7935);
-        internalCounters.push_back(8041);
-        internalCounters.push_back(8147);
-        internalCounters.push_back(8253);
-        internalCounters.push_back(8359);
-        internalCounters.push_back(8465);
-        internalCounters.push_back(8571);
-        internalCounters.push_back(8677);
-        internalCounters.push_back(8783);
-        internalCounters.push_back(8889);
-        internalCounters.push_back(8995);
-        internalCounters.push_back(9101);
-        internalCounters.push_back(9207);
-        internalCounters.push_back(9313);
-        internalCounters.push_back(9419);
-        internalCounters.push_back(9525);
-        internalCounters.push_back(6238);
-        internalCounters.push_back(6344);
-        internalCounters.push_back(6450);
-        internalCounters.push_back(6556);
-        internalCounters.push_back(6662);
-        internalCounters.push_back(6768);
-        internalCounters.push_back(6874);
-        internalCounters.push_back(6980);
-        internalCounters.push_back(7086);
-        internalCounters.push_back(7192);
-        internalCounters.push_back(7298);
-        internalCounters.push_back(7404);
-        internalCounters.push_back(7510);
-        internalCounters.push_back(7616);
-        internalCounters.push_back(7722);
-        internalCounters.push_back(7828);
-        internalCounters.push_back(7934);
-        internalCounters.push_back(8040);
-        internalCounters.push_back(8146);
-        internalCounters.push_back(8252);
-        internalCounters.push_back(8358);
-        internalCounters.push_back(8464);
-        internalCounters.push_back(8570);
-        internalCounters.push_back(8676);
-        internalCounters.push_back(8782);
-        internalCounters.push_back(8888);
-        internalCounters.push_back(8994);
-        internalCounters.push_back(9100);
-        internalCounters.push_back(9206);
-        internalCounters.push_back(9312);
-        internalCounters.push_back(9418);
-        internalCounters.push_back(9524);
-
-        p.DefinePublicCounter("TexVolFilteringPct", "#TextureUnit#Percentage of pixels that received volume filtering.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum32,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum32,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum32,+,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(6257);
-        internalCounters.push_back(6363);
-        internalCounters.push_back(6469);
-        internalCounters.push_back(6575);
-        internalCounters.push_back(6681);
-        internalCounters.push_back(6787);
-        internalCounters.push_back(6893);
-        internalCounters.push_back(6999);
-        internalCounters.push_back(7105);
-        internalCounters.push_back(7211);
-        internalCounters.push_back(7317);
-        internalCounters.push_back(7423);
-        internalCounters.push_back(7529);
-        internalCounters.push_back(7635);
-        internalCounters.push_back(7741);
-        internalCounters.push_back(7847);
-        internalCounters.push_back(7953);
-        internalCounters.push_back(8059);
-        internalCounters.push_back(8165);
-        internalCounters.push_back(8271);
-        internalCounters.push_back(8377);
-        internalCounters.push_back(8483);
-        internalCounters.push_back(8589);
-        internalCounters.push_back(8695);
-        internalCounters.push_back(8801);
-        internalCounters.push_back(8907);
-        internalCounters.push_back(9013);
-        internalCounters.push_back(9119);
-        internalCounters.push_back(9225);
-        internalCounters.push_back(9331);
-        internalCounters.push_back(9437);
-        internalCounters.push_back(9543);
-        internalCounters.push_back(6258);
-        internalCounters.push_back(6364);
-        internalCounters.push_back(6470);
-        internalCounters.push_back(6576);
-        internalCounters.push_back(6682);
-        internalCounters.push_back(6788);
-        internalCounters.push_back(6894);
-        internalCounters.push_back(7000);
-        internalCounters.push_back(7106);
-        internalCounters.push_back(7212);
-        internalCounters.push_back(7318);
-        internalCounters.push_back(7424);
-        internalCounters.push_back(7530);
-        internalCounters.push_back(7636);
-        internalCounters.push_back(7742);
-        internalCounters.push_back(7848);
-        internalCounters.push_back(7954);
-        internalCounters.push_back(8060);
-        internalCounters.push_back(8166);
-        internalCounters.push_back(8272);
-        internalCounters.push_back(8378);
-        internalCounters.push_back(8484);
-        internalCounters.push_back(8590);
-        internalCounters.push_back(8696);
-        internalCounters.push_back(8802);
-        internalCounters.push_back(8908);
-        internalCounters.push_back(9014);
-        internalCounters.push_back(9120);
-        internalCounters.push_back(9226);
-        internalCounters.push_back(9332);
-        internalCounters.push_back(9438);
-        internalCounters.push_back(9544);
-        internalCounters.push_back(6259);
-        internalCounters.push_back(6365);
-        internalCounters.push_back(6471);
-        internalCounters.push_back(6577);
-        internalCounters.push_back(6683);
-        internalCounters.push_back(6789);
-        internalCounters.push_back(6895);
-        internalCounters.push_back(7001);
-        internalCounters.push_back(7107);
-        internalCounters.push_back(7213);
-        internalCounters.push_back(7319);
-        internalCounters.push_back(7425);
-        internalCounters.push_back(7531);
-        internalCounters.push_back(7637);
-        internalCounters.push_back(7743);
-        internalCounters.push_back(7849);
-        internalCounters.push_back(7955);
-        internalCounters.push_back(8061);
-        internalCounters.push_back(8167);
-        internalCounters.push_back(8273);
-        internalCounters.push_back(8379);
-        internalCounters.push_back(8485);
-        internalCounters.push_back(8591);
-        internalCounters.push_back(8697);
-        internalCounters.push_back(8803);
-        internalCounters.push_back(8909);
-        internalCounters.push_back(9015);
-        internalCounters.push_back(9121);
-        internalCounters.push_back(9227);
-        internalCounters.push_back(9333);
-        internalCounters.push_back(9439);
-        internalCounters.push_back(9545);
-        internalCounters.push_back(6260);
-        internalCounters.push_back(6366);
-        internalCounters.push_back(6472);
-        internalCounters.push_back(6578);
-        internalCounters.push_back(6684);
-        internalCounters.push_back(6790);
-        internalCounters.push_back(6896);
-        internalCounters.push_back(7002);
-        internalCounters.push_back(7108);
-        internalCounters.push_back(7214);
-        internalCounters.push_back(7320);
-        internalCounters.push_back(7426);
-        internalCounters.push_back(7532);
-        internalCounters.push_back(7638);
-        internalCounters.push_back(7744);
-        internalCounters.push_back(7850);
-        internalCounters.push_back(7956);
-        internalCounters.push_back(8062);
-        internalCounters.push_back(8168);
-        internalCounters.push_back(8274);
-        internalCounters.push_back(8380);
-        internalCounters.push_back(8486);
-        internalCounters.push_back(8592);
-        internalCounters.push_back(8698);
-        internalCounters.push_back(8804);
-        internalCounters.push_back(8910);
-        internalCounters.push_back(9016);
-        internalCounters.push_back(9122);
-        internalCounters.push_back(9228);
-        internalCounters.push_back(9334);
-        internalCounters.push_back(9440);
-        internalCounters.push_back(9546);
-        internalCounters.push_back(6261);
-        internalCounters.push_back(6367);
-        internalCounters.push_back(6473);
-        internalCounters.push_back(6579);
-        internalCounters.push_back(6685);
-        internalCounters.push_back(6791);
-        internalCounters.push_back(6897);
-        internalCounters.push_back(7003);
-        internalCounters.push_back(7109);
-        internalCounters.push_back(7215);
-        internalCounters.push_back(7321);
-        internalCounters.push_back(7427);
-        internalCounters.push_back(7533);
-        internalCounters.push_back(7639);
-        internalCounters.push_back(7745);
-        internalCounters.push_back(7851);
-        internalCounters.push_back(7957);
-        internalCounters.push_back(8063);
-        internalCounters.push_back(8169);
-        internalCounters.push_back(8275);
-        internalCounters.push_back(8381);
-        internalCounters.push_back(8487);
-        internalCounters.push_back(8593);
-        internalCounters.push_back(8699);
-        internalCounters.push_back(8805);
-        internalCounters.push_back(8911);
-        internalCounters.push_back(9017);
-        internalCounters.push_back(9123);
-        internalCounters.push_back(9229);
-        internalCounters.push_back(9335);
-        internalCounters.push_back(9441);
-        internalCounters.push_back(9547);
-        internalCounters.push_back(6262);
-        internalCounters.push_back(6368);
-        internalCounters.push_back(6474);
-        internalCounters.push_back(6580);
-        internalCounters.push_back(6686);
-        internalCounters.push_back(6792);
-        internalCounters.push_back(6898);
-        internalCounters.push_back(7004);
-        internalCounters.push_back(7110);
-        internalCounters.push_back(7216);
-        internalCounters.push_back(7322);
-        internalCounters.push_back(7428);
-        internalCounters.push_back(7534);
-        internalCounters.push_back(7640);
-        internalCounters.push_back(7746);
-        internalCounters.push_back(7852);
-        internalCounters.push_back(7958);
-        internalCounters.push_back(8064);
-        internalCounters.push_back(8170);
-        internalCounters.push_back(8276);
-        internalCounters.push_back(8382);
-        internalCounters.push_back(8488);
-        internalCounters.push_back(8594);
-        internalCounters.push_back(8700);
-        internalCounters.push_back(8806);
-        internalCounters.push_back(8912);
-        internalCounters.push_back(9018);
-        internalCounters.push_back(9124);
-        internalCounters.push_back(9230);
-        internalCounters.push_back(9336);
-        internalCounters.push_back(9442);
-        internalCounters.push_back(9548);
-        internalCounters.push_back(6263);
-        internalCounters.push_back(6369);
-        internalCounters.push_back(6475);
-        internalCounters.push_back(6581);
-        internalCounters.push_back(6687);
-        internalCounters.push_back(6793);
-        internalCounters.push_back(6899);
-        internalCounters.push_back(7005);
-        internalCounters.push_back(7111);
-        internalCounters.push_back(7217);
-        internalCounters.push_back(7323);
-        internalCounters.push_back(7429);
-        internalCounters.push_back(7535);
-        internalCounters.push_back(7641);
-        internalCounters.push_back(7747);
-        internalCounters.push_back(7853);
-        internalCounters.push_back(7959);
-        internalCounters.push_back(8065);
-        internalCounters.push_back(8171);
-        internalCounters.push_back(8277);
-        internalCounters.push_back(8383);
-        internalCounters.push_back(8489);
-        internalCounters.push_back(8595);
-        internalCounters.push_back(8701);
-        internalCounters.push_back(8807);
-        internalCounters.push_back(8913);
-        internalCounters.push_back(9019);
-        internalCounters.push_back(9125);
-        internalCounters.push_back(9231);
-        internalCounters.push_back(9337);
-        internalCounters.push_back(9443);
-        internalCounters.push_back(9549);
-        internalCounters.push_back(6264);
-        internalCounters.push_back(6370);
-        internalCounters.push_back(6476);
-        internalCounters.push_back(6582);
-        internalCounters.push_back(6688);
-        internalCounters.push_back(6794);
-        internalCounters.push_back(6900);
-        internalCounters.push_back(7006);
-        internalCounters.push_back(7112);
-        internalCounters.push_back(7218);
-        internalCounters.push_back(7324);
-        internalCounters.push_back(7430);
-        internalCounters.push_back(7536);
-        internalCounters.push_back(7642);
-        internalCounters.push_back(7748);
-        internalCounters.push_back(7854);
-        internalCounters.push_back(7960);
-        internalCounters.push_back(8066);
-        internalCounters.push_back(8172);
-        internalCounters.push_back(8278);
-        internalCounters.push_back(8384);
-        internalCounters.push_back(8490);
-        internalCounters.push_back(8596);
-        internalCounters.push_back(8702);
-        internalCounters.push_back(8808);
-        internalCounters.push_back(8914);
-        internalCounters.push_back(9020);
-        internalCounters.push_back(9126);
-        internalCounters.push_back(9232);
-        internalCounters.push_back(9338);
-        internalCounters.push_back(9444);
-        internalCounters.push_back(9550);
-        internalCounters.push_back(6265);
-        internalCounters.push_back(6371);
-        internalCounters.push_back(6477);
-        internalCounters.push_back(6583);
-        internalCounters.push_back(6689);
-        internalCounters.push_back(6795);
-        internalCounters.push_back(6901);
-        internalCounters.push_back(7007);
-        internalCounters.push_back(7113);
-        internalCounters.push_back(7219);
-        internalCounters.push_back(7325);
-        internalCounters.push_back(7431);
-        internalCounters.push_back(7537);
-        internalCounters.push_back(7643);
-        internalCounters.push_back(7749);
-        internalCounters.push_back(7855);
-        internalCounters.push_back(7961);
-        internalCounters.push_back(8067);
-        internalCounters.push_back(8173);
-        internalCounters.push_back(8279);
-        internalCounters.push_back(8385);
-        internalCounters.push_back(8491);
-        internalCounters.push_back(8597);
-        internalCounters.push_back(8703);
-        internalCounters.push_back(8809);
-        internalCounters.push_back(8915);
-        internalCounters.push_back(9021);
-        internalCounters.push_back(9127);
-        internalCounters.push_back(9233);
-        internalCounters.push_back(9339);
-        internalCounters.push_back(9445);
-        internalCounters.push_back(9551);
-
-        p.DefinePublicCounter("TexAveAnisotropy", "#TextureUnit#The average degree of anisotropy applied. A number between 1 and 16. The anisotropic filtering algorithm only applies samples where they are required (e.g. there will be no extra anisotropic samples if the view vector is perpendicular to the surface) so this can be much lower than the requested anisotropy.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum32,(2),32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum32,*,+,(4),64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,sum32,*,+,(6),96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum32,*,+,(8),128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,sum32,*,+,(10),160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,sum32,*,+,(12),192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,sum32,*,+,(14),224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,sum32,*,+,(16),256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,sum32,*,+,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum32,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum32,+,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,sum32,+,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum32,+,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,sum32,+,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,sum32,+,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,sum32,+,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,sum32,+,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,sum32,+,/");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(2043);
-        internalCounters.push_back(2292);
-        internalCounters.push_back(2541);
-        internalCounters.push_back(2790);
-        internalCounters.push_back(3039);
-        internalCounters.push_back(3288);
-        internalCounters.push_back(3537);
-        internalCounters.push_back(3786);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("DepthStencilTestBusy", "#Timing#Percentage of time GPU spent performing depth and stencil tests relative to GPUBusy.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1913);
-        internalCounters.push_back(2162);
-        internalCounters.push_back(2411);
-        internalCounters.push_back(2660);
-        internalCounters.push_back(2909);
-        internalCounters.push_back(3158);
-        internalCounters.push_back(3407);
-        internalCounters.push_back(3656);
-        internalCounters.push_back(1902);
-        internalCounters.push_back(2151);
-        internalCounters.push_back(2400);
-        internalCounters.push_back(2649);
-        internalCounters.push_back(2898);
-        internalCounters.push_back(3147);
-        internalCounters.push_back(3396);
-        internalCounters.push_back(3645);
-
-        p.DefinePublicCounter("HiZTilesAccepted", "#DepthAndStencil#Percentage of tiles accepted by HiZ and will be rendered to the depth or color buffers.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,sum8,8,9,10,11,12,13,14,15,sum8,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1902);
-        internalCounters.push_back(2151);
-        internalCounters.push_back(2400);
-        internalCounters.push_back(2649);
-        internalCounters.push_back(2898);
-        internalCounters.push_back(3147);
-        internalCounters.push_back(3396);
-        internalCounters.push_back(3645);
-        internalCounters.push_back(1926);
-        internalCounters.push_back(2175);
-        internalCounters.push_back(2424);
-        internalCounters.push_back(2673);
-        internalCounters.push_back(2922);
-        internalCounters.push_back(3171);
-        internalCounters.push_back(3420);
-        internalCounters.push_back(3669);
-
-        p.DefinePublicCounter("PreZTilesDetailCulled", "#DepthAndStencil#Percentage of tiles rejected because the associated prim had no contributing area.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "8,9,10,11,12,13,14,15,sum8,0,1,2,3,4,5,6,7,sum8,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4443);
-        internalCounters.push_back(4735);
-        internalCounters.push_back(4444);
-        internalCounters.push_back(4736);
-        internalCounters.push_back(4445);
-        internalCounters.push_back(4737);
-        internalCounters.push_back(4446);
-        internalCounters.push_back(4738);
-        internalCounters.push_back(4519);
-        internalCounters.push_back(4811);
-        internalCounters.push_back(4520);
-        internalCounters.push_back(4812);
-        internalCounters.push_back(4521);
-        internalCounters.push_back(4813);
-        internalCounters.push_back(4522);
-        internalCounters.push_back(4814);
-
-        p.DefinePublicCounter("HiZQuadsCulled", "#DepthAndStencil#Percentage of quads that did not have to continue on in the pipeline after HiZ. They may be written directly to the depth buffer, or culled completely. Consistently low values here may suggest that the Z-range is not being fully utilized.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,sum8,8,9,10,11,12,13,14,15,sum8,-,0,1,2,3,4,5,6,7,sum8,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4443);
-        internalCounters.push_back(4735);
-        internalCounters.push_back(4444);
-        internalCounters.push_back(4736);
-        internalCounters.push_back(4445);
-        internalCounters.push_back(4737);
-        internalCounters.push_back(4446);
-        internalCounters.push_back(4738);
-        internalCounters.push_back(4543);
-        internalCounters.push_back(4835);
-        internalCounters.push_back(4519);
-        internalCounters.push_back(4811);
-        internalCounters.push_back(4520);
-        internalCounters.push_back(4812);
-        internalCounters.push_back(4521);
-        internalCounters.push_back(4813);
-        internalCounters.push_back(4522);
-        internalCounters.push_back(4814);
-
-        p.DefinePublicCounter("PreZQuadsCulled", "#DepthAndStencil#Percentage of quads rejected based on the detailZ and earlyZ tests.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "10,11,12,13,14,15,16,17,sum8,8,9,+,-,0,1,2,3,4,5,6,7,sum8,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(4543);
-        internalCounters.push_back(4835);
-        internalCounters.push_back(4443);
-        internalCounters.push_back(4735);
-        internalCounters.push_back(4444);
-        internalCounters.push_back(4736);
-        internalCounters.push_back(4445);
-        internalCounters.push_back(4737);
-        internalCounters.push_back(4446);
-        internalCounters.push_back(4738);
-
-        p.DefinePublicCounter("PostZQuads", "#DepthAndStencil#Percentage of quads for which the pixel shader will run and may be postZ tested.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,+,2,3,4,5,6,7,8,9,sum8,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(2078);
-        internalCounters.push_back(2327);
-        internalCounters.push_back(2576);
-        internalCounters.push_back(2825);
-        internalCounters.push_back(3074);
-        internalCounters.push_back(3323);
-        internalCounters.push_back(3572);
-        internalCounters.push_back(3821);
-
-        p.DefinePublicCounter("PreZSamplesPassing", "#DepthAndStencil#Number of samples tested for Z before shading and passed.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,sum8");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(2080);
-        internalCounters.push_back(2329);
-        internalCounters.push_back(2578);
-        internalCounters.push_back(2827);
-        internalCounters.push_back(3076);
-        internalCounters.push_back(3325);
-        internalCounters.push_back(3574);
-        internalCounters.push_back(3823);
-
-        p.DefinePublicCounter("PreZSamplesFailingS", "#DepthAndStencil#Number of samples tested for Z before shading and failed stencil test.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,sum8");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(2079);
-        internalCounters.push_back(2328);
-        internalCounters.push_back(2577);
-        internalCounters.push_back(2826);
-        internalCounters.push_back(3075);
-        internalCounters.push_back(3324);
-        internalCounters.push_back(3573);
-        internalCounters.push_back(3822);
-
-        p.DefinePublicCounter("PreZSamplesFailingZ", "#DepthAndStencil#Number of samples tested for Z before shading and failed Z test.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,sum8");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(2075);
-        internalCounters.push_back(2324);
-        internalCounters.push_back(2573);
-        internalCounters.push_back(2822);
-        internalCounters.push_back(3071);
-        internalCounters.push_back(3320);
-        internalCounters.push_back(3569);
-        internalCounters.push_back(3818);
-
-        p.DefinePublicCounter("PostZSamplesPassing", "#DepthAndStencil#Number of samples tested for Z after shading and passed.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,sum8");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(2077);
-        internalCounters.push_back(2326);
-        internalCounters.push_back(2575);
-        internalCounters.push_back(2824);
-        internalCounters.push_back(3073);
-        internalCounters.push_back(3322);
-        internalCounters.push_back(3571);
-        internalCounters.push_back(3820);
-
-        p.DefinePublicCounter("PostZSamplesFailingS", "#DepthAndStencil#Number of samples tested for Z after shading and failed stencil test.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,sum8");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(2076);
-        internalCounters.push_back(2325);
-        internalCounters.push_back(2574);
-        internalCounters.push_back(2823);
-        internalCounters.push_back(3072);
-        internalCounters.push_back(3321);
-        internalCounters.push_back(3570);
-        internalCounters.push_back(3819);
-
-        p.DefinePublicCounter("PostZSamplesFailingZ", "#DepthAndStencil#Number of samples tested for Z after shading and failed Z test.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,sum8");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(1945);
-        internalCounters.push_back(2194);
-        internalCounters.push_back(2443);
-        internalCounters.push_back(2692);
-        internalCounters.push_back(2941);
-        internalCounters.push_back(3190);
-        internalCounters.push_back(3439);
-        internalCounters.push_back(3688);
-        internalCounters.push_back(3892);
-
-        p.DefinePublicCounter("ZUnitStalled", "#DepthAndStencil#The percentage of GPUTime the depth buffer spends waiting for the color buffer to be ready to accept data. High figures here indicate a bottleneck in color buffer operations.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,/,(100),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(305);
-        internalCounters.push_back(520);
-        internalCounters.push_back(735);
-        internalCounters.push_back(950);
-        internalCounters.push_back(1165);
-        internalCounters.push_back(1380);
-        internalCounters.push_back(1595);
-        internalCounters.push_back(1810);
-
-        p.DefinePublicCounter("CBMemRead", "#ColorBuffer#Number of bytes read from the color buffer.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,sum8,(32),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(295);
-        internalCounters.push_back(510);
-        internalCounters.push_back(725);
-        internalCounters.push_back(940);
-        internalCounters.push_back(1155);
-        internalCounters.push_back(1370);
-        internalCounters.push_back(1585);
-        internalCounters.push_back(1800);
-
-        p.DefinePublicCounter("CBMemWritten", "#ColorBuffer#Number of bytes written to the color buffer.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,sum8,(32),*");
-    }
-    {
-        vector< gpa_uint32 > internalCounters;
-        internalCounters.push_back(339);
-        internalCounters.push_back(554);
-        internalCounters.push_back(769);
-        internalCounters.push_back(984);
-        internalCounters.push_back(1199);
-        internalCounters.push_back(1414);
-        internalCounters.push_back(1629);
-        internalCounters.push_back(1844);
-        internalCounters.push_back(185);
-        internalCounters.push_back(400);
-        internalCounters.push_back(615);
-        internalCounters.push_back(830);
-        internalCounters.push_back(1045);
-        internalCounters.push_back(1260);
-        internalCounters.push_back(1475);
-        internalCounters.push_back(1690);
+    16886,
+    3892, 3890,
+    16466, 16606, 3892,
+    4993, 5182, 5011, 5200, 5029, 5218, 5059, 5248, 5002, 5191, 5017, 5206, 5035, 5224, 3892,
+    16886, 4993, 5182, 5011, 5200, 5029, 5218, 5059, 5248, 5002, 5191, 5017, 5206, 5035, 5224, 3892,
+    5020, 5209, 5026, 5215, 3892,
+    16886, 5020, 5209, 5026, 5215, 3892,
+    4993, 5182, 5011, 5200, 5059, 5248, 5017, 5206, 5035, 5224, 3892,
+    16886, 4993, 5182, 5011, 5200, 5059, 5248, 5017, 5206, 5035, 5224, 3892,
+    5005, 5194, 5008, 5197, 3892,
+    16886, 5005, 5194, 5008, 5197, 3892,
+    5059, 5248, 5066, 5255, 3892,
+    16886, 5059, 5248, 5066, 5255, 3892,
+    5038, 5227, 5043, 5232, 3892,
+    16886, 5038, 5227, 5043, 5232, 3892,
+    16361, 16501, 16342, 16482, 16437, 16577,
+    16446, 16586,
+    16350, 16490,
+    16361, 16501, 16342, 16482,
+    4113, 4249, 4117, 4253, 4069, 4205, 4081, 4217, 4070, 4206, 4082, 4218, 3892,
+    4016, 4152,
+    4022, 4158, 4062, 4198, 4063, 4199, 4064, 4200, 4065, 4201,
+    4029, 4165,
+    4117, 4253, 3892,
+    4876, 4908, 4940, 4972, 4881, 4913, 4945, 4977, 4886, 4918, 4950, 4982, 4891, 4923, 4955, 4987,
+    4878, 4910, 4942, 4974, 4883, 4915, 4947, 4979, 4888, 4920, 4952, 4984, 4893, 4925, 4957, 4989, 3892,
+    5040, 5229,
+    5043, 5232,
+    5040, 5229, 5379, 5778,
+    5384, 5783, 5374, 5773, 5040, 5229,
+    5428, 5827, 5420, 5819, 5040, 5229,
+    5388, 5787, 5374, 5773, 5040, 5229,
+    5386, 5785, 5374, 5773, 5040, 5229,
+    5389, 5788, 5374, 5773, 5040, 5229,
+    5385, 5784, 5374, 5773, 5040, 5229,
+    5420, 5819, 3892, 5040, 5229,
+    5425, 5824, 3892, 5040, 5229,
+    6168, 6274, 6380, 6486, 6592, 6698, 6804, 6910, 7016, 7122, 7228, 7334, 7440, 7546, 7652, 7758, 7864, 7970, 8076, 8182, 8288, 8394, 8500, 8606, 8712, 8818, 8924, 9030, 9136, 9242, 9348, 9454, 3892, 5040, 5229,
+    11131, 11241, 11351, 11461, 11571, 11681, 11791, 11901, 12011, 12121, 12231, 12341, 12451, 12561, 12671, 12781, 12891, 13001, 13111, 13221, 13331, 13441, 13551, 13661, 13771, 13881, 13991, 14101, 14211, 14321, 14431, 14541, 3892, 5040, 5229,
+    14672, 14800, 14928, 15056, 15184, 15312, 15440, 15568, 15696, 15824, 15952, 16080, 5040, 5229,
+    14666, 14794, 14922, 15050, 15178, 15306, 15434, 15562, 15690, 15818, 15946, 16074, 5040, 5229,
+    14658, 14786, 14914, 15042, 15170, 15298, 15426, 15554, 15682, 15810, 15938, 16066, 14659, 14787, 14915, 15043, 15171, 15299, 15427, 15555, 15683, 15811, 15939, 16067, 5040, 5229,
+    14667, 14795, 14923, 15051, 15179, 15307, 15435, 15563, 15691, 15819, 15947, 16075, 3892, 5040, 5229,
+    5391, 5790, 5374, 5773, 5040, 5229,
+    5390, 5789, 5374, 5773, 5040, 5229,
+    5409, 5808, 5374, 5773, 3892, 5040, 5229,
+    5432, 5831, 3892, 5040, 5229,
+    6168, 6274, 6380, 6486, 6592, 6698, 6804, 6910, 7016, 7122, 7228, 7334, 7440, 7546, 7652, 7758, 7864, 7970, 8076, 8182, 8288, 8394, 8500, 8606, 8712, 8818, 8924, 9030, 9136, 9242, 9348, 9454, 3892,
+    6237, 6343, 6449, 6555, 6661, 6767, 6873, 6979, 7085, 7191, 7297, 7403, 7509, 7615, 7721, 7827, 7933, 8039, 8145, 8251, 8357, 8463, 8569, 8675, 8781, 8887, 8993, 9099, 9205, 9311, 9417, 9523, 6236, 6342, 6448, 6554, 6660, 6766, 6872, 6978, 7084, 7190, 7296, 7402, 7508, 7614, 7720, 7826, 7932, 8038, 8144, 8250, 8356, 8462, 8568, 8674, 8780, 8886, 8992, 9098, 9204, 9310, 9416, 9522,
+    6239, 6345, 6451, 6557, 6663, 6769, 6875, 6981, 7087, 7193, 7299, 7405, 7511, 7617, 7723, 7829, 7935, 8041, 8147, 8253, 8359, 8465, 8571, 8677, 8783, 8889, 8995, 9101, 9207, 9313, 9419, 9525, 6238, 6344, 6450, 6556, 6662, 6768, 6874, 6980, 7086, 7192, 7298, 7404, 7510, 7616, 7722, 7828, 7934, 8040, 8146, 8252, 8358, 8464, 8570, 8676, 8782, 8888, 8994, 9100, 9206, 9312, 9418, 9524,
+    6257, 6363, 6469, 6575, 6681, 6787, 6893, 6999, 7105, 7211, 7317, 7423, 7529, 7635, 7741, 7847, 7953, 8059, 8165, 8271, 8377, 8483, 8589, 8695, 8801, 8907, 9013, 9119, 9225, 9331, 9437, 9543, 6258, 6364, 6470, 6576, 6682, 6788, 6894, 7000, 7106, 7212, 7318, 7424, 7530, 7636, 7742, 7848, 7954, 8060, 8166, 8272, 8378, 8484, 8590, 8696, 8802, 8908, 9014, 9120, 9226, 9332, 9438, 9544, 6259, 6365, 6471, 6577, 6683, 6789, 6895, 7001, 7107, 7213, 7319, 7425, 7531, 7637, 7743, 7849, 7955, 8061, 8167, 8273, 8379, 8485, 8591, 8697, 8803, 8909, 9015, 9121, 9227, 9333, 9439, 9545, 6260, 6366, 6472, 6578, 6684, 6790, 6896, 7002, 7108, 7214, 7320, 7426, 7532, 7638, 7744, 7850, 7956, 8062, 8168, 8274, 8380, 8486, 8592, 8698, 8804, 8910, 9016, 9122, 9228, 9334, 9440, 9546, 6261, 6367, 6473, 6579, 6685, 6791, 6897, 7003, 7109, 7215, 7321, 7427, 7533, 7639, 7745, 7851, 7957, 8063, 8169, 8275, 8381, 8487, 8593, 8699, 8805, 8911, 9017, 9123, 9229, 9335, 9441, 9547, 6262, 6368, 6474, 6580, 6686, 6792, 6898, 7004, 7110, 7216, 7322, 7428, 7534, 7640, 7746, 7852, 7958, 8064, 8170, 8276, 8382, 8488, 8594, 8700, 8806, 8912, 9018, 9124, 9230, 9336, 9442, 9548, 6263, 6369, 6475, 6581, 6687, 6793, 6899, 7005, 7111, 7217, 7323, 7429, 7535, 7641, 7747, 7853, 7959, 8065, 8171, 8277, 8383, 8489, 8595, 8701, 8807, 8913, 9019, 9125, 9231, 9337, 9443, 9549, 6264, 6370, 6476, 6582, 6688, 6794, 6900, 7006, 7112, 7218, 7324, 7430, 7536, 7642, 7748, 7854, 7960, 8066, 8172, 8278, 8384, 8490, 8596, 8702, 8808, 8914, 9020, 9126, 9232, 9338, 9444, 9550, 6265, 6371, 6477, 6583, 6689, 6795, 6901, 7007, 7113, 7219, 7325, 7431, 7537, 7643, 7749, 7855, 7961, 8067, 8173, 8279, 8385, 8491, 8597, 8703, 8809, 8915, 9021, 9127, 9233, 9339, 9445, 9551,
+    2043, 2292, 2541, 2790, 3039, 3288, 3537, 3786, 3892,
+    1913, 2162, 2411, 2660, 2909, 3158, 3407, 3656, 1902, 2151, 2400, 2649, 2898, 3147, 3396, 3645,
+    1902, 2151, 2400, 2649, 2898, 3147, 3396, 3645, 1926, 2175, 2424, 2673, 2922, 3171, 3420, 3669,
+    4443, 4735, 4444, 4736, 4445, 4737, 4446, 4738, 4519, 4811, 4520, 4812, 4521, 4813, 4522, 4814,
+    4443, 4735, 4444, 4736, 4445, 4737, 4446, 4738, 4543, 4835, 4519, 4811, 4520, 4812, 4521, 4813, 4522, 4814,
+    4543, 4835, 4443, 4735, 4444, 4736, 4445, 4737, 4446, 4738,
+    2078, 2327, 2576, 2825, 3074, 3323, 3572, 3821,
+    2080, 2329, 2578, 2827, 3076, 3325, 3574, 3823,
+    2079, 2328, 2577, 2826, 3075, 3324, 3573, 3822,
+    2075, 2324, 2573, 2822, 3071, 3320, 3569, 3818,
+    2077, 2326, 2575, 2824, 3073, 3322, 3571, 3820,
+    2076, 2325, 2574, 2823, 3072, 3321, 3570, 3819,
+    1945, 2194, 2443, 2692, 2941, 3190, 3439, 3688, 3892,
+    305, 520, 735, 950, 1165, 1380, 1595, 1810,
+    295, 510, 725, 940, 1155, 1370, 1585, 1800,
+    339, 554, 769, 984, 1199, 1414, 1629, 1844, 185, 400, 615, 830, 1045, 1260, 1475, 1690,
+};
+
+/// Public counter definitions for DX11GFX6
+static constexpr GPA_PublicCounterDef s_publicCountersDX11Gfx6[] =
+{
+    { "GPUTime", "#Timing#Time this API call took to execute on the GPU in milliseconds. Does not include time that draw calls are processed in parallel.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_API_DYNAMIC, 0, 1, "0,TS_FREQ,/,(1000),*" },
+    { "GPUBusy", "#Timing#The percentage of time GPU was busy.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 1, 2, "0,1,/,(100),*,(100),min" },
+    { "TessellatorBusy", "#Timing#The percentage of time the tessellation engine is busy.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 3, 3, "0,1,max,2,/,(100),*" },
+    { "VSBusy", "#Timing#The percentage of time the ShaderUnit has vertex shader work to do.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 6, 15, "(0),0,8,ifnotzero,2,10,ifnotzero,4,12,ifnotzero,(0),1,9,ifnotzero,3,11,ifnotzero,5,13,ifnotzero,max,14,/,(100),*,(100),min" },
+    { "VSTime", "#Timing#Time vertex shaders are busy in milliseconds.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_DYNAMIC, 21, 16, "(0),1,9,ifnotzero,3,11,ifnotzero,5,13,ifnotzero,(0),2,10,ifnotzero,4,12,ifnotzero,6,14,ifnotzero,max,15,/,(1),min,0,TS_FREQ,/,(1000),*,*" },
+    { "HSBusy", "#Timing#The percentage of time the ShaderUnit has hull shader work to do.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 37, 5, "(0),0,2,ifnotzero,(0),1,3,ifnotzero,max,4,/,(100),*,(100),min" },
+    { "HSTime", "#Timing#Time hull shaders are busy in milliseconds.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_DYNAMIC, 42, 6, "(0),1,3,ifnotzero,(0),2,4,ifnotzero,max,5,/,(1),min,0,TS_FREQ,/,(1000),*,*" },
+    { "DSBusy", "#Timing#The percentage of time the ShaderUnit has domain shader work to do.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 48, 11, "(0),0,2,6,ifnotzero,8,ifnotzero,(0),1,3,7,ifnotzero,9,ifnotzero,max,10,/,(100),*,(100),min" },
+    { "DSTime", "#Timing#Time domain shaders are busy in milliseconds.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_DYNAMIC, 59, 12, "(0),1,3,7,ifnotzero,9,ifnotzero,(0),2,4,8,ifnotzero,10,ifnotzero,max,11,/,(1),min,0,TS_FREQ,/,(1000),*,*" },
+    { "GSBusy", "#Timing#The percentage of time the ShaderUnit has geometry shader work to do.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 71, 5, "(0),0,2,ifnotzero,(0),1,3,ifnotzero,max,4,/,(100),*,(100),min" },
+    { "GSTime", "#Timing#Time geometry shaders are busy in milliseconds.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_DYNAMIC, 76, 6, "(0),1,3,ifnotzero,(0),2,4,ifnotzero,max,5,/,(1),min,0,TS_FREQ,/,(1000),*,*" },
+    { "PSBusy", "#Timing#The percentage of time the ShaderUnit has pixel shader work to do.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 82, 5, "(0),0,2,ifnotzero,(0),1,3,ifnotzero,max,4,/,(100),*" },
+    { "PSTime", "#Timing#Time pixel shaders are busy in milliseconds.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_DYNAMIC, 87, 6, "(0),1,3,ifnotzero,(0),2,4,ifnotzero,max,5,/,0,TS_FREQ,/,(1000),*,*" },
+    { "CSBusy", "#Timing#The percentage of time the ShaderUnit has compute shader work to do.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 93, 5, "(0),0,2,ifnotzero,(0),1,3,ifnotzero,max,4,/,(100),*,(100),min" },
+    { "CSTime", "#Timing#Time compute shaders are busy in milliseconds.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_MILLISECONDS, GPA_COUNTER_TYPE_DYNAMIC, 98, 6, "(0),1,3,ifnotzero,(0),2,4,ifnotzero,max,5,/,(1),min,0,TS_FREQ,/,(1000),*,*" },
+    { "VSVerticesIn", "#VertexShader#The number of vertices processed by the VS.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 104, 6, "0,1,+,2,3,+,2,3,+,ifnotzero,4,5,+,4,5,+,ifnotzero" },
+    { "HSPatches", "#HullShader#The number of patches processed by the HS.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 110, 2, "0,1,+" },
+    { "DSVerticesIn", "#DomainShader#The number of vertices processed by the DS.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 104, 6, "(0),0,1,+,2,3,+,2,3,+,ifnotzero,4,5,+,ifnotzero" },
+    { "GSPrimsIn", "#GeometryShader#The number of primitives passed into the GS.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 112, 2, "0,1,+" },
+    { "GSVerticesOut", "#GeometryShader#The number of vertices output by the GS.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 114, 4, "(0),0,1,+,2,3,+,ifnotzero" },
+    { "PrimitiveAssemblyBusy", "#Timing#The percentage of GPUTime that primitive assembly (clipping and culling) is busy. High values may be caused by having many small primitives; mid to low values may indicate pixel shader or output buffer bottleneck.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 118, 13, "0,2,-,4,6,+,8,+,10,(2),*,+,SU_CLOCKS_PRIM,*,-,1,3,-,5,7,+,9,+,11,(2),*,+,SU_CLOCKS_PRIM,*,-,max,(0),max,12,/,(100),*,(100),min" },
+    { "PrimitivesIn", "#PrimitiveAssembly#The number of primitives received by the hardware. This includes primitives generated by tessellation.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 131, 2, "0,1,+" },
+    { "CulledPrims", "#PrimitiveAssembly#The number of culled primitives. Typical reasons include scissor, the primitive having zero area, and back or front face culling.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 133, 10, "0,1,+,2,+,3,+,4,+,5,+,6,+,7,+,8,+,9,+" },
+    { "ClippedPrims", "#PrimitiveAssembly#The number of primitives that required one or more clipping operations due to intersecting the view volume or user clip planes.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 143, 2, "0,1,+" },
+    { "PAStalledOnRasterizer", "#PrimitiveAssembly#Percentage of GPUTime that primitive assembly waits for rasterization to be ready to accept data. This roughly indicates for what percentage of time the pipeline is bottlenecked by pixel operations.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 145, 3, "0,1,max,2,/,(100),*" },
+    { "PSPixelsOut", "#PixelShader#Pixels exported from shader to colour buffers. Does not include killed or alpha tested pixels; if there are multiple rendertargets, each rendertarget receives one export, so this will be 2 for 1 pixel written to two RTs.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 148, 16, "0,1,2,3,sum4,4,5,6,7,sum4,8,9,10,11,sum4,12,13,14,15,sum4,sum4" },
+    { "PSExportStalls", "#PixelShader#Pixel shader output stalls. Percentage of GPUBusy. Should be zero for PS or further upstream limited cases; if not zero, indicates a bottleneck in late Z testing or in the colour buffer.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 164, 17, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max,16,/,(100),*" },
+    { "CSThreadGroups", "#ComputeShader#Total number of thread groups.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 181, 2, "0,1,+" },
+    { "CSWavefronts", "#ComputeShader#The total number of wavefronts used for the CS.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 183, 2, "0,1,+" },
+    { "CSThreads", "#ComputeShader#The number of CS threads processed by the hardware.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 185, 4, "(0),2,3,+,0,1,+,ifnotzero" },
+    { "CSVALUInsts", "#ComputeShader#The average number of vector ALU instructions executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 189, 6, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero" },
+    { "CSVALUUtilization", "#ComputeShader#The percentage of active vector ALU threads in a wave. A lower number can mean either more thread divergence in a wave or that the work-group size is not a multiple of 64. Value range: 0% (bad), 100% (ideal - no thread divergence).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 195, 6, "(0),0,1,+,2,3,+,(64),*,/,(100),*,4,5,+,ifnotzero,(100),min" },
+    { "CSSALUInsts", "#ComputeShader#The average number of scalar ALU instructions executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 201, 6, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero" },
+    { "CSVFetchInsts", "#ComputeShader#The average number of vector fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 207, 6, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero" },
+    { "CSSFetchInsts", "#ComputeShader#The average number of scalar fetch instructions from the video memory executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 213, 6, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero" },
+    { "CSVWriteInsts", "#ComputeShader#The average number of vector write instructions to the video memory executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 219, 6, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero" },
+    { "CSVALUBusy", "#ComputeShader#The percentage of GPUTime vector ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 225, 5, "(0),0,1,+,(4),*,NUM_SIMDS,/,2,/,(100),*,3,4,+,ifnotzero" },
+    { "CSSALUBusy", "#ComputeShader#The percentage of GPUTime scalar ALU instructions are processed. Value range: 0% (bad) to 100% (optimal).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 230, 5, "(0),0,1,+,(4),*,NUM_SIMDS,NUM_SHADER_ENGINES,/,/,2,/,(100),*,3,4,+,ifnotzero" },
+    { "CSMemUnitBusy", "#ComputeShader#The percentage of GPUTime the memory unit is active. The result includes the stall time (MemUnitStalled). This is measured with all extra fetches and writes and any cache or memory effects taken into account. Value range: 0% to 100% (fetch-bound).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 235, 35, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,max32,32,/,(100),*,33,34,+,ifnotzero" },
+    { "CSMemUnitStalled", "#ComputeShader#The percentage of GPUTime the memory unit is stalled. Try reducing the number or size of fetches and writes if possible. Value range: 0% (optimal) to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 270, 35, "(0),0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,max32,32,/,(100),*,33,34,+,ifnotzero" },
+    { "CSFetchSize", "#ComputeShader#The total kilobytes fetched from the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, GPA_COUNTER_TYPE_DYNAMIC, 305, 14, "(0),0,1,2,3,4,5,6,7,8,9,10,11,sum12,(32),*,(1024),/,12,13,+,ifnotzero" },
+    { "CSWriteSize", "#ComputeShader#The total kilobytes written to the video memory. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_KILOBYTES, GPA_COUNTER_TYPE_DYNAMIC, 319, 14, "(0),0,1,2,3,4,5,6,7,8,9,10,11,sum12,(32),*,(1024),/,12,13,+,ifnotzero" },
+    { "CSCacheHit", "#ComputeShader#The percentage of fetch, write, atomic, and other instructions that hit the data cache. Value range: 0% (no hit) to 100% (optimal).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 333, 26, "(0),0,1,2,3,4,5,6,7,8,9,10,11,sum12,0,1,2,3,4,5,6,7,8,9,10,11,sum12,12,13,14,15,16,17,18,19,20,21,22,23,sum12,+,/,(100),*,24,25,+,ifnotzero" },
+    { "CSWriteUnitStalled", "#ComputeShader#The percentage of GPUTime the Write unit is stalled. Value range: 0% to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 359, 15, "(0),0,1,max,2,max,3,max,4,max,5,max,7,max,8,max,9,max,10,max,11,max,12,/,(100),*,13,14,+,ifnotzero" },
+    { "CSGDSInsts", "#ComputeShader#The average number of GDS read or GDS write instructions executed per work item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 374, 6, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero" },
+    { "CSLDSInsts", "#ComputeShader#The average number of LDS read/write instructions executed per work-item (affected by flow control).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 380, 6, "(0),0,1,+,2,3,+,/,4,5,+,ifnotzero" },
+    { "CSALUStalledByLDS", "#ComputeShader#The percentage of GPUTime ALU units are stalled by the LDS input queue being full or the output queue being not ready. If there are LDS bank conflicts, reduce them. Otherwise, try reducing the number of LDS accesses if possible. Value range: 0% (optimal) to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 386, 7, "(0),0,1,+,2,3,+,/,4,/,NUM_SHADER_ENGINES,/,(100),*,5,6,+,ifnotzero" },
+    { "CSLDSBankConflict", "#ComputeShader#The percentage of GPUTime LDS is stalled by bank conflicts. Value range: 0% (optimal) to 100% (bad).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 393, 5, "(0),0,1,+,2,/,NUM_SIMDS,/,(100),*,3,4,+,ifnotzero" },
+    { "TexUnitBusy", "#Timing#The percentage of GPUTime the texture unit is active. This is measured with all extra fetches and any cache or memory effects taken into account.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 398, 33, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,max,9,max,10,max,11,max,12,max,13,max,14,max,15,max,16,max,17,max,18,max,19,max,20,max,21,max,22,max,23,max,24,max,25,max,26,max,27,max,28,max,29,max,30,max,31,max,32,/,(100),*" },
+    { "TexTriFilteringPct", "#TextureUnit#Percentage of pixels that received trilinear filtering. Note that not all pixels for which trilinear filtering is enabled will receive it (e.g. if the texture is magnified).", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 431, 64, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum32,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum32,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum32,+,/,(100),*" },
+    { "TexVolFilteringPct", "#TextureUnit#Percentage of pixels that received volume filtering.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 495, 64, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum32,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum32,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum32,+,/,(100),*" },
+    { "TexAveAnisotropy", "#TextureUnit#The average degree of anisotropy applied. A number between 1 and 16. The anisotropic filtering algorithm only applies samples where they are required (e.g. there will be no extra anisotropic samples if the view vector is perpendicular to the surface) so this can be much lower than the requested anisotropy.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 559, 288, "0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum32,(2),32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum32,*,+,(4),64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,sum32,*,+,(6),96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum32,*,+,(8),128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,sum32,*,+,(10),160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,sum32,*,+,(12),192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,sum32,*,+,(14),224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,sum32,*,+,(16),256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,sum32,*,+,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,sum32,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,sum32,+,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,sum32,+,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,sum32,+,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,sum32,+,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,sum32,+,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,221,222,223,sum32,+,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,sum32,+,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,sum32,+,/" },
+    { "DepthStencilTestBusy", "#Timing#Percentage of time GPU spent performing depth and stencil tests relative to GPUBusy.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 847, 9, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,/,(100),*" },
+    { "HiZTilesAccepted", "#DepthAndStencil#Percentage of tiles accepted by HiZ and will be rendered to the depth or color buffers.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 856, 16, "0,1,2,3,4,5,6,7,sum8,8,9,10,11,12,13,14,15,sum8,/,(100),*" },
+    { "PreZTilesDetailCulled", "#DepthAndStencil#Percentage of tiles rejected because the associated prim had no contributing area.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 872, 16, "8,9,10,11,12,13,14,15,sum8,0,1,2,3,4,5,6,7,sum8,/,(100),*" },
+    { "HiZQuadsCulled", "#DepthAndStencil#Percentage of quads that did not have to continue on in the pipeline after HiZ. They may be written directly to the depth buffer, or culled completely. Consistently low values here may suggest that the Z-range is not being fully utilized.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 888, 16, "0,1,2,3,4,5,6,7,sum8,8,9,10,11,12,13,14,15,sum8,-,0,1,2,3,4,5,6,7,sum8,/,(100),*" },
+    { "PreZQuadsCulled", "#DepthAndStencil#Percentage of quads rejected based on the detailZ and earlyZ tests.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 904, 18, "10,11,12,13,14,15,16,17,sum8,8,9,+,-,0,1,2,3,4,5,6,7,sum8,/,(100),*" },
+    { "PostZQuads", "#DepthAndStencil#Percentage of quads for which the pixel shader will run and may be postZ tested.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 922, 10, "0,1,+,2,3,4,5,6,7,8,9,sum8,/,(100),*" },
+    { "PreZSamplesPassing", "#DepthAndStencil#Number of samples tested for Z before shading and passed.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 932, 8, "0,1,2,3,4,5,6,7,sum8" },
+    { "PreZSamplesFailingS", "#DepthAndStencil#Number of samples tested for Z before shading and failed stencil test.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 940, 8, "0,1,2,3,4,5,6,7,sum8" },
+    { "PreZSamplesFailingZ", "#DepthAndStencil#Number of samples tested for Z before shading and failed Z test.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 948, 8, "0,1,2,3,4,5,6,7,sum8" },
+    { "PostZSamplesPassing", "#DepthAndStencil#Number of samples tested for Z after shading and passed.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 956, 8, "0,1,2,3,4,5,6,7,sum8" },
+    { "PostZSamplesFailingS", "#DepthAndStencil#Number of samples tested for Z after shading and failed stencil test.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 964, 8, "0,1,2,3,4,5,6,7,sum8" },
+    { "PostZSamplesFailingZ", "#DepthAndStencil#Number of samples tested for Z after shading and failed Z test.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_ITEMS, GPA_COUNTER_TYPE_DYNAMIC, 972, 8, "0,1,2,3,4,5,6,7,sum8" },
+    { "ZUnitStalled", "#DepthAndStencil#The percentage of GPUTime the depth buffer spends waiting for the color buffer to be ready to accept data. High figures here indicate a bottleneck in color buffer operations.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 980, 9, "0,1,max,2,max,3,max,4,max,5,max,6,max,7,max,8,/,(100),*" },
+    { "CBMemRead", "#ColorBuffer#Number of bytes read from the color buffer.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, GPA_COUNTER_TYPE_DYNAMIC, 989, 8, "0,1,2,3,4,5,6,7,sum8,(32),*" },
+    { "CBMemWritten", "#ColorBuffer#Number of bytes written to the color buffer.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_BYTES, GPA_COUNTER_TYPE_DYNAMIC, 997, 8, "0,1,2,3,4,5,6,7,sum8,(32),*" },
+    { "CBSlowPixelPct", "#ColorBuffer#Percentage of pixels written to the color buffer using a half-rate or quarter-rate format.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, 1005, 16, "0,1,2,3,4,5,6,7,sum8,8,9,10,11,12,13,14,15,sum8,/,(100),*,(100),min" },
+};
 
-        p.DefinePublicCounter("CBSlowPixelPct", "#ColorBuffer#Percentage of pixels written to the color buffer using a half-rate or quarter-rate format.", GPA_TYPE_FLOAT64, GPA_USAGE_TYPE_PERCENTAGE, GPA_COUNTER_TYPE_DYNAMIC, internalCounters, "0,1,2,3,4,5,6,7,sum8,8,9,10,11,12,13,14,15,sum8,/,(100),*,(100),min");
-    }
+void AutoDefinePublicCountersDX11Gfx6(GPA_PublicCounters& p)
+{
+    p.DefinePublicCounters(s_publicCountersDX11Gfx6, sizeof(s_publicCountersDX11Gfx6) / sizeof(s_publicCountersDX11Gfx6[0]), s_internalCountersDX11Gfx6);
 }
 
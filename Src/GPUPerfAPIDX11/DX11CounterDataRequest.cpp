@@ -77,47 +77,40 @@ bool DX11CounterDataRequest::BeginRequest(GPA_ContextState* pContextState, gpa_u
 {
     TRACE_PRIVATE_FUNCTION(DX11CounterDataRequest::Begin);
 
-    // Get the HW and SW counters
-    GPA_HardwareCounters* pHwCounters = pContextState->m_pCounterAccessor->GetHardwareCounters();
-    GPA_SoftwareCounters* pSwCounters = pContextState->m_pCounterAccessor->GetSoftwareCounters();
-
-    // If this request contains software counters, make a software counter data request, otherwise make a hardware data request depending on the API to use
-    // NOTE: This assumes that hardware and software counters will not be scheduled in the same pass.
-    GPACounterGroupAccessor accessor(pHwCounters->m_pGroups,
-                                     pHwCounters->m_groupCount,
-                                     pHwCounters->m_pAdditionalGroups,
-                                     pHwCounters->m_additionalGroupCount,
-                                     pSwCounters->m_pGroups,
-                                     pSwCounters->m_groupCount);
-
-    // Use the counter type of the first scheduled counter to determine which data request type to create.
-    accessor.SetCounterIndex((*pCounters)[0]);
-
-    if (accessor.IsSWCounter())
+    // A request which is reused for the same pass already has the data request of the right type
+    if (nullptr == m_pCounterDataRequest)
     {
-        GDT_HW_GENERATION gen = GDT_HW_GENERATION_NONE;
+        // If this request contains software counters, make a software counter data request, otherwise make a hardware data request depending on the API to use
+        // NOTE: This assumes that hardware and software counters will not be scheduled in the same pass.
+        // Use the counter type of the first scheduled counter to determine which data request type to create.
+        const GPACounterGroupLocation counterLocation = pContextState->m_pCounterAccessor->GetCounterGroupAccessor()->GetCounterLocation((*pCounters)[0]);
 
-        if (getCurrentContext()->m_hwInfo.GetHWGeneration(gen) == true)
+        if (counterLocation.m_isSW)
         {
-            m_pCounterDataRequest = DX11SoftwareCounterDataRequestManager::Instance()->GetCounterDataRequest(gen, this);
+            GDT_HW_GENERATION gen = GDT_HW_GENERATION_NONE;
+
+            if (getCurrentContext()->m_hwInfo.GetHWGeneration(gen) == true)
+            {
+                m_pCounterDataRequest = DX11SoftwareCounterDataRequestManager::Instance()->GetCounterDataRequest(gen, this);
+            }
+
+            if (nullptr == m_pCounterDataRequest)
+            {
+                // Create a SW counter
+                m_pCounterDataRequest = new(std::nothrow) D3D11SoftwareCounterDataRequest(this);
+            }
         }
-
-        if (nullptr == m_pCounterDataRequest)
+        else if (counterLocation.m_isHW)
         {
-            // Create a SW counter
-            m_pCounterDataRequest = new(std::nothrow) D3D11SoftwareCounterDataRequest(this);
+            DX11_PerfExperimentDataRequestHandler* pPtr = new(std::nothrow) DX11_PerfExperimentDataRequestHandler(this);
+            pPtr->Initialize(getCurrentContext()->m_pContext);
+            m_pCounterDataRequest = pPtr;
+        }
+        else
+        {
+            GPA_LogError("Could not determine whether index is for a hardware or software counter.");
+            return false;
         }
-    }
-    else if (accessor.IsHWCounter())
-    {
-        DX11_PerfExperimentDataRequestHandler* pPtr = new(std::nothrow) DX11_PerfExperimentDataRequestHandler(this);
-        pPtr->Initialize(getCurrentContext()->m_pContext);
-        m_pCounterDataRequest = pPtr;
-    }
-    else
-    {
-        GPA_LogError("Could not determine whether index is for a hardware or software counter.");
-        return false;
     }
 
     assert(nullptr != m_pCounterDataRequest);
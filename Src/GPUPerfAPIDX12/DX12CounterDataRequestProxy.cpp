@@ -44,18 +44,14 @@ bool DX12CounterDataRequestProxy::BeginRequest(
     const vector<gpa_uint32>* pCounters)
 {
     bool result = true;
-    GPA_HardwareCounters* pHwCounters = pContextState->m_pCounterAccessor->GetHardwareCounters();
-    GPA_SoftwareCounters* pSwCounters = pContextState->m_pCounterAccessor->GetSoftwareCounters();
-    GPACounterGroupAccessor counterAccessor(
-        pHwCounters->m_pGroups,
-        pHwCounters->m_groupCount,
-        pHwCounters->m_pAdditionalGroups,
-        pHwCounters->m_additionalGroupCount,
-        pSwCounters->m_pGroups,
-        pSwCounters->m_groupCount);
-    counterAccessor.SetCounterIndex((*pCounters)[0]); // First counter sets which request to create
-
-    if (counterAccessor.IsSWCounter())
+    const GPACounterGroupLocation counterLocation =
+        pContextState->m_pCounterAccessor->GetCounterGroupAccessor()->GetCounterLocation((*pCounters)[0]); // First counter sets which request to create
+
+    // software counter requests can only be begun once, so a reused proxy needs a new one
+    delete m_pDataRequest;
+    m_pDataRequest = nullptr;
+
+    if (counterLocation.m_isSW)
     {
         m_pDataRequest = new(std::nothrow) DX12SoftwareCounterDataRequest;
     }
@@ -24,6 +24,13 @@ public:
     {
     };
 
+    /// HSA calls can be made from any thread, so the results can be collected in the background.
+    /// \return true
+    virtual bool SupportsBackgroundResultCollection() const
+    {
+        return true;
+    }
+
     /// Pointer to HSA agent handle
     const hsa_agent_t* m_pDevice;
 
@@ -355,11 +355,9 @@ GPA_Status GPA_IMP_Destroy()
 
 /// Pre-dispatch callback function
 /// \param pRTParam the pre-dispatch callback params
-/// \param pUserArgs the user arguments
+/// \param pUserArgs the context which profiles the queue
 void HSA_PreDispatchCallback(const hsa_dispatch_callback_t* pRTParam, void* pUserArgs)
 {
-    UNREFERENCED_PARAMETER(pUserArgs);
-
     assert(nullptr != pRTParam && true == pRTParam->pre_dispatch);
 
     HSAToolsRTModule* pHsaToolsRTModule = HSAToolsRTModuleLoader::Instance()->GetAPIRTModule();
@@ -370,7 +368,8 @@ void HSA_PreDispatchCallback(const hsa_dispatch_callback_t* pRTParam, void* pUse
     }
     else
     {
-        GPA_ContextStateHSA* pContextState = getCurrentContext();
+        // the dispatching thread may have a different current context, or none at all
+        GPA_ContextStateHSA* pContextState = static_cast<GPA_ContextStateHSA*>(pUserArgs);
 
         if (nullptr != pContextState)
         {
@@ -379,7 +378,7 @@ void HSA_PreDispatchCallback(const hsa_dispatch_callback_t* pRTParam, void* pUse
             if (pContextState->m_currentPass > 0)
             {
                 // issue request for counter data
-                GPA_DataRequest* pRequest = pContextState->GetDataRequest(g_pCurrentContext->m_currentPass - 1);
+                GPA_DataRequest* pRequest = pContextState->GetDataRequest(pContextState->m_currentPass - 1);
 
                 if (nullptr != pRequest)
                 {
@@ -390,11 +389,12 @@ void HSA_PreDispatchCallback(const hsa_dispatch_callback_t* pRTParam, void* pUse
                     if (!requestOk)
                     {
                         GPA_LogError("Failed to begin request.");
+                        delete pRequest;
                         return;
                     }
 
                     // add new request to current session requests list
-                    g_pCurrentContext->m_pCurrentSessionRequests->Begin(pContextState->m_currentPass - 1, HSAGlobalFlags::Instance()->m_sampleID, pRequest);
+                    pContextState->m_pCurrentSessionRequests->Begin(pContextState->m_currentPass - 1, HSAGlobalFlags::Instance()->m_sampleID, pRequest);
                 }
                 else
                 {
@@ -407,17 +407,24 @@ void HSA_PreDispatchCallback(const hsa_dispatch_callback_t* pRTParam, void* pUse
 
 /// Post-dispatch callback function
 /// \param pRTParam the post-dispatch callback params
-/// \param pUserArgs the user arguments
+/// \param pUserArgs the context which profiles the queue
 void HSA_PostDispatchCallback(const hsa_dispatch_callback_t* pRTParam, void* pUserArgs)
 {
     UNREFERENCED_PARAMETER(pRTParam);
-    UNREFERENCED_PARAMETER(pUserArgs);
 
     assert(nullptr != pRTParam && false == pRTParam->pre_dispatch);
 
-    if (g_pCurrentContext->m_currentPass > 0)
+    GPA_ContextStateHSA* pContextState = static_cast<GPA_ContextStateHSA*>(pUserArgs);
+
+    if (nullptr == pContextState)
+    {
+        GPA_LogError("The dispatch callback was called without a context.");
+        return;
+    }
+
+    if (pContextState->m_currentPass > 0)
     {
-        bool endedOk = g_pCurrentContext->m_pCurrentSessionRequests->End(g_pCurrentContext->m_currentPass - 1, g_pCurrentContext->m_currentSample);
+        bool endedOk = pContextState->m_pCurrentSessionRequests->End(pContextState->m_currentPass - 1, pContextState->m_currentSample);
 
         if (!endedOk)
         {
@@ -491,6 +498,15 @@ GPA_Status GPA_IMP_OpenContext(void* pContext)
             GPA_LogError("Unable to set dispatch callback functions");
             return GPA_STATUS_ERROR_FAILED;
         }
+
+        // the callbacks receive the context, they run on whichever thread dispatches to the queue
+        status = pHsaToolsRTModule->ext_tools_set_callback_arguments(const_cast<hsa_queue_t*>(pHSAContext->m_pQueue), pContextState, pContextState);
+
+        if (HSA_STATUS_SUCCESS != status)
+        {
+            GPA_LogError("Unable to set dispatch callback arguments");
+            return GPA_STATUS_ERROR_FAILED;
+        }
     }
 
     pContextState->m_pDevice = pHSAContext->m_pAgent;
@@ -565,6 +581,14 @@ GPA_Status GPA_IMP_CloseContext()
             GPA_LogError("Unable to set dispatch callback functions");
             return GPA_STATUS_ERROR_FAILED;
         }
+
+        status = HSAToolsRTModuleLoader::Instance()->GetAPIRTModule()->ext_tools_set_callback_arguments(const_cast<hsa_queue_t*>(pContextState->m_pQueue), nullptr, nullptr);
+
+        if (HSA_STATUS_SUCCESS != status)
+        {
+            GPA_LogError("Unable to set dispatch callback arguments");
+            return GPA_STATUS_ERROR_FAILED;
+        }
     }
 
     return GPA_STATUS_OK;
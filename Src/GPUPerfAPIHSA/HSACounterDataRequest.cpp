@@ -135,6 +135,32 @@ bool HSACounterDataRequest::CollectResults(GPA_CounterResults& resultStorage)
 } // HSACounterDataRequest::CollectResults
 
 
+bool HSACounterDataRequest::WaitForResults(gpa_uint32 timeoutMilliseconds)
+{
+    TRACE_PRIVATE_FUNCTION(HSACounterDataRequest::WaitForResults);
+
+    HSAToolsRTModule* pHsaToolsRTModule = HSAToolsRTModuleLoader::Instance()->GetAPIRTModule();
+
+    if (nullptr == pHsaToolsRTModule)
+    {
+        return false;
+    }
+
+    hsa_ext_tools_pmu_state_t state;
+
+    if (HSA_STATUS_SUCCESS != pHsaToolsRTModule->ext_tools_get_pmu_state(m_pmu, &state) || HSA_EXT_TOOLS_PMU_STATE_STOP != state)
+    {
+        // only a stopped perf monitor can be waited on
+        return false;
+    }
+
+    // a time out is fine here, the caller will just poll the request again
+    pHsaToolsRTModule->ext_tools_pmu_wait_for_completion(m_pmu, timeoutMilliseconds);
+
+    return true;
+} // HSACounterDataRequest::WaitForResults
+
+
 void HSACounterDataRequest::Reset(
     gpa_uint32 selectionID,
     const vector<gpa_uint32>* pCounters)
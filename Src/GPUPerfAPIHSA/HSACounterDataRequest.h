@@ -64,6 +64,11 @@ public:
     /// \param pCounters The set of counters to enable in place of the existing ones
     void Reset(gpa_uint32 selectionID, const vector<gpa_uint32>* pCounters);
 
+    /// Blocks on the perf monitor until its results are available
+    /// \param timeoutMilliseconds the maximum time to wait
+    /// \return true if the wait was performed, false if the perf monitor is not stopped
+    virtual bool WaitForResults(gpa_uint32 timeoutMilliseconds);
+
 protected:
 
     virtual bool BeginRequest(
@@ -0,0 +1,143 @@
+//==============================================================================
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit Tests for opening, selecting and closing contexts, on the backend in MockBackend.cpp
+//==============================================================================
+
+#include <gtest/gtest.h>
+#include "GPUPerfAPI.h"
+#include "MockBackend.h"
+
+/// Profiles samples in one pass for the enabled counters of the current context
+/// \param[out] pSessionID the ID of the session of the samples
+/// \param sampleCount the number of samples to profile
+static void ProfileSamples(gpa_uint32* pSessionID, gpa_uint32 sampleCount)
+{
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(pSessionID));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginPass());
+
+    for (gpa_uint32 sampleID = 0; sampleID < sampleCount; sampleID++)
+    {
+        ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSample(sampleID));
+        ASSERT_EQ(GPA_STATUS_OK, GPA_EndSample());
+    }
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EndPass());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EndSession());
+}
+
+// Each open context has its own enabled counters and passes
+TEST(ContextTests, TwoContextsWithDifferentCounterSelections)
+{
+    int firstContext = 0;
+    int secondContext = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&firstContext));
+
+    gpa_uint32 wavefrontsIndex = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetCounterIndex("Wavefronts", &wavefrontsIndex));
+    gpa_uint32 valuInstsIndex = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetCounterIndex("VALUInsts", &valuInstsIndex));
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounter(wavefrontsIndex));
+
+    gpa_uint32 firstSessionID = 0;
+    ProfileSamples(&firstSessionID, 1);
+
+    // opening the second context makes it the current context
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&secondContext));
+    EXPECT_EQ(GPA_STATUS_ERROR_COUNTERS_ALREADY_OPEN, GPA_OpenContext(&firstContext));
+
+    gpa_uint32 enabledCount = 0;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetEnabledCount(&enabledCount));
+    EXPECT_EQ(0u, enabledCount);
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounter(valuInstsIndex));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsCounterEnabled(valuInstsIndex));
+    EXPECT_NE(GPA_STATUS_OK, GPA_IsCounterEnabled(wavefrontsIndex));
+
+    gpa_uint32 secondSessionID = 0;
+    ProfileSamples(&secondSessionID, 1);
+
+    gpa_uint64 result = 0;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetSampleResults(secondSessionID, 0, &result, sizeof(result)));
+
+    // the counter selection of the first context is unchanged by the second one
+    ASSERT_EQ(GPA_STATUS_OK, GPA_SelectContext(&firstContext));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetEnabledCount(&enabledCount));
+    EXPECT_EQ(1u, enabledCount);
+
+    gpa_uint32 enabledIndex = 0;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetEnabledIndex(0, &enabledIndex));
+    EXPECT_EQ(wavefrontsIndex, enabledIndex);
+    EXPECT_NE(GPA_STATUS_OK, GPA_IsCounterEnabled(valuInstsIndex));
+
+    gpa_uint32 passCount = 0;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetPassCount(&passCount));
+    EXPECT_EQ(1u, passCount);
+
+    gpa_uint32 sampleCount = 0;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetSampleCount(firstSessionID, &sampleCount));
+    EXPECT_EQ(1u, sampleCount);
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetSampleResults(firstSessionID, 0, &result, sizeof(result)));
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+
+    // closing the first context does not disable the counters of the second one
+    ASSERT_EQ(GPA_STATUS_OK, GPA_SelectContext(&secondContext));
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetEnabledCount(&enabledCount));
+    EXPECT_EQ(1u, enabledCount);
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsCounterEnabled(valuInstsIndex));
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
+
+// The data requests of a counter selection are pooled for the next session, and are not reused once other counters are enabled
+TEST(ContextTests, DataRequestPoolDiscardedWhenCountersChange)
+{
+    static const gpa_uint32 sampleCount = 4;
+
+    int context = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&context));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterStr("Wavefronts"));
+
+    gpa_uint32 sessionID = 0;
+    bool isReady = false;
+
+    // the results of the session are collected, which returns its requests to the pool
+    ProfileSamples(&sessionID, sampleCount);
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSessionReady(&isReady, sessionID));
+    EXPECT_TRUE(isReady);
+
+    // the same counters reuse the pooled requests
+    gpa_uint32 numCreated = GetNumMockDataRequestsCreated();
+    ProfileSamples(&sessionID, sampleCount);
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSessionReady(&isReady, sessionID));
+    EXPECT_TRUE(isReady);
+    EXPECT_EQ(numCreated, GetNumMockDataRequestsCreated());
+
+    // swapping one counter for another keeps the number of passes and of counters in each pass, so only the selection ID tells the pooled requests apart
+    ASSERT_EQ(GPA_STATUS_OK, GPA_DisableCounterStr("Wavefronts"));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterStr("VALUInsts"));
+
+    gpa_uint32 passCount = 0;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetPassCount(&passCount));
+    EXPECT_EQ(1u, passCount);
+
+    gpa_uint32 numDeleted = GetNumMockDataRequestsDeleted();
+    gpa_uint32 numStale = GetNumStaleMockDataRequests();
+    ProfileSamples(&sessionID, sampleCount);
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSessionReady(&isReady, sessionID));
+    EXPECT_TRUE(isReady);
+    EXPECT_LT(numDeleted, GetNumMockDataRequestsDeleted());
+    EXPECT_EQ(numStale, GetNumStaleMockDataRequests());
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
@@ -178,3 +178,10 @@ TEST(CounterDLLTests, OpenCLMultipleGenerations)
     BOOL freed = FreeLibrary(hDll);
     EXPECT_EQ(TRUE, freed);
 }
+
+// Test that the hardware counters are generated on demand
+TEST(CounterDLLTests, OpenCLHardwareCountersOnDemand)
+{
+    VerifyHardwareCountersOnDemand(GPA_API_OPENCL, gDevIdCI);
+    VerifyHardwareCountersOnDemand(GPA_API_OPENCL, gDevIdVI);
+}
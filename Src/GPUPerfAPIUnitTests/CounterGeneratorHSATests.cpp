@@ -92,3 +92,10 @@ TEST(CounterDLLTests, HSACounterNamesByGeneration)
     GetExpectedCountersForGeneration(GPA_HW_GENERATION_VOLCANICISLAND, counterNames);
     VerifyCounterNames(GPA_API_HSA, GPA_HW_GENERATION_VOLCANICISLAND, counterNames);
 }
+
+// Test that the hardware counters are generated on demand
+TEST(CounterDLLTests, HSAHardwareCountersOnDemand)
+{
+    VerifyHardwareCountersOnDemand(GPA_API_HSA, gDevIdCI);
+    VerifyHardwareCountersOnDemand(GPA_API_HSA, gDevIdVI);
+}
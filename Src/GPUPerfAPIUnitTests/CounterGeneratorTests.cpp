@@ -9,6 +9,39 @@
 #include "GPAHWInfo.h"
 #include "GPAContextState.h"
 #include <map>
+#include <string>
+
+GPA_Status GetAvailableCountersFromDll(GPA_API_Type api, unsigned int deviceId, GPA_ICounterAccessor** ppCounterAccessor, GPA_ICounterScheduler** ppCounterScheduler)
+{
+    *ppCounterAccessor = nullptr;
+    *ppCounterScheduler = nullptr;
+
+    HMODULE hDll = LoadLibraryA("GPUPerfAPICounters" AMDT_PROJECT_SUFFIX ".dll");
+    EXPECT_NE((HMODULE)nullptr, hDll);
+
+    if (nullptr == hDll)
+    {
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    GPA_GetAvailableCountersProc GPA_GetAvailableCounters_fn = (GPA_GetAvailableCountersProc)GetProcAddress(hDll, "GPA_GetAvailableCounters");
+    EXPECT_NE((GPA_GetAvailableCountersProc)nullptr, GPA_GetAvailableCounters_fn);
+
+    if (nullptr == GPA_GetAvailableCounters_fn)
+    {
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    GPA_Status status = GPA_GetAvailableCounters_fn(api, AMD_VENDOR_ID, deviceId, 0, ppCounterAccessor, ppCounterScheduler);
+
+    if (GPA_STATUS_OK == status)
+    {
+        EXPECT_NE((GPA_ICounterAccessor*)nullptr, *ppCounterAccessor);
+        EXPECT_NE((GPA_ICounterScheduler*)nullptr, *ppCounterScheduler);
+    }
+
+    return status;
+}
 
 void VerifyNotImplemented(GPA_API_Type api, unsigned int deviceId)
 {
@@ -78,6 +111,39 @@ void VerifyHardwareNotSupported(GPA_API_Type api, GPA_HW_GENERATION generation)
     EXPECT_EQ(TRUE, freed);
 }
 
+/// Checks that every counter name, in its own case and in lower case, is found at its own index
+/// (or at the index of an earlier counter with the same name), and that an unknown name is not found.
+/// \param pCounterAccessor the accessor of the counters
+void VerifyCounterIndices(GPA_ICounterAccessor* pCounterAccessor)
+{
+    gpa_uint32 numCounters = pCounterAccessor->GetNumCounters();
+
+    for (gpa_uint32 i = 0; i < numCounters; ++i)
+    {
+        const char* pCounterName = pCounterAccessor->GetCounterName(i);
+
+        gpa_uint32 index = numCounters;
+        EXPECT_TRUE(pCounterAccessor->GetCounterIndex(pCounterName, &index));
+        EXPECT_LE(index, i);
+        EXPECT_EQ(0, _strcmpi(pCounterName, pCounterAccessor->GetCounterName(index)));
+
+        std::string lowerCaseName(pCounterName);
+
+        for (std::string::iterator it = lowerCaseName.begin(); it != lowerCaseName.end(); ++it)
+        {
+            *it = static_cast<char>(tolower(*it));
+        }
+
+        gpa_uint32 lowerCaseIndex = numCounters;
+        EXPECT_TRUE(pCounterAccessor->GetCounterIndex(lowerCaseName.c_str(), &lowerCaseIndex));
+        EXPECT_EQ(index, lowerCaseIndex);
+    }
+
+    gpa_uint32 index = numCounters;
+    EXPECT_FALSE(pCounterAccessor->GetCounterIndex("NotACounterName", &index));
+    EXPECT_EQ(numCounters, index);
+}
+
 void VerifyCounterNames(GPA_API_Type api, unsigned int deviceId, std::vector<const char*> expectedNames)
 {
     HMODULE hDll = LoadLibraryA("GPUPerfAPICounters" AMDT_PROJECT_SUFFIX ".dll");
@@ -139,6 +205,8 @@ void VerifyCounterNames(GPA_API_Type api, unsigned int deviceId, std::vector<con
 
 #endif // AMDT_INTERNAL
 
+    VerifyCounterIndices(pCounterAccessor);
+
     BOOL freed = FreeLibrary(hDll);
     EXPECT_EQ(TRUE, freed);
 }
@@ -202,6 +270,8 @@ void VerifyCounterNames(GPA_API_Type api, GPA_HW_GENERATION generation, std::vec
 
 #endif // AMDT_INTERNAL
 
+    VerifyCounterIndices(pCounterAccessor);
+
     BOOL freed = FreeLibrary(hDll);
     EXPECT_EQ(TRUE, freed);
 }
@@ -369,6 +439,7 @@ void VerifyCounterCalculation(GPA_API_Type api, unsigned int deviceId, char* cou
         }
     }
 
+    pCounterAccessor->ExpandPublicCounters();
     pCounterAccessor->ComputePublicCounterValue(counterIndex, sampleResults, internalCounterTypes, &result, &hwInfo);
 
     ASSERT_EQ(expectedResult, result);
@@ -376,3 +447,25 @@ void VerifyCounterCalculation(GPA_API_Type api, unsigned int deviceId, char* cou
     // disable the counters
     pCounterScheduler->DisableAllCounters();
 }
+
+void VerifyHardwareCountersOnDemand(GPA_API_Type api, unsigned int deviceId)
+{
+    GPA_ICounterAccessor* pCounterAccessor = nullptr;
+    GPA_ICounterScheduler* pCounterScheduler = nullptr;
+    ASSERT_EQ(GPA_STATUS_OK, GetAvailableCountersFromDll(api, deviceId, &pCounterAccessor, &pCounterScheduler));
+
+    gpa_uint32 numPublicCounters = pCounterAccessor->GetNumPublicCounters();
+
+    for (gpa_uint32 i = 0; i < numPublicCounters; i++)
+    {
+        std::vector<gpa_uint32> requiredCounters = pCounterAccessor->GetInternalCountersRequired(i);
+
+        for (std::vector<gpa_uint32>::const_iterator it = requiredCounters.begin(); it != requiredCounters.end(); ++it)
+        {
+            GPA_HardwareCounterDescExt* pCounter = pCounterAccessor->GetHardwareCounterExt(*it);
+            ASSERT_NE((GPA_HardwareCounterDescExt*)nullptr, pCounter);
+            ASSERT_NE((GPA_HardwareCounterDesc*)nullptr, pCounter->m_pHardwareCounter);
+            EXPECT_EQ(pCounter, pCounterAccessor->GetHardwareCounterExt(*it));
+        }
+    }
+}
@@ -21,6 +21,14 @@ static const unsigned int gDevIdSI = 0x6798;
 static const unsigned int gDevIdCI = 0x6650;
 static const unsigned int gDevIdVI = 0x6900;
 
+/// Loads the counters DLL and gets the counter accessor and scheduler of a device. The DLL stays loaded so that they can be used.
+/// \param api The API whose counters to get
+/// \param deviceId The hardware whose counters to get
+/// \param[out] ppCounterAccessor The counter accessor
+/// \param[out] ppCounterScheduler The counter scheduler
+/// \return the status returned by GPA_GetAvailableCounters, or GPA_STATUS_ERROR_FAILED if the DLL could not be loaded
+GPA_Status GetAvailableCountersFromDll(GPA_API_Type api, unsigned int deviceId, GPA_ICounterAccessor** ppCounterAccessor, GPA_ICounterScheduler** ppCounterScheduler);
+
 void VerifyNotImplemented(GPA_API_Type api, unsigned int deviceId);
 void VerifyNotImplemented(GPA_API_Type api, GPA_HW_GENERATION generation);
 
@@ -44,3 +52,8 @@ void VerifyCountersInPass(GPA_API_Type api,
                           std::map< unsigned int, std::map<unsigned int, GPA_CounterResultLocation> >& expectedResultLocations);
 
 void VerifyCounterCalculation(GPA_API_Type api, unsigned int deviceId, char* counterName, std::vector<char*>& sampleResults, gpa_float64 expectedResult);
+
+/// Verifies that the hardware counters required by the public counters are generated when they are first accessed, and only once
+/// \param api The API being used in the test
+/// \param deviceId The hardware being used
+void VerifyHardwareCountersOnDemand(GPA_API_Type api, unsigned int deviceId);
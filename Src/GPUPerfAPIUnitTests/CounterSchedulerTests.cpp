@@ -7,6 +7,8 @@
 
 #include "CounterGeneratorTests.h"
 #include "GPASplitCountersInterfaces.h"
+#include <chrono>
+#include <algorithm>
 
 #include "counters/PublicCountersDX11Gfx6.h"
 #include "counters/PublicCountersDX11Gfx7.h"
@@ -769,3 +771,467 @@ TEST(CounterDLLTests, DX11EnableAndDisable)
     EXPECT_EQ(GPA_STATUS_OK, passCountStatus);
     EXPECT_EQ(1, requiredPasses);
 }
+
+TEST(CounterDLLTests, DX11PassPlanCache)
+{
+    GPA_API_Type api = GPA_API_DIRECTX_11;
+    unsigned int deviceId = gDevIdVI;
+
+    GPA_ICounterAccessor* pCounterAccessor = nullptr;
+    GPA_ICounterScheduler* pCounterScheduler = nullptr;
+    ASSERT_EQ(GPA_STATUS_OK, GetAvailableCountersFromDll(api, deviceId, &pCounterAccessor, &pCounterScheduler));
+
+    pCounterScheduler->DisableAllCounters();
+
+    gpa_uint32 initialHits = 0;
+    gpa_uint32 initialMisses = 0;
+    pCounterScheduler->GetPassPlanCacheStatistics(&initialHits, &initialMisses);
+
+    // enable the first selection
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCounter(0));
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCounter(1));
+
+    gpa_uint32 requiredPasses = 0;
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+    EXPECT_EQ(2, requiredPasses);
+
+    CounterResultLocationMap firstLocations = *pCounterScheduler->GetCounterResultLocations(1);
+
+    // switch to a second selection
+    pCounterScheduler->DisableAllCounters();
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCounter(1));
+
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+    EXPECT_EQ(1, requiredPasses);
+
+    gpa_uint32 hits = 0;
+    gpa_uint32 misses = 0;
+    pCounterScheduler->GetPassPlanCacheStatistics(&hits, &misses);
+    EXPECT_EQ(initialHits, hits);
+    EXPECT_EQ(initialMisses + 2, misses);
+
+    // switch back to the first selection, enabled in a different order
+    pCounterScheduler->DisableAllCounters();
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCounter(1));
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCounter(0));
+
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+    EXPECT_EQ(2, requiredPasses);
+
+    pCounterScheduler->GetPassPlanCacheStatistics(&hits, &misses);
+    EXPECT_EQ(initialHits + 1, hits);
+    EXPECT_EQ(initialMisses + 2, misses);
+
+    CounterResultLocationMap* pLocations = pCounterScheduler->GetCounterResultLocations(1);
+    ASSERT_NE((CounterResultLocationMap*)nullptr, pLocations);
+    ASSERT_EQ(firstLocations.size(), pLocations->size());
+
+    for (CounterResultLocationMap::const_iterator it = firstLocations.begin(); it != firstLocations.end(); ++it)
+    {
+        EXPECT_EQ(it->second.m_pass, (*pLocations)[it->first].m_pass);
+        EXPECT_EQ(it->second.m_offset, (*pLocations)[it->first].m_offset);
+    }
+
+    pCounterScheduler->DisableAllCounters();
+}
+
+/// Checks that every hardware counter of the enabled public counters is found at the pass and offset of its result location,
+/// and that the gather plan of each enabled public counter lists those locations in the order of the counter's internal counters.
+/// \param pCounterAccessor the accessor of the counters
+/// \param pCounterScheduler the scheduler whose passes to check
+/// \param numPasses the number of passes required by the enabled counters
+void VerifyResultLocations(GPA_ICounterAccessor* pCounterAccessor, GPA_ICounterScheduler* pCounterScheduler, gpa_uint32 numPasses)
+{
+    gpa_uint32 numEnabledCounters = pCounterScheduler->GetNumEnabledCounters();
+
+    for (gpa_uint32 enabledIndex = 0; enabledIndex < numEnabledCounters; ++enabledIndex)
+    {
+        gpa_uint32 counterIndex = 0;
+        ASSERT_EQ(GPA_STATUS_OK, pCounterScheduler->GetEnabledIndex(enabledIndex, &counterIndex));
+
+        if (PUBLIC_COUNTER != pCounterAccessor->GetCounterTypeInfo(counterIndex).m_counterType)
+        {
+            continue;
+        }
+
+        CounterResultLocationMap* pLocations = pCounterScheduler->GetCounterResultLocations(counterIndex);
+        ASSERT_NE((CounterResultLocationMap*)nullptr, pLocations);
+
+        std::vector<gpa_uint32> requiredCounters = pCounterAccessor->GetInternalCountersRequired(counterIndex);
+
+        const GPA_CounterGatherPlan* pGatherPlan = pCounterScheduler->GetCounterGatherPlan(counterIndex);
+        ASSERT_NE((const GPA_CounterGatherPlan*)nullptr, pGatherPlan);
+        ASSERT_EQ(requiredCounters.size(), pGatherPlan->m_numEntries);
+
+        for (std::vector<gpa_uint32>::const_iterator it = requiredCounters.begin(); it != requiredCounters.end(); ++it)
+        {
+            ASSERT_EQ(1u, pLocations->count(*it));
+
+            GPA_CounterResultLocation location = (*pLocations)[*it];
+            ASSERT_LT(location.m_pass, numPasses);
+
+            std::vector<unsigned int>* pPassCounters = pCounterScheduler->GetCountersForPass(location.m_pass);
+            ASSERT_LT(location.m_offset, pPassCounters->size());
+            EXPECT_EQ(*it, (*pPassCounters)[location.m_offset]);
+
+            const GPA_CounterGatherEntry& entry = pGatherPlan->m_pEntries[it - requiredCounters.begin()];
+            EXPECT_EQ(location.m_pass, entry.m_pass);
+            EXPECT_EQ(location.m_offset, entry.m_offset);
+            EXPECT_EQ(GPA_TYPE_UINT64, entry.m_type);
+        }
+    }
+}
+
+/// Enables every public counter, and checks that the pass-minimizing splitter needs no more passes than the splitting algorithm preferred by the API.
+/// The pass counts of both are recorded as test properties. The minimized pass count is not checked against a fixed value,
+/// since it depends on how far the search gets within its time budget.
+/// \param api the API whose counters to enable
+/// \param deviceId the device whose counters to enable
+/// \param pName the prefix of the names of the recorded properties
+/// \param[out] preferredPasses the number of passes needed by the preferred splitting algorithm
+/// \param[out] minimizedPasses the number of passes needed by the pass-minimizing splitter
+void VerifyMinimizedPassCountForAllCounters(GPA_API_Type api, unsigned int deviceId, const char* pName, gpa_uint32& preferredPasses, gpa_uint32& minimizedPasses)
+{
+    preferredPasses = 0;
+    minimizedPasses = 0;
+
+    GPA_ICounterAccessor* pCounterAccessor = nullptr;
+    GPA_ICounterScheduler* pCounterScheduler = nullptr;
+    ASSERT_EQ(GPA_STATUS_OK, GetAvailableCountersFromDll(api, deviceId, &pCounterAccessor, &pCounterScheduler));
+
+    pCounterScheduler->DisableAllCounters();
+    pCounterScheduler->SetMinimizePasses(false);
+
+    gpa_uint32 numCounters = pCounterAccessor->GetNumPublicCounters();
+
+    for (gpa_uint32 i = 0; i < numCounters; ++i)
+    {
+        EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCounter(i));
+    }
+
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&preferredPasses));
+
+    pCounterScheduler->SetMinimizePasses(true);
+    EXPECT_TRUE(pCounterScheduler->GetCounterSelectionChanged());
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&minimizedPasses));
+    EXPECT_LE(minimizedPasses, preferredPasses);
+
+    VerifyResultLocations(pCounterAccessor, pCounterScheduler, minimizedPasses);
+
+    std::string name(pName);
+    ::testing::Test::RecordProperty(name + "PreferredPasses", preferredPasses);
+    ::testing::Test::RecordProperty(name + "MinimizedPasses", minimizedPasses);
+
+    pCounterScheduler->SetMinimizePasses(false);
+    pCounterScheduler->DisableAllCounters();
+}
+
+TEST(CounterDLLTests, DX11MinimizedPassCount)
+{
+    gpa_uint32 preferredPasses = 0;
+    gpa_uint32 minimizedPasses = 0;
+
+    VerifyMinimizedPassCountForAllCounters(GPA_API_DIRECTX_11, gDevIdSI, "DX11SI", preferredPasses, minimizedPasses);
+    VerifyMinimizedPassCountForAllCounters(GPA_API_DIRECTX_11, gDevIdCI, "DX11CI", preferredPasses, minimizedPasses);
+    VerifyMinimizedPassCountForAllCounters(GPA_API_DIRECTX_11, gDevIdVI, "DX11VI", preferredPasses, minimizedPasses);
+}
+
+TEST(CounterDLLTests, OpenGLMinimizedPassCount)
+{
+    gpa_uint32 preferredPasses = 0;
+    gpa_uint32 minimizedPasses = 0;
+
+    VerifyMinimizedPassCountForAllCounters(GPA_API_OPENGL, gDevIdSI, "OpenGLSI", preferredPasses, minimizedPasses);
+    EXPECT_EQ(9, preferredPasses);
+
+    VerifyMinimizedPassCountForAllCounters(GPA_API_OPENGL, gDevIdCI, "OpenGLCI", preferredPasses, minimizedPasses);
+    VerifyMinimizedPassCountForAllCounters(GPA_API_OPENGL, gDevIdVI, "OpenGLVI", preferredPasses, minimizedPasses);
+}
+
+TEST(CounterDLLTests, OpenCLMinimizedPassCount)
+{
+    gpa_uint32 preferredPasses = 0;
+    gpa_uint32 minimizedPasses = 0;
+
+    VerifyMinimizedPassCountForAllCounters(GPA_API_OPENCL, gDevIdSI, "OpenCLSI", preferredPasses, minimizedPasses);
+    EXPECT_EQ(2, preferredPasses);
+
+    VerifyMinimizedPassCountForAllCounters(GPA_API_OPENCL, gDevIdCI, "OpenCLCI", preferredPasses, minimizedPasses);
+    VerifyMinimizedPassCountForAllCounters(GPA_API_OPENCL, gDevIdVI, "OpenCLVI", preferredPasses, minimizedPasses);
+}
+
+TEST(CounterDLLTests, OpenGLIncrementalPassUpdates)
+{
+    GPA_ICounterAccessor* pCounterAccessor = nullptr;
+    GPA_ICounterScheduler* pCounterScheduler = nullptr;
+    ASSERT_EQ(GPA_STATUS_OK, GetAvailableCountersFromDll(GPA_API_OPENGL, gDevIdSI, &pCounterAccessor, &pCounterScheduler));
+
+    pCounterScheduler->DisableAllCounters();
+    pCounterScheduler->SetMinimizePasses(false);
+
+    gpa_uint32 numCounters = pCounterAccessor->GetNumPublicCounters();
+    const gpa_uint32 numLaterCounters = 4;
+    ASSERT_LT(numLaterCounters, numCounters);
+
+    // the first selection is split in full
+    for (gpa_uint32 i = 0; i < numCounters - numLaterCounters; ++i)
+    {
+        EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCounter(i));
+    }
+
+    gpa_uint32 requiredPasses = 0;
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+    VerifyResultLocations(pCounterAccessor, pCounterScheduler, requiredPasses);
+
+    // the passes are updated for each of the remaining counters
+    for (gpa_uint32 i = numCounters - numLaterCounters; i < numCounters; ++i)
+    {
+        EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCounter(i));
+        EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+        VerifyResultLocations(pCounterAccessor, pCounterScheduler, requiredPasses);
+    }
+
+    // the updated passes depend on the order in which the counters were enabled, so they are not cached:
+    // going back to the first selection finds its passes in the cache, but enabling the remaining counters again does not
+    gpa_uint32 hits = 0;
+    gpa_uint32 misses = 0;
+    pCounterScheduler->GetPassPlanCacheStatistics(&hits, &misses);
+
+    for (gpa_uint32 i = numCounters - numLaterCounters; i < numCounters; ++i)
+    {
+        EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->DisableCounter(i));
+    }
+
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+
+    for (gpa_uint32 i = numCounters - numLaterCounters; i < numCounters; ++i)
+    {
+        EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCounter(i));
+    }
+
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+    VerifyResultLocations(pCounterAccessor, pCounterScheduler, requiredPasses);
+
+    gpa_uint32 updatedHits = 0;
+    gpa_uint32 updatedMisses = 0;
+    pCounterScheduler->GetPassPlanCacheStatistics(&updatedHits, &updatedMisses);
+    EXPECT_EQ(hits + 1, updatedHits);
+    EXPECT_EQ(misses + 1, updatedMisses);
+
+    // a full split gives the same passes as splitting all of the counters at once
+    pCounterScheduler->RequestFullSplit();
+    EXPECT_TRUE(pCounterScheduler->GetCounterSelectionChanged());
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+    EXPECT_EQ(9, requiredPasses);
+    VerifyResultLocations(pCounterAccessor, pCounterScheduler, requiredPasses);
+
+    // disabling counters never needs more passes
+    for (gpa_uint32 i = 0; i < numLaterCounters; ++i)
+    {
+        gpa_uint32 previousPasses = requiredPasses;
+        EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->DisableCounter(i));
+        EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+        EXPECT_LE(requiredPasses, previousPasses);
+        VerifyResultLocations(pCounterAccessor, pCounterScheduler, requiredPasses);
+    }
+
+    pCounterScheduler->DisableAllCounters();
+}
+
+TEST(CounterDLLTests, OpenGLPassCountForCounters)
+{
+    GPA_ICounterAccessor* pCounterAccessor = nullptr;
+    GPA_ICounterScheduler* pCounterScheduler = nullptr;
+    ASSERT_EQ(GPA_STATUS_OK, GetAvailableCountersFromDll(GPA_API_OPENGL, gDevIdSI, &pCounterAccessor, &pCounterScheduler));
+
+    pCounterScheduler->DisableAllCounters();
+    pCounterScheduler->SetMinimizePasses(false);
+
+    gpa_uint32 numCounters = pCounterAccessor->GetNumPublicCounters();
+    const gpa_uint32 numEnabledCounters = 10;
+    ASSERT_LT(numEnabledCounters, numCounters);
+
+    for (gpa_uint32 i = 0; i < numEnabledCounters; ++i)
+    {
+        EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCounter(i));
+    }
+
+    gpa_uint32 enabledPasses = 0;
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&enabledPasses));
+
+    // beginning to profile the passes clears the flag that they changed
+    EXPECT_TRUE(pCounterScheduler->GetCounterSelectionChanged());
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->BeginProfile());
+
+    // the pass count of all of the counters is found without enabling them
+    std::vector<gpa_uint32> allCounters;
+
+    for (gpa_uint32 i = 0; i < numCounters; ++i)
+    {
+        allCounters.push_back(i);
+    }
+
+    gpa_uint32 candidatePasses = 0;
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPassesForCounters(allCounters.data(), numCounters, &candidatePasses));
+    EXPECT_EQ(9, candidatePasses);
+
+    EXPECT_EQ(numEnabledCounters, pCounterScheduler->GetNumEnabledCounters());
+    EXPECT_FALSE(pCounterScheduler->GetCounterSelectionChanged());
+
+    gpa_uint32 requiredPasses = 0;
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+    EXPECT_EQ(enabledPasses, requiredPasses);
+
+    gpa_uint32 invalidCounter = pCounterAccessor->GetNumCounters();
+    EXPECT_EQ(GPA_STATUS_ERROR_INDEX_OUT_OF_RANGE, pCounterScheduler->GetNumRequiredPassesForCounters(&invalidCounter, 1, &candidatePasses));
+
+    // each enabled counter is collected in at least one pass
+    std::vector<gpa_uint8> passes(enabledPasses);
+
+    for (gpa_uint32 i = 0; i < numEnabledCounters; ++i)
+    {
+        EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetCounterPassAffinity(i, passes.data(), enabledPasses));
+        EXPECT_NE(passes.end(), std::find(passes.begin(), passes.end(), 1));
+    }
+
+    EXPECT_EQ(GPA_STATUS_ERROR_BUFFER_TOO_SMALL, pCounterScheduler->GetCounterPassAffinity(0, passes.data(), enabledPasses - 1));
+    EXPECT_EQ(GPA_STATUS_ERROR_NOT_ENABLED, pCounterScheduler->GetCounterPassAffinity(numEnabledCounters, passes.data(), enabledPasses));
+
+    pCounterScheduler->DisableAllCounters();
+}
+
+TEST(CounterDLLTests, OpenGLPassBudget)
+{
+    GPA_ICounterAccessor* pCounterAccessor = nullptr;
+    GPA_ICounterScheduler* pCounterScheduler = nullptr;
+    ASSERT_EQ(GPA_STATUS_OK, GetAvailableCountersFromDll(GPA_API_OPENGL, gDevIdSI, &pCounterAccessor, &pCounterScheduler));
+
+    pCounterScheduler->DisableAllCounters();
+    pCounterScheduler->SetMinimizePasses(false);
+
+    // the public counters are given in reverse order, so that the last counter has the highest priority
+    gpa_uint32 numCounters = pCounterAccessor->GetNumPublicCounters();
+    std::vector<gpa_uint32> prioritizedCounters;
+
+    for (gpa_uint32 i = numCounters; i > 0; --i)
+    {
+        prioritizedCounters.push_back(i - 1);
+    }
+
+    const gpa_uint32 maxPasses = 3;
+    gpa_uint32 numEnabled = 0;
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCountersWithinPassBudget(prioritizedCounters.data(), numCounters, maxPasses, &numEnabled));
+    EXPECT_LT(0u, numEnabled);
+    EXPECT_GT(numCounters, numEnabled);
+    EXPECT_EQ(numEnabled, pCounterScheduler->GetNumEnabledCounters());
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->IsCounterEnabled(numCounters - 1));
+
+    gpa_uint32 requiredPasses = 0;
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+    EXPECT_GE(maxPasses, requiredPasses);
+    VerifyResultLocations(pCounterAccessor, pCounterScheduler, requiredPasses);
+
+    // splitting the enabled counters again gives the same number of passes
+    pCounterScheduler->RequestFullSplit();
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+    EXPECT_GE(maxPasses, requiredPasses);
+
+    // every counter is enabled when the budget is large enough
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCountersWithinPassBudget(prioritizedCounters.data(), numCounters, 100, &numEnabled));
+    EXPECT_EQ(numCounters, numEnabled);
+
+    // the counters are chosen with updated passes, then split with the pass-minimizing splitter
+    pCounterScheduler->SetMinimizePasses(true);
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCountersWithinPassBudget(prioritizedCounters.data(), numCounters, maxPasses, &numEnabled));
+    EXPECT_LT(0u, numEnabled);
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->IsCounterEnabled(numCounters - 1));
+    EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+    EXPECT_GE(maxPasses, requiredPasses);
+    VerifyResultLocations(pCounterAccessor, pCounterScheduler, requiredPasses);
+    pCounterScheduler->SetMinimizePasses(false);
+
+    EXPECT_EQ(GPA_STATUS_ERROR_FAILED, pCounterScheduler->EnableCountersWithinPassBudget(prioritizedCounters.data(), numCounters, 0, &numEnabled));
+    EXPECT_EQ(numEnabled, pCounterScheduler->GetNumEnabledCounters());
+
+    pCounterScheduler->DisableAllCounters();
+}
+
+/// Splits a series of large counter selections for a device and reports the average time taken by each split.
+/// Each selection enables all but one of the public counters, so that every split misses the pass plan cache.
+/// Each selection differs from the previous one by two counters, so the time taken to update the passes of the previous selection is reported as well.
+/// \param api the API whose counters to split
+/// \param pApiName the name of the API, used in the report
+/// \param deviceId the device whose counters to split
+/// \param pGenerationName the name of the hardware generation of the device, used in the report
+void BenchmarkSplitCounters(GPA_API_Type api, const char* pApiName, unsigned int deviceId, const char* pGenerationName)
+{
+    GPA_ICounterAccessor* pCounterAccessor = nullptr;
+    GPA_ICounterScheduler* pCounterScheduler = nullptr;
+
+    if (GPA_STATUS_OK != GetAvailableCountersFromDll(api, deviceId, &pCounterAccessor, &pCounterScheduler))
+    {
+        // this API does not support this hardware generation
+        return;
+    }
+
+    gpa_uint32 numCounters = pCounterAccessor->GetNumPublicCounters();
+    gpa_uint32 totalPasses = 0;
+    gpa_uint32 totalUpdatedPasses = 0;
+    double splitMs = 0;
+    double updateMs = 0;
+
+    for (gpa_uint32 skippedCounter = 0; skippedCounter < numCounters; ++skippedCounter)
+    {
+        pCounterScheduler->DisableAllCounters();
+
+        for (gpa_uint32 i = 0; i < numCounters; ++i)
+        {
+            if (i != skippedCounter)
+            {
+                EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->EnableCounter(i));
+            }
+        }
+
+        gpa_uint32 requiredPasses = 0;
+
+        std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+        EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+        updateMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        totalUpdatedPasses += requiredPasses;
+
+        pCounterScheduler->RequestFullSplit();
+
+        startTime = std::chrono::high_resolution_clock::now();
+        EXPECT_EQ(GPA_STATUS_OK, pCounterScheduler->GetNumRequiredPasses(&requiredPasses));
+        splitMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        totalPasses += requiredPasses;
+    }
+
+    pCounterScheduler->DisableAllCounters();
+
+    if (0 < numCounters)
+    {
+        printf("%s %s: %u selections of %u counters: %.3f ms per split, %.1f passes per split, %.3f ms per update, %.1f passes per update\n",
+               pApiName, pGenerationName, numCounters, numCounters - 1, splitMs / numCounters, (double)totalPasses / numCounters,
+               updateMs / numCounters, (double)totalUpdatedPasses / numCounters);
+    }
+}
+
+// Benchmarks are disabled so that they do not slow down every test run; run them with --gtest_also_run_disabled_tests
+TEST(CounterDLLTests, DISABLED_SplitCountersBenchmark)
+{
+    const GPA_API_Type apis[] = { GPA_API_DIRECTX_11, GPA_API_OPENGL, GPA_API_OPENCL, GPA_API_HSA };
+    const char* apiNames[] = { "DX11", "OpenGL", "OpenCL", "HSA" };
+    const unsigned int deviceIds[] = { gDevIdSI, gDevIdCI, gDevIdVI };
+    const char* generationNames[] = { "SI", "CI", "VI" };
+
+    for (unsigned int apiIndex = 0; apiIndex < sizeof(apis) / sizeof(apis[0]); apiIndex++)
+    {
+        for (unsigned int deviceIndex = 0; deviceIndex < sizeof(deviceIds) / sizeof(deviceIds[0]); deviceIndex++)
+        {
+            BenchmarkSplitCounters(apis[apiIndex], apiNames[apiIndex], deviceIds[deviceIndex], generationNames[deviceIndex]);
+        }
+    }
+}
@@ -0,0 +1,254 @@
+//==============================================================================
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit Tests for passing log messages to the logging callback through the ring of the logging thread
+//==============================================================================
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "GPUPerfAPI.h"
+#include "Logging.h"
+
+/// The time a test waits for the logging thread before it gives up, in seconds
+static const int LOGGING_THREAD_WAIT_SECONDS = 5;
+
+/// The message which makes the logging callback wait until the test releases it
+static const char BLOCKING_MESSAGE[] = "Block the logging thread";
+
+/// The state shared by the tests and the logging callback, which has no user data
+struct LoggingCallbackState
+{
+    /// Initializes the flags
+    LoggingCallbackState()
+        : m_isBlocked(false),
+          m_isReleased(false)
+    {
+    }
+
+    std::mutex m_mutex;                    ///< protects the other members
+    std::condition_variable m_condition;   ///< signals a change of the flags
+    bool m_isBlocked;                      ///< set by the callback once it is waiting for the test to release it
+    bool m_isReleased;                     ///< set by the test to let the callback return
+    std::vector<std::string> m_messages;   ///< the messages passed to the callback, in the order they were passed
+};
+
+/// The state of the logging callback
+static LoggingCallbackState s_loggingCallbackState;
+
+/// Logging callback which records the messages, and waits for the test to release it when it is passed BLOCKING_MESSAGE
+/// \param messageType the type of the message
+/// \param pMessage the message
+static void RecordingLoggingCallback(GPA_Logging_Type messageType, const char* pMessage)
+{
+    UNREFERENCED_PARAMETER(messageType);
+
+    std::unique_lock<std::mutex> lock(s_loggingCallbackState.m_mutex);
+
+    if (0 == strcmp(BLOCKING_MESSAGE, pMessage))
+    {
+        s_loggingCallbackState.m_isBlocked = true;
+        s_loggingCallbackState.m_condition.notify_all();
+        s_loggingCallbackState.m_condition.wait_for(lock, std::chrono::seconds(LOGGING_THREAD_WAIT_SECONDS), [] { return s_loggingCallbackState.m_isReleased; });
+        return;
+    }
+
+    s_loggingCallbackState.m_messages.push_back(pMessage);
+}
+
+/// Registers RecordingLoggingCallback, and forgets the messages it has recorded so far
+static void StartRecording()
+{
+    ASSERT_EQ(GPA_STATUS_OK, GPA_RegisterLoggingCallback(GPA_LOGGING_ERROR_AND_MESSAGE, RecordingLoggingCallback));
+    g_loggerSingleton.Flush();
+
+    std::lock_guard<std::mutex> lock(s_loggingCallbackState.m_mutex);
+    s_loggingCallbackState.m_isBlocked = false;
+    s_loggingCallbackState.m_isReleased = false;
+    s_loggingCallbackState.m_messages.clear();
+}
+
+/// Makes the logging thread wait in the callback, so that the messages logged from now on stay in the ring
+static void BlockLoggingThread()
+{
+    GPA_LogMessage(BLOCKING_MESSAGE);
+
+    std::unique_lock<std::mutex> lock(s_loggingCallbackState.m_mutex);
+    ASSERT_TRUE(s_loggingCallbackState.m_condition.wait_for(lock, std::chrono::seconds(LOGGING_THREAD_WAIT_SECONDS), [] { return s_loggingCallbackState.m_isBlocked; }));
+}
+
+/// Lets the logging thread return from the callback, and waits until it has passed along every message in the ring
+static void ReleaseLoggingThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(s_loggingCallbackState.m_mutex);
+        s_loggingCallbackState.m_isReleased = true;
+    }
+
+    s_loggingCallbackState.m_condition.notify_all();
+    g_loggerSingleton.Flush();
+}
+
+/// Gets the recorded messages which start with the specified prefix, leaving out those logged by GPA itself
+/// \param pPrefix the prefix of the messages logged by the test
+/// \param[out] messages will contain the recorded messages which start with pPrefix
+static void GetRecordedMessages(const char* pPrefix, std::vector<std::string>& messages)
+{
+    std::lock_guard<std::mutex> lock(s_loggingCallbackState.m_mutex);
+
+    messages.clear();
+
+    for (const std::string& message : s_loggingCallbackState.m_messages)
+    {
+        if (0 == message.compare(0, strlen(pPrefix), pPrefix))
+        {
+            messages.push_back(message);
+        }
+    }
+}
+
+// A message which does not fit in a log record reaches the callback in full, whether or not it had to wait in the ring
+TEST(LoggingTests, LongMessageIsNotTruncated)
+{
+    StartRecording();
+
+    std::string longMessage("Long message ");
+    longMessage.append(GPA_LOG_RECORD_MESSAGE_SIZE * 4, 'x');
+
+    GPA_LogMessage(longMessage.c_str());
+    g_loggerSingleton.Flush();
+
+    BlockLoggingThread();
+    GPA_LogMessage(longMessage.c_str());
+    ReleaseLoggingThread();
+
+    std::vector<std::string> messages;
+    GetRecordedMessages("Long message ", messages);
+    ASSERT_EQ(2u, messages.size());
+    EXPECT_EQ(longMessage, messages[0]);
+    EXPECT_EQ(longMessage, messages[1]);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_RegisterLoggingCallback(GPA_LOGGING_NONE, nullptr));
+}
+
+// Once the ring is full, each new message drops the oldest one, and the rest are passed along in the order they were logged
+TEST(LoggingTests, FullRingDropsOldestMessage)
+{
+    static const unsigned int extraMessageCount = 10;
+    static const unsigned int messageCount = static_cast<unsigned int>(GPA_LOG_RING_SIZE) + extraMessageCount;
+
+    StartRecording();
+    BlockLoggingThread();
+
+    gpa_uint64 droppedCount = g_loggerSingleton.GetDroppedMessageCount();
+
+    for (unsigned int i = 0; i < messageCount; i++)
+    {
+        GPA_LogMessageFormat("Message %u", i);
+    }
+
+    EXPECT_EQ(droppedCount + extraMessageCount, g_loggerSingleton.GetDroppedMessageCount());
+
+    ReleaseLoggingThread();
+
+    std::vector<std::string> messages;
+    GetRecordedMessages("Message ", messages);
+    ASSERT_EQ(GPA_LOG_RING_SIZE, messages.size());
+
+    for (unsigned int i = 0; i < messages.size(); i++)
+    {
+        EXPECT_EQ("Message " + std::to_string(extraMessageCount + i), messages[i]);
+    }
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_RegisterLoggingCallback(GPA_LOGGING_NONE, nullptr));
+}
+
+/// Logs numbered messages; producers with an odd index log messages too long for a log record
+/// \param producerIndex the index of the producer, which is included in each message
+/// \param messageCount the number of messages to log
+static void ProduceMessages(unsigned int producerIndex, unsigned int messageCount)
+{
+    std::string padding(GPA_LOG_RECORD_MESSAGE_SIZE, ' ');
+
+    for (unsigned int i = 0; i < messageCount; i++)
+    {
+        if (0 == producerIndex % 2)
+        {
+            GPA_LogMessageFormat("Producer %u message %u", producerIndex, i);
+        }
+        else
+        {
+            std::string message = "Producer " + std::to_string(producerIndex) + " message " + std::to_string(i) + padding;
+            GPA_LogMessage(message.c_str());
+        }
+    }
+}
+
+// Messages logged by several threads while the logging thread is blocked wrap around the ring many times;
+// every message is either passed along or counted as dropped, and the messages of each thread keep their order
+TEST(LoggingTests, MultipleProducersWrapRing)
+{
+    static const unsigned int producerCount = 4;
+    static const unsigned int messagesPerProducer = static_cast<unsigned int>(GPA_LOG_RING_SIZE) * 4;
+
+    StartRecording();
+    BlockLoggingThread();
+
+    gpa_uint64 droppedCount = g_loggerSingleton.GetDroppedMessageCount();
+
+    std::vector<std::thread> producers;
+
+    for (unsigned int producerIndex = 0; producerIndex < producerCount; producerIndex++)
+    {
+        producers.emplace_back(ProduceMessages, producerIndex, messagesPerProducer);
+    }
+
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+
+    gpa_uint64 newDroppedCount = g_loggerSingleton.GetDroppedMessageCount() - droppedCount;
+
+    ReleaseLoggingThread();
+
+    // the ring still works once its positions have wrapped around
+    GPA_LogMessage("Producer done");
+    g_loggerSingleton.Flush();
+
+    std::vector<std::string> messages;
+    GetRecordedMessages("Producer ", messages);
+    ASSERT_FALSE(messages.empty());
+    EXPECT_EQ("Producer done", messages.back());
+    messages.pop_back();
+
+    EXPECT_EQ(static_cast<gpa_uint64>(producerCount) * messagesPerProducer, messages.size() + newDroppedCount);
+    EXPECT_LE(messages.size(), GPA_LOG_RING_SIZE);
+
+    std::vector<int> lastMessageIndex(producerCount, -1);
+
+    for (const std::string& message : messages)
+    {
+        unsigned int producerIndex = 0;
+        int messageIndex = 0;
+        ASSERT_EQ(2, sscanf(message.c_str(), "Producer %u message %d", &producerIndex, &messageIndex)) << message;
+        ASSERT_LT(producerIndex, producerCount);
+
+        EXPECT_LT(lastMessageIndex[producerIndex], messageIndex);
+        lastMessageIndex[producerIndex] = messageIndex;
+
+        if (1 == producerIndex % 2)
+        {
+            EXPECT_EQ(GPA_LOG_RECORD_MESSAGE_SIZE, message.size() - message.find_last_not_of(' ') - 1);
+        }
+    }
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_RegisterLoggingCallback(GPA_LOGGING_NONE, nullptr));
+}
@@ -0,0 +1,285 @@
+//==============================================================================
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  A GPUPerfAPI backend which does no GPU work, for testing and benchmarking the API-independent part of GPUPerfAPI
+//==============================================================================
+
+#include <atomic>
+#include <mutex>
+#include <set>
+
+#include "MockBackend.h"
+#include "CounterGeneratorTests.h"
+#include "GPUPerfAPIImp.h"
+#include "GPAContextState.h"
+#include "GPADataRequest.h"
+
+// The API-independent part of GPUPerfAPI is linked against this backend in the unit tests. It generates the OpenCL counters
+// of a VI device but does no GPU work, and its data requests complete immediately unless their sample is held.
+
+/// The number of data requests created
+static std::atomic<gpa_uint32> s_numDataRequestsCreated(0);
+
+/// The number of data requests deleted, including those deleted by the result collection thread
+static std::atomic<gpa_uint32> s_numDataRequestsDeleted(0);
+
+/// The number of times a data request was begun again for the same counter selection ID but with other counters
+static std::atomic<gpa_uint32> s_numStaleDataRequests(0);
+
+/// The sample ID passed to the last GPA_IMP_BeginSample call, which is the sample of the next data request begun
+static gpa_uint32 s_currentSampleID = 0;
+
+/// The sample IDs whose data requests do not complete
+static std::set<gpa_uint32> s_heldSampleIDs;
+
+/// Protects s_heldSampleIDs, which is read by the background result collection thread
+static std::mutex s_heldSampleIDsMutex;
+
+/// Context which allows its results to be collected by the background result collection thread
+class MockContextState : public GPA_ContextState
+{
+public:
+    /// The data requests of the backend can be polled from any thread
+    /// \return true
+    bool SupportsBackgroundResultCollection() const override
+    {
+        return true;
+    }
+};
+
+/// Data request which completes immediately, unless its sample is held, with a result of the sample ID plus one plus the position of each counter
+class MockDataRequest : public GPA_DataRequest
+{
+public:
+    /// Counts the created request
+    MockDataRequest()
+        : m_sampleID(0),
+          m_isBegun(false),
+          m_beginSelectionID(0)
+    {
+        s_numDataRequestsCreated++;
+    }
+
+    /// Counts the deleted request
+    ~MockDataRequest()
+    {
+        s_numDataRequestsDeleted++;
+    }
+
+    /// Stores a result of the sample ID plus one plus the position of each active counter, unless the sample is held
+    /// \param resultStorage the storage for the results
+    /// \return true if the results were stored, false if the sample is held
+    bool CollectResults(GPA_CounterResults& resultStorage) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(s_heldSampleIDsMutex);
+
+            if (s_heldSampleIDs.find(m_sampleID) != s_heldSampleIDs.end())
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < NumActiveCounters(); i++)
+        {
+            resultStorage.m_pResultBuffer[i] = m_sampleID + 1 + i;
+        }
+
+        return true;
+    }
+
+protected:
+    /// Records the number of active counters, and counts the request as stale if it is reused for the same selection ID with other counters.
+    /// A backend only sets up the counters of a reused request again when the selection ID changes.
+    /// \param pContextState the context state
+    /// \param selectionID the counter selection ID
+    /// \param pCounters the counters to measure
+    /// \return true
+    bool BeginRequest(GPA_ContextState* pContextState, gpa_uint32 selectionID, const vector<gpa_uint32>* pCounters) override
+    {
+        UNREFERENCED_PARAMETER(pContextState);
+
+        if (m_isBegun && selectionID == m_beginSelectionID && *pCounters != m_beginCounters)
+        {
+            s_numStaleDataRequests++;
+        }
+
+        m_sampleID = s_currentSampleID;
+        m_isBegun = true;
+        m_beginSelectionID = selectionID;
+        m_beginCounters = *pCounters;
+
+        SetNumActiveCounters(pCounters->size());
+        return true;
+    }
+
+    /// Does nothing, the request has no GPU work to end
+    /// \return true
+    bool EndRequest() override
+    {
+        return true;
+    }
+
+    /// Does nothing, the request holds no counters
+    void ReleaseCounters() override
+    {
+    }
+
+private:
+    gpa_uint32 m_sampleID;                 ///< the sample the request was last begun for
+    bool m_isBegun;                        ///< flag indicating whether the request was begun before
+    gpa_uint32 m_beginSelectionID;         ///< the counter selection ID the request was last begun with
+    std::vector<gpa_uint32> m_beginCounters; ///< the counters the request was last begun with
+};
+
+gpa_uint32 GetNumMockDataRequestsCreated()
+{
+    return s_numDataRequestsCreated;
+}
+
+gpa_uint32 GetNumMockDataRequestsDeleted()
+{
+    return s_numDataRequestsDeleted;
+}
+
+gpa_uint32 GetNumStaleMockDataRequests()
+{
+    return s_numStaleDataRequests;
+}
+
+void SetMockSampleHeld(gpa_uint32 sampleID, bool isHeld)
+{
+    std::lock_guard<std::mutex> lock(s_heldSampleIDsMutex);
+
+    if (isHeld)
+    {
+        s_heldSampleIDs.insert(sampleID);
+    }
+    else
+    {
+        s_heldSampleIDs.erase(sampleID);
+    }
+}
+
+GPA_DataRequest* GPA_IMP_CreateDataRequest()
+{
+    return new(std::nothrow) MockDataRequest();
+}
+
+GPA_Status GPA_IMP_Initialize()
+{
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_IMP_Destroy()
+{
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_IMP_CreateContext(GPA_ContextState** ppNewContext)
+{
+    GPA_ContextState* pContext = new(std::nothrow) MockContextState();
+
+    if (nullptr == pContext)
+    {
+        return GPA_STATUS_ERROR_FAILED;
+    }
+
+    *ppNewContext = pContext;
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_IMP_OpenContext(void* pContext)
+{
+    UNREFERENCED_PARAMETER(pContext);
+
+    return GenerateCounters(GPA_API_OPENCL, AMD_VENDOR_ID, gDevIdVI, 0, reinterpret_cast<GPA_ICounterAccessor**>(&(g_pCurrentContext->m_pCounterAccessor)), &(g_pCurrentContext->m_pCounterScheduler));
+}
+
+GPA_Status GPA_IMP_CloseContext()
+{
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_IMP_SelectContext(void* pContext)
+{
+    UNREFERENCED_PARAMETER(pContext);
+
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_IMP_BeginSession(gpa_uint32* pSessionID, bool counterSelectionChanged)
+{
+    UNREFERENCED_PARAMETER(pSessionID);
+    UNREFERENCED_PARAMETER(counterSelectionChanged);
+
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_IMP_EndSession()
+{
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_IMP_BeginPass()
+{
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_IMP_EndPass()
+{
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_IMP_BeginSample(gpa_uint32 sampleID)
+{
+    s_currentSampleID = sampleID;
+
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_IMP_EndSample()
+{
+    return GPA_STATUS_OK;
+}
+
+gpa_uint32 GPA_IMP_GetDefaultMaxSessions()
+{
+    return 4;
+}
+
+gpa_uint32 GPA_IMP_GetPreferredCheckResultFrequency()
+{
+    return 50;
+}
+
+GPA_Status GPA_IMP_GetHWInfo(void* pContext, GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pContext);
+
+    pHwInfo->SetVendorID(AMD_VENDOR_ID);
+    pHwInfo->SetDeviceID(gDevIdVI);
+    pHwInfo->SetRevisionID(0);
+    pHwInfo->SetTimeStampFrequency(100000000);
+    pHwInfo->UpdateDeviceInfoBasedOnDeviceID();
+
+    return GPA_STATUS_OK;
+}
+
+GPA_Status GPA_IMP_CompareHWInfo(void* pContext, GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pContext);
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    // the GPUs installed in the machine are not the device of the backend
+    return GPA_STATUS_ERROR_HARDWARE_NOT_SUPPORTED;
+}
+
+GPA_Status GPA_IMP_VerifyHWSupport(void* pContext, GPA_HWInfo* pHwInfo)
+{
+    UNREFERENCED_PARAMETER(pContext);
+    UNREFERENCED_PARAMETER(pHwInfo);
+
+    return GPA_STATUS_OK;
+}
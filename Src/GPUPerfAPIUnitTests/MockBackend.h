@@ -0,0 +1,33 @@
+//==============================================================================
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  A GPUPerfAPI backend which does no GPU work, for testing and benchmarking the API-independent part of GPUPerfAPI
+//==============================================================================
+
+#ifndef _GPA_MOCK_BACKEND_H_
+#define _GPA_MOCK_BACKEND_H_
+
+#include "GPUPerfAPITypes.h"
+
+/// Gets the number of data requests the mock backend has created
+/// \return the number of data requests created since the process started
+gpa_uint32 GetNumMockDataRequestsCreated();
+
+/// Gets the number of data requests of the mock backend which have been deleted
+/// \return the number of data requests deleted since the process started
+gpa_uint32 GetNumMockDataRequestsDeleted();
+
+/// Gets the number of times a data request of the mock backend was reused for the same counter selection ID but with other counters.
+/// The counters of such a request are not set up again by a real backend, so it would measure the counters it was first begun with.
+/// \return the number of stale data requests since the process started
+gpa_uint32 GetNumStaleMockDataRequests();
+
+/// Sets whether the data requests of a sample are held, a held request does not complete until its sample is released.
+/// Each data request of the mock backend otherwise completes immediately; the result of each of its counters is its sample ID plus one
+/// plus the position of the counter in the request, so that the results of different samples and counters differ.
+/// \param sampleID the sample whose requests are held or released
+/// \param isHeld true to hold the requests of the sample, false to release them
+void SetMockSampleHeld(gpa_uint32 sampleID, bool isHeld);
+
+#endif // _GPA_MOCK_BACKEND_H_
@@ -0,0 +1,167 @@
+//==============================================================================
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit tests and benchmark for public counter evaluation
+//==============================================================================
+
+#include "CounterGeneratorTests.h"
+#include "GPAPublicCounters.h"
+#include <chrono>
+
+#include "PublicCounterDefsCLGfx8.h"
+#include "PublicCounterDefsDX11Gfx8.h"
+#include "PublicCounterDefsGLGfx8.h"
+#include "PublicCounterDefsHSAGfx8.h"
+
+/// function which defines a table of public counters
+typedef void(*DefinePublicCountersProc)(GPA_PublicCounters& p);
+
+/// number of times each counter is evaluated when timing the two evaluation paths
+static const unsigned int gBenchmarkIterations = 1000;
+
+/// Fabricated internal counter results for every counter of a public counter table
+struct CounterEvaluationInputs
+{
+    std::vector< std::vector<gpa_uint64> > m_resultValues;          ///< the values of the internal counters required by each public counter
+    std::vector< std::vector<char*> > m_sampleResults;              ///< pointers to m_resultValues, as passed to the evaluation functions
+    std::vector< std::vector<GPA_Type> > m_internalCounterTypes;    ///< the types of the internal counters required by each public counter
+};
+
+/// Defines and expands a table of public counters, the hardware info to evaluate them with, and non-zero results for their internal counters
+/// \param pDefineCounters the function which defines the table of public counters
+/// \param[out] publicCounters the table of public counters
+/// \param[out] hwInfo the hardware info
+/// \param[out] inputs the internal counter results of each public counter
+void InitializeCounterEvaluation(DefinePublicCountersProc pDefineCounters, GPA_PublicCounters& publicCounters, GPA_HWInfo& hwInfo, CounterEvaluationInputs& inputs)
+{
+    pDefineCounters(publicCounters);
+    publicCounters.ExpandCounters();
+
+    hwInfo.SetVendorID(AMD_VENDOR_ID);
+    hwInfo.SetDeviceID(gDevIdVI);
+    hwInfo.SetTimeStampFrequency(100000000);
+    hwInfo.UpdateDeviceInfoBasedOnDeviceID();
+
+    gpa_uint32 numCounters = publicCounters.GetNumCounters();
+
+    inputs.m_resultValues.assign(numCounters, std::vector<gpa_uint64>());
+    inputs.m_sampleResults.assign(numCounters, std::vector<char*>());
+    inputs.m_internalCounterTypes.assign(numCounters, std::vector<GPA_Type>());
+
+    for (gpa_uint32 i = 0; i < numCounters; i++)
+    {
+        size_t requiredCount = publicCounters.GetInternalCountersRequired(i).size();
+
+        for (size_t j = 0; j < requiredCount; j++)
+        {
+            inputs.m_resultValues[i].push_back(((j * 7919) + (i * 31)) % 1000 + 1);
+            inputs.m_internalCounterTypes[i].push_back(GPA_TYPE_UINT64);
+        }
+
+        for (size_t j = 0; j < requiredCount; j++)
+        {
+            inputs.m_sampleResults[i].push_back(reinterpret_cast<char*>(&inputs.m_resultValues[i][j]));
+        }
+    }
+}
+
+/// Verifies that the compiled expression of every counter in a public counter table produces exactly the same result
+/// as interpreting the expression string.
+/// \param pTableName the name of the table, used in failure messages
+/// \param pDefineCounters the function which defines the table of public counters
+void VerifyCounterEvaluation(const char* pTableName, DefinePublicCountersProc pDefineCounters)
+{
+    GPA_PublicCounters publicCounters;
+    GPA_HWInfo hwInfo;
+    CounterEvaluationInputs inputs;
+    InitializeCounterEvaluation(pDefineCounters, publicCounters, hwInfo, inputs);
+
+    gpa_uint32 numCounters = publicCounters.GetNumCounters();
+    ASSERT_LT(0u, numCounters);
+
+    // every counter must produce a bit-identical result through both paths
+    for (gpa_uint32 i = 0; i < numCounters; i++)
+    {
+        gpa_uint64 expectedResult = 0;
+        gpa_uint64 compiledResult = 0;
+
+        publicCounters.ComputeCounterValueFromExpression(i, inputs.m_sampleResults[i], inputs.m_internalCounterTypes[i], &expectedResult, &hwInfo);
+        publicCounters.ComputeCounterValue(i, inputs.m_sampleResults[i], inputs.m_internalCounterTypes[i], &compiledResult, &hwInfo);
+
+        EXPECT_EQ(expectedResult, compiledResult) << pTableName << " counter " << publicCounters.GetCounterName(i);
+    }
+}
+
+/// Reports how long interpreting the expression strings and running the compiled expressions take to evaluate a whole public counter table.
+/// \param pTableName the name of the table, used in the report
+/// \param pDefineCounters the function which defines the table of public counters
+void BenchmarkCounterEvaluation(const char* pTableName, DefinePublicCountersProc pDefineCounters)
+{
+    GPA_PublicCounters publicCounters;
+    GPA_HWInfo hwInfo;
+    CounterEvaluationInputs inputs;
+    InitializeCounterEvaluation(pDefineCounters, publicCounters, hwInfo, inputs);
+
+    gpa_uint32 numCounters = publicCounters.GetNumCounters();
+    ASSERT_LT(0u, numCounters);
+
+    gpa_uint64 result = 0;
+
+    std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+    for (unsigned int iteration = 0; iteration < gBenchmarkIterations; iteration++)
+    {
+        for (gpa_uint32 i = 0; i < numCounters; i++)
+        {
+            publicCounters.ComputeCounterValueFromExpression(i, inputs.m_sampleResults[i], inputs.m_internalCounterTypes[i], &result, &hwInfo);
+        }
+    }
+
+    std::chrono::high_resolution_clock::time_point expressionEndTime = std::chrono::high_resolution_clock::now();
+
+    for (unsigned int iteration = 0; iteration < gBenchmarkIterations; iteration++)
+    {
+        for (gpa_uint32 i = 0; i < numCounters; i++)
+        {
+            publicCounters.ComputeCounterValue(i, inputs.m_sampleResults[i], inputs.m_internalCounterTypes[i], &result, &hwInfo);
+        }
+    }
+
+    std::chrono::high_resolution_clock::time_point compiledEndTime = std::chrono::high_resolution_clock::now();
+
+    double expressionMs = std::chrono::duration<double, std::milli>(expressionEndTime - startTime).count();
+    double compiledMs = std::chrono::duration<double, std::milli>(compiledEndTime - expressionEndTime).count();
+
+    printf("%s: %u counters x %u iterations: expression string %.3f ms, compiled expression %.3f ms (%.1fx)\n",
+           pTableName, numCounters, gBenchmarkIterations, expressionMs, compiledMs, (compiledMs > 0) ? (expressionMs / compiledMs) : 0.0);
+}
+
+TEST(PublicCounterEvaluationTests, CLGfx8CompiledExpressions)
+{
+    VerifyCounterEvaluation("CLGfx8", AutoDefinePublicCountersCLGfx8);
+}
+
+TEST(PublicCounterEvaluationTests, DX11Gfx8CompiledExpressions)
+{
+    VerifyCounterEvaluation("DX11Gfx8", AutoDefinePublicCountersDX11Gfx8);
+}
+
+TEST(PublicCounterEvaluationTests, GLGfx8CompiledExpressions)
+{
+    VerifyCounterEvaluation("GLGfx8", AutoDefinePublicCountersGLGfx8);
+}
+
+TEST(PublicCounterEvaluationTests, HSAGfx8CompiledExpressions)
+{
+    VerifyCounterEvaluation("HSAGfx8", AutoDefinePublicCountersHSAGfx8);
+}
+
+// Benchmarks are disabled so that they do not slow down every test run; run them with --gtest_also_run_disabled_tests
+TEST(PublicCounterEvaluationBenchmarks, DISABLED_CompiledExpressions)
+{
+    BenchmarkCounterEvaluation("CLGfx8", AutoDefinePublicCountersCLGfx8);
+    BenchmarkCounterEvaluation("DX11Gfx8", AutoDefinePublicCountersDX11Gfx8);
+    BenchmarkCounterEvaluation("GLGfx8", AutoDefinePublicCountersGLGfx8);
+    BenchmarkCounterEvaluation("HSAGfx8", AutoDefinePublicCountersHSAGfx8);
+}
@@ -0,0 +1,118 @@
+//==============================================================================
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Benchmarks for the overhead of GPA_OpenContext and of GPA_BeginSample / GPA_EndSample
+//==============================================================================
+
+#include <chrono>
+#include <cstdio>
+
+#include <gtest/gtest.h>
+#include "GPUPerfAPI.h"
+
+// The benchmarks run on the backend in MockBackend.cpp, which does no GPU work, so that only the cost of the GPUPerfAPI calls themselves is measured.
+
+/// number of sample pairs per timed run
+static const unsigned int gSampleBenchmarkIterations = 200000;
+
+/// number of timed runs, the fastest one is reported
+static const unsigned int gSampleBenchmarkRuns = 7;
+
+/// number of contexts opened per timed run
+static const unsigned int gOpenContextBenchmarkIterations = 1000;
+
+// Benchmarks are disabled so that they do not slow down every test run; run them with --gtest_also_run_disabled_tests
+TEST(SampleOverheadBenchmarks, DISABLED_BeginEndSample)
+{
+    int context = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&context));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounter(0));
+
+    gpa_uint32 passCount = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetPassCount(&passCount));
+    ASSERT_EQ(1u, passCount);
+
+    double bestNanoseconds = 0;
+
+    for (unsigned int run = 0; run < gSampleBenchmarkRuns; run++)
+    {
+        gpa_uint32 sessionID = 0;
+        EXPECT_EQ(GPA_STATUS_OK, GPA_BeginSession(&sessionID));
+        EXPECT_EQ(GPA_STATUS_OK, GPA_BeginPass());
+
+        std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+        for (unsigned int i = 0; i < gSampleBenchmarkIterations; i++)
+        {
+            GPA_BeginSample(i);
+            GPA_EndSample();
+        }
+
+        std::chrono::high_resolution_clock::time_point endTime = std::chrono::high_resolution_clock::now();
+
+        EXPECT_EQ(GPA_STATUS_OK, GPA_EndPass());
+        EXPECT_EQ(GPA_STATUS_OK, GPA_EndSession());
+
+        double nanoseconds = std::chrono::duration<double, std::nano>(endTime - startTime).count() / gSampleBenchmarkIterations;
+
+        if (0 == run || nanoseconds < bestNanoseconds)
+        {
+            bestNanoseconds = nanoseconds;
+        }
+    }
+
+    printf("GPA_BeginSample/GPA_EndSample: %.1f ns per pair (fastest of %u runs of %u pairs)\n", bestNanoseconds, gSampleBenchmarkRuns, gSampleBenchmarkIterations);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
+
+// Benchmarks are disabled so that they do not slow down every test run; run them with --gtest_also_run_disabled_tests
+TEST(SampleOverheadBenchmarks, DISABLED_OpenContext)
+{
+    int context = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+
+    gpa_uint32 numCounters = 0;
+    double bestMilliseconds = 0;
+
+    // open a context and profile a single counter, the common case for short compute jobs
+    for (unsigned int run = 0; run < gSampleBenchmarkRuns; run++)
+    {
+        std::chrono::high_resolution_clock::time_point startTime = std::chrono::high_resolution_clock::now();
+
+        for (unsigned int i = 0; i < gOpenContextBenchmarkIterations; i++)
+        {
+            EXPECT_EQ(GPA_STATUS_OK, GPA_OpenContext(&context));
+            EXPECT_EQ(GPA_STATUS_OK, GPA_EnableCounterStr("Wavefronts"));
+
+            gpa_uint32 passCount = 0;
+            EXPECT_EQ(GPA_STATUS_OK, GPA_GetPassCount(&passCount));
+            EXPECT_EQ(1u, passCount);
+
+            if (0 == i)
+            {
+                EXPECT_EQ(GPA_STATUS_OK, GPA_GetNumCounters(&numCounters));
+            }
+
+            EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+        }
+
+        std::chrono::high_resolution_clock::time_point endTime = std::chrono::high_resolution_clock::now();
+
+        double milliseconds = std::chrono::duration<double, std::milli>(endTime - startTime).count() / gOpenContextBenchmarkIterations;
+
+        if (0 == run || milliseconds < bestMilliseconds)
+        {
+            bestMilliseconds = milliseconds;
+        }
+    }
+
+    printf("GPA_OpenContext/GPA_EnableCounterStr/GPA_GetPassCount/GPA_CloseContext: %.3f ms per context of %u counters (fastest of %u runs of %u contexts)\n", bestMilliseconds, numCounters, gSampleBenchmarkRuns, gOpenContextBenchmarkIterations);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
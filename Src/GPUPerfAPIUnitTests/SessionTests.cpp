@@ -0,0 +1,606 @@
+//==============================================================================
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+/// \author AMD Developer Tools Team
+/// \file
+/// \brief  Unit Tests for profiling sessions and collecting their results, on the backend in MockBackend.cpp
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <vector>
+#include <gtest/gtest.h>
+#include "GPUPerfAPI.h"
+#include "MockBackend.h"
+
+/// The time a test waits for another thread before it gives up, in seconds
+static const int THREAD_WAIT_SECONDS = 5;
+
+/// Profiles samples in one pass for the enabled counters of the current context
+/// \param[out] pSessionID the ID of the session of the samples
+/// \param sampleCount the number of samples to profile
+static void ProfileSamples(gpa_uint32* pSessionID, gpa_uint32 sampleCount)
+{
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(pSessionID));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginPass());
+
+    for (gpa_uint32 sampleID = 0; sampleID < sampleCount; sampleID++)
+    {
+        ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSample(sampleID));
+        ASSERT_EQ(GPA_STATUS_OK, GPA_EndSample());
+    }
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EndPass());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EndSession());
+}
+
+/// Enables counters, starting with Wavefronts, until they need more than one pass
+/// \param[out] pPassCount the number of passes of the enabled counters
+static void EnableMultiPassCounters(gpa_uint32* pPassCount)
+{
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterStr("Wavefronts"));
+
+    gpa_uint32 numCounters = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetNumCounters(&numCounters));
+
+    *pPassCount = 1;
+
+    for (gpa_uint32 counterIndex = 0; counterIndex < numCounters && *pPassCount < 2; counterIndex++)
+    {
+        if (GPA_STATUS_OK != GPA_IsCounterEnabled(counterIndex))
+        {
+            ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounter(counterIndex));
+            ASSERT_EQ(GPA_STATUS_OK, GPA_GetPassCount(pPassCount));
+        }
+    }
+
+    ASSERT_LE(2u, *pPassCount);
+}
+
+/// Profiles the same samples in every pass of a session
+/// \param[out] pSessionID the ID of the session of the samples
+/// \param passCount the number of passes of the enabled counters
+/// \param sampleIDs the IDs of the samples, in the order they are profiled
+static void ProfileSessionSamples(gpa_uint32* pSessionID, gpa_uint32 passCount, const std::vector<gpa_uint32>& sampleIDs)
+{
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(pSessionID));
+
+    for (gpa_uint32 pass = 0; pass < passCount; pass++)
+    {
+        ASSERT_EQ(GPA_STATUS_OK, GPA_BeginPass());
+
+        for (gpa_uint32 sampleID : sampleIDs)
+        {
+            ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSample(sampleID));
+            ASSERT_EQ(GPA_STATUS_OK, GPA_EndSample());
+        }
+
+        ASSERT_EQ(GPA_STATUS_OK, GPA_EndPass());
+    }
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EndSession());
+}
+
+/// Gets the size of the result of each enabled counter, in enabled index order
+/// \param[out] resultSizes the size in bytes of the result of each enabled counter
+static void GetEnabledResultSizes(std::vector<size_t>& resultSizes)
+{
+    gpa_uint32 enabledCount = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetEnabledCount(&enabledCount));
+
+    resultSizes.clear();
+
+    for (gpa_uint32 enabledIndex = 0; enabledIndex < enabledCount; enabledIndex++)
+    {
+        gpa_uint32 counterIndex = 0;
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetEnabledIndex(enabledIndex, &counterIndex));
+
+        GPA_Type type = GPA_TYPE__LAST;
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetCounterDataType(counterIndex, &type));
+
+        resultSizes.push_back((GPA_TYPE_FLOAT64 == type || GPA_TYPE_UINT64 == type || GPA_TYPE_INT64 == type) ? 8 : 4);
+    }
+}
+
+/// What a session results callback has received
+struct RecordingCallbackState
+{
+    /// Initializes the state before the callback is called
+    RecordingCallbackState()
+        : m_callCount(0),
+          m_sessionID(0),
+          m_status(GPA_STATUS_OK),
+          m_rowSize(0),
+          m_rejectedCallCount(0)
+    {
+    }
+
+    int m_callCount;                       ///< the number of times the callback was called
+    gpa_uint32 m_sessionID;                ///< the session passed to the callback
+    GPA_Status m_status;                   ///< the status passed to the callback
+    std::vector<gpa_uint32> m_sampleIDs;   ///< the sample IDs of the results
+    size_t m_rowSize;                      ///< the size of one row of the results
+    std::vector<char> m_results;           ///< a copy of the results
+    int m_rejectedCallCount;               ///< the number of calls back into GPUPerfAPI which failed with GPA_STATUS_ERROR_FAILED
+};
+
+/// Session results callback which copies the results it receives
+/// \param sessionID the session whose results were requested
+/// \param status the status of the results
+/// \param pResults the results of the session
+/// \param pUserData the RecordingCallbackState of the test
+static void RecordingCallback(gpa_uint32 sessionID, GPA_Status status, const GPA_SessionResultsView* pResults, void* pUserData)
+{
+    RecordingCallbackState* pState = static_cast<RecordingCallbackState*>(pUserData);
+
+    pState->m_callCount++;
+    pState->m_sessionID = sessionID;
+    pState->m_status = status;
+
+    if (nullptr != pResults)
+    {
+        const char* pFirstResult = static_cast<const char*>(pResults->m_pResults);
+        pState->m_sampleIDs.assign(pResults->m_pSampleIds, pResults->m_pSampleIds + pResults->m_sampleCount);
+        pState->m_rowSize = pResults->m_rowSize;
+        pState->m_results.assign(pFirstResult, pFirstResult + (pResults->m_sampleCount * pResults->m_rowSize));
+    }
+}
+
+/// Session results callback which calls the entry points which would reuse or destroy the session it is reading
+/// \param sessionID the session whose results were requested
+/// \param status the status of the results
+/// \param pResults the results of the session
+/// \param pUserData the RecordingCallbackState of the test
+static void ReentrantCallback(gpa_uint32 sessionID, GPA_Status status, const GPA_SessionResultsView* pResults, void* pUserData)
+{
+    RecordingCallback(sessionID, status, pResults, pUserData);
+
+    RecordingCallbackState* pState = static_cast<RecordingCallbackState*>(pUserData);
+    gpa_uint32 newSessionID = 0;
+
+    const GPA_Status reentrantStatuses[] =
+    {
+        GPA_BeginSession(&newSessionID),
+        GPA_EndSession(),
+        GPA_SetResultCollectionMode(GPA_RESULT_COLLECTION_APPLICATION_THREAD),
+        GPA_CloseContext()
+    };
+
+    for (GPA_Status reentrantStatus : reentrantStatuses)
+    {
+        if (GPA_STATUS_ERROR_FAILED == reentrantStatus)
+        {
+            pState->m_rejectedCallCount++;
+        }
+    }
+}
+
+/// State shared between a test and a session results callback which waits for the test
+struct BlockingCallbackState
+{
+    /// Initializes the flags
+    BlockingCallbackState()
+        : m_isEntered(false),
+          m_isReleased(false),
+          m_wasReleased(false)
+    {
+    }
+
+    std::mutex m_mutex;                    ///< protects the flags
+    std::condition_variable m_condition;   ///< signals a change of the flags
+    bool m_isEntered;                      ///< set by the callback once it has been called
+    bool m_isReleased;                     ///< set by the test to let the callback return
+    bool m_wasReleased;                    ///< set by the callback if it was released before it gave up waiting
+};
+
+/// Session results callback which waits for the test to release it
+/// \param sessionID the session whose results were requested
+/// \param status the status of the results
+/// \param pResults the results of the session
+/// \param pUserData the BlockingCallbackState of the test
+static void BlockingCallback(gpa_uint32 sessionID, GPA_Status status, const GPA_SessionResultsView* pResults, void* pUserData)
+{
+    UNREFERENCED_PARAMETER(sessionID);
+    UNREFERENCED_PARAMETER(status);
+    UNREFERENCED_PARAMETER(pResults);
+
+    BlockingCallbackState* pState = static_cast<BlockingCallbackState*>(pUserData);
+
+    std::unique_lock<std::mutex> lock(pState->m_mutex);
+    pState->m_isEntered = true;
+    pState->m_condition.notify_all();
+    pState->m_wasReleased = pState->m_condition.wait_for(lock, std::chrono::seconds(THREAD_WAIT_SECONDS), [pState] { return pState->m_isReleased; });
+}
+
+// A callback called by the background result collection thread does not stop the application thread from profiling other sessions
+TEST(SessionTests, BackgroundCallbackDoesNotBlockProfiling)
+{
+    int context = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&context));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterStr("Wavefronts"));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_SetResultCollectionMode(GPA_RESULT_COLLECTION_BACKGROUND_THREAD));
+
+    // the session is not complete until the sample is released, so the callback is called by the background thread
+    SetMockSampleHeld(0, true);
+
+    gpa_uint32 sessionID = 0;
+    ProfileSamples(&sessionID, 1);
+
+    BlockingCallbackState state;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_RequestSessionResultsAsync(sessionID, BlockingCallback, &state));
+
+    SetMockSampleHeld(0, false);
+
+    {
+        std::unique_lock<std::mutex> lock(state.m_mutex);
+        ASSERT_TRUE(state.m_condition.wait_for(lock, std::chrono::seconds(THREAD_WAIT_SECONDS), [&state] { return state.m_isEntered; }));
+    }
+
+    // starting a session and ending its samples both notify the background thread while the callback is still running
+    gpa_uint32 otherSessionID = 0;
+    ProfileSamples(&otherSessionID, 1);
+
+    {
+        std::lock_guard<std::mutex> lock(state.m_mutex);
+        state.m_isReleased = true;
+        state.m_condition.notify_all();
+    }
+
+    bool isReady = false;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSessionReady(&isReady, otherSessionID));
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+    EXPECT_TRUE(state.m_wasReleased);
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
+
+// A sample ID which is repeated within a pass keeps its slot, and the results of its last request
+TEST(SessionTests, RepeatedSampleIDReusesSlot)
+{
+    int context = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&context));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterStr("Wavefronts"));
+
+    gpa_uint32 wavefrontsIndex = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetCounterIndex("Wavefronts", &wavefrontsIndex));
+
+    gpa_uint32 numCreated = GetNumMockDataRequestsCreated();
+    gpa_uint32 numDeleted = GetNumMockDataRequestsDeleted();
+
+    // the first request of the sample is still outstanding when the sample is started again
+    SetMockSampleHeld(3, true);
+
+    gpa_uint32 sessionID = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSession(&sessionID));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_BeginPass());
+
+    const gpa_uint32 sampleIDs[] = { 3, 5, 3 };
+
+    for (gpa_uint32 sampleID : sampleIDs)
+    {
+        ASSERT_EQ(GPA_STATUS_OK, GPA_BeginSample(sampleID));
+        ASSERT_EQ(GPA_STATUS_OK, GPA_EndSample());
+    }
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EndPass());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EndSession());
+
+    bool isReady = true;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSampleReady(&isReady, sessionID, 3));
+    EXPECT_FALSE(isReady);
+
+    SetMockSampleHeld(3, false);
+
+    gpa_uint32 sampleCount = 0;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetSampleCount(sessionID, &sampleCount));
+    EXPECT_EQ(2u, sampleCount);
+
+    // the only counter of each request of the mock backend measures its sample ID plus one
+    gpa_float64 result = 0;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetSampleFloat64(sessionID, 3, wavefrontsIndex, &result));
+    EXPECT_EQ(4.0, result);
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetSampleFloat64(sessionID, 5, wavefrontsIndex, &result));
+    EXPECT_EQ(6.0, result);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+
+    // the request which was superseded by the restarted sample is released as well
+    EXPECT_EQ(GetNumMockDataRequestsCreated() - numCreated, GetNumMockDataRequestsDeleted() - numDeleted);
+}
+
+// The requests of a pass are collected in the order they were submitted, so the requests after one which completes late wait for it
+TEST(SessionTests, RequestsCompleteInSubmissionOrder)
+{
+    int context = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&context));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterStr("Wavefronts"));
+
+    SetMockSampleHeld(1, true);
+
+    gpa_uint32 sessionID = 0;
+    ProfileSamples(&sessionID, 3);
+
+    bool isReady = false;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSessionReady(&isReady, sessionID));
+    EXPECT_FALSE(isReady);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSampleReady(&isReady, sessionID, 0));
+    EXPECT_TRUE(isReady);
+
+    // the request of sample 2 has completed, but it is not polled before the late request submitted ahead of it
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSampleReady(&isReady, sessionID, 1));
+    EXPECT_FALSE(isReady);
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSampleReady(&isReady, sessionID, 2));
+    EXPECT_FALSE(isReady);
+
+    SetMockSampleHeld(1, false);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSampleReady(&isReady, sessionID, 2));
+    EXPECT_TRUE(isReady);
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSampleReady(&isReady, sessionID, 1));
+    EXPECT_TRUE(isReady);
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSessionReady(&isReady, sessionID));
+    EXPECT_TRUE(isReady);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
+
+// Reading the results of a request which does not complete gives up once the timeout of the flush wait policy elapses, whichever way it waits
+TEST(SessionTests, FlushTimesOutWithEachWaitPolicy)
+{
+    static const gpa_uint32 timeoutMilliseconds = 10;
+
+    int context = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&context));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterStr("Wavefronts"));
+
+    gpa_uint32 wavefrontsIndex = 0;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetCounterIndex("Wavefronts", &wavefrontsIndex));
+
+    SetMockSampleHeld(0, true);
+
+    gpa_uint32 sessionID = 0;
+    ProfileSamples(&sessionID, 1);
+
+    gpa_float64 result = 0;
+
+    for (int policy = GPA_FLUSH_WAIT_SPIN; policy < GPA_FLUSH_WAIT__LAST; policy++)
+    {
+        ASSERT_EQ(GPA_STATUS_OK, GPA_SetFlushWaitPolicy(static_cast<GPA_Flush_Wait_Policy>(policy), timeoutMilliseconds));
+
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+        EXPECT_EQ(GPA_STATUS_ERROR_TIMEOUT, GPA_GetSampleFloat64(sessionID, 0, wavefrontsIndex, &result)) << "policy " << policy;
+        EXPECT_LE(static_cast<long long>(timeoutMilliseconds), std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count()) << "policy " << policy;
+    }
+
+    // once the request completes, the results can be read with the same timeout
+    SetMockSampleHeld(0, false);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetSampleFloat64(sessionID, 0, wavefrontsIndex, &result));
+    EXPECT_EQ(1.0, result);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
+
+// Once more sessions have been started than the context keeps, the oldest ones are no longer found, and the others are still found by their ID
+TEST(SessionTests, SessionLookupAfterRingWraps)
+{
+    static const gpa_uint32 sessionCount = 10;
+
+    // the number of sessions the mock backend keeps
+    static const gpa_uint32 keptSessionCount = 4;
+
+    int context = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&context));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterStr("Wavefronts"));
+
+    gpa_uint32 sessionIDs[sessionCount] = {};
+
+    for (gpa_uint32 i = 0; i < sessionCount; i++)
+    {
+        // each session has a different number of samples, so that it can be told apart from the session which reused its slot
+        ProfileSamples(&sessionIDs[i], i + 1);
+    }
+
+    gpa_uint32 sampleCount = 0;
+
+    for (gpa_uint32 i = 0; i < sessionCount - keptSessionCount; i++)
+    {
+        EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, GPA_GetSampleCount(sessionIDs[i], &sampleCount)) << "session " << sessionIDs[i];
+    }
+
+    for (gpa_uint32 i = sessionCount - keptSessionCount; i < sessionCount; i++)
+    {
+        EXPECT_EQ(GPA_STATUS_OK, GPA_GetSampleCount(sessionIDs[i], &sampleCount)) << "session " << sessionIDs[i];
+        EXPECT_EQ(i + 1, sampleCount) << "session " << sessionIDs[i];
+    }
+
+    // IDs start at one and the next session has not been started yet
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, GPA_GetSampleCount(0, &sampleCount));
+    EXPECT_EQ(GPA_STATUS_ERROR_SESSION_NOT_FOUND, GPA_GetSampleCount(sessionIDs[sessionCount - 1] + 1, &sampleCount));
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
+
+// The results of a whole session have one row for each sample, in ascending sample ID order, gathered from every pass of the sample,
+// and the column-major layout is the transpose of the row-major one
+TEST(SessionTests, SessionResultsLayout)
+{
+    int context = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&context));
+
+    gpa_uint32 passCount = 0;
+    EnableMultiPassCounters(&passCount);
+
+    std::vector<size_t> resultSizes;
+    GetEnabledResultSizes(resultSizes);
+
+    size_t rowSize = 0;
+
+    for (size_t resultSize : resultSizes)
+    {
+        rowSize += resultSize;
+    }
+
+    std::vector<gpa_uint32> sampleIDs = { 9, 2, 5 };
+    gpa_uint32 sessionID = 0;
+    ProfileSessionSamples(&sessionID, passCount, sampleIDs);
+
+    size_t sampleCount = sampleIDs.size();
+    std::vector<char> rowMajor(sampleCount * rowSize);
+    std::vector<char> columnMajor(sampleCount * rowSize);
+
+    EXPECT_EQ(GPA_STATUS_ERROR_BUFFER_TOO_SMALL, GPA_GetSessionResults(sessionID, GPA_RESULT_LAYOUT_ROW_MAJOR, rowMajor.data(), rowMajor.size() - 1));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSessionResults(sessionID, GPA_RESULT_LAYOUT_ROW_MAJOR, rowMajor.data(), rowMajor.size()));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSessionResults(sessionID, GPA_RESULT_LAYOUT_COLUMN_MAJOR, columnMajor.data(), columnMajor.size()));
+
+    std::sort(sampleIDs.begin(), sampleIDs.end());
+
+    std::vector<char> sampleResults(rowSize);
+
+    for (size_t row = 0; row < sampleCount; row++)
+    {
+        ASSERT_EQ(GPA_STATUS_OK, GPA_GetSampleResults(sessionID, sampleIDs[row], sampleResults.data(), sampleResults.size()));
+        EXPECT_EQ(0, memcmp(sampleResults.data(), &rowMajor[row * rowSize], rowSize)) << "sample " << sampleIDs[row];
+
+        if (0 < row)
+        {
+            // the results of the mock backend differ from one sample to the next, so a row gathered from another sample would not match
+            EXPECT_NE(0, memcmp(&rowMajor[(row - 1) * rowSize], &rowMajor[row * rowSize], rowSize)) << "sample " << sampleIDs[row];
+        }
+
+        size_t counterOffset = 0;
+
+        for (size_t resultSize : resultSizes)
+        {
+            EXPECT_EQ(0, memcmp(&rowMajor[(row * rowSize) + counterOffset], &columnMajor[(counterOffset * sampleCount) + (row * resultSize)], resultSize)) << "sample " << sampleIDs[row];
+            counterOffset += resultSize;
+        }
+    }
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
+
+// The callback of a session which is not complete yet is called once, by the call which finds the session complete, with the results of the whole session
+TEST(SessionTests, AsyncResultsCallbackCalledOnce)
+{
+    int context = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&context));
+
+    gpa_uint32 passCount = 0;
+    EnableMultiPassCounters(&passCount);
+
+    SetMockSampleHeld(2, true);
+
+    gpa_uint32 sessionID = 0;
+    ProfileSessionSamples(&sessionID, passCount, { 4, 2, 7 });
+
+    RecordingCallbackState state;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_RequestSessionResultsAsync(sessionID, RecordingCallback, &state));
+    EXPECT_EQ(0, state.m_callCount);
+
+    bool isReady = true;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSessionReady(&isReady, sessionID));
+    EXPECT_FALSE(isReady);
+    EXPECT_EQ(0, state.m_callCount);
+
+    SetMockSampleHeld(2, false);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSessionReady(&isReady, sessionID));
+    EXPECT_TRUE(isReady);
+    EXPECT_EQ(1, state.m_callCount);
+
+    // finding the session complete again does not call the callback again
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSessionReady(&isReady, sessionID));
+    EXPECT_EQ(1, state.m_callCount);
+
+    EXPECT_EQ(sessionID, state.m_sessionID);
+    EXPECT_EQ(GPA_STATUS_OK, state.m_status);
+
+    const std::vector<gpa_uint32> sortedSampleIDs = { 2, 4, 7 };
+    EXPECT_EQ(sortedSampleIDs, state.m_sampleIDs);
+
+    std::vector<char> results(state.m_results.size());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_GetSessionResults(sessionID, GPA_RESULT_LAYOUT_ROW_MAJOR, results.data(), results.size()));
+    EXPECT_EQ(results, state.m_results);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+    EXPECT_EQ(1, state.m_callCount);
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
+
+// The callback of a session which is already complete is called before the request returns
+TEST(SessionTests, AsyncResultsOfCompleteSession)
+{
+    int context = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&context));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterStr("Wavefronts"));
+
+    gpa_uint32 sessionID = 0;
+    ProfileSamples(&sessionID, 2);
+
+    bool isReady = false;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSessionReady(&isReady, sessionID));
+    EXPECT_TRUE(isReady);
+
+    RecordingCallbackState state;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_RequestSessionResultsAsync(sessionID, RecordingCallback, &state));
+    EXPECT_EQ(1, state.m_callCount);
+    EXPECT_EQ(GPA_STATUS_OK, state.m_status);
+    EXPECT_EQ(2u, state.m_sampleIDs.size());
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_IsSessionReady(&isReady, sessionID));
+    EXPECT_EQ(1, state.m_callCount);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
+
+// A callback cannot call the entry points which would reuse or destroy the session whose results it is reading
+TEST(SessionTests, AsyncResultsCallbackCannotReenter)
+{
+    int context = 0;
+
+    ASSERT_EQ(GPA_STATUS_OK, GPA_Initialize());
+    ASSERT_EQ(GPA_STATUS_OK, GPA_OpenContext(&context));
+    ASSERT_EQ(GPA_STATUS_OK, GPA_EnableCounterStr("Wavefronts"));
+
+    gpa_uint32 sessionID = 0;
+    ProfileSamples(&sessionID, 1);
+
+    RecordingCallbackState state;
+    ASSERT_EQ(GPA_STATUS_OK, GPA_RequestSessionResultsAsync(sessionID, ReentrantCallback, &state));
+    EXPECT_EQ(1, state.m_callCount);
+    EXPECT_EQ(4, state.m_rejectedCallCount);
+
+    // the rejected calls left the context open and the session intact
+    gpa_uint32 sampleCount = 0;
+    EXPECT_EQ(GPA_STATUS_OK, GPA_GetSampleCount(sessionID, &sampleCount));
+    EXPECT_EQ(1u, sampleCount);
+
+    EXPECT_EQ(GPA_STATUS_OK, GPA_CloseContext());
+    EXPECT_EQ(GPA_STATUS_OK, GPA_Destroy());
+}
@@ -758,28 +758,61 @@ namespace PublicCounterCompiler
          csw.WriteLine();
          csw.WriteLine("// *** Note, this is an auto-generated file. Do not edit. Execute PublicCounterCompiler to rebuild.");
          csw.WriteLine();
-         csw.WriteLine("void AutoDefinePublicCounters{0}(GPA_PublicCounters& p)", activeSectionLabel);
-         csw.WriteLine("{");
 
          Output("Writing counter name list to " + listFilename);
          StreamWriter lsw = new StreamWriter(listFilename);
 
+         // the internal counters of all the public counters go in one array, and
+         // public counters which require the same list of internal counters share it
+         List<List<int>> internalCounterLists = new List<List<int>>();
+         Dictionary<string, int> internalCounterListOffsets = new Dictionary<string, int>();
+         List<int> counterOffsets = new List<int>();
+         int numInternalCounters = 0;
+
          foreach (PublicCounterDef c in counterDefList)
          {
-            lsw.WriteLine("{0} - {1}", c.Name, c.Desc);
+            string key = string.Join(",", c.GetCounters());
+            int offset;
 
-            csw.WriteLine("    {");
-            csw.WriteLine("        vector< gpa_uint32 > internalCounters;");
-            foreach (int i in c.GetCounters())
+            if (!internalCounterListOffsets.TryGetValue(key, out offset))
             {
-               csw.WriteLine("        internalCounters.push_back({0});", i);
+               offset = numInternalCounters;
+               internalCounterListOffsets.Add(key, offset);
+               internalCounterLists.Add(c.GetCounters());
+               numInternalCounters += c.GetCounters().Count;
             }
 
-            csw.WriteLine();
-            csw.WriteLine("        p.DefinePublicCounter(\"{0}\", \"{1}\", {2}, {3}, {5}, internalCounters, \"{4}\");", c.Name, c.Desc, c.Type, c.Usage, c.Comp, c.CounterType);
-            csw.WriteLine("    }");
+            counterOffsets.Add(offset);
+         }
+
+         csw.WriteLine("/// Internal counters required by the public counters for {0}, referenced by offset from the counter definitions", activeSectionLabel.ToUpper());
+         csw.WriteLine("static constexpr gpa_uint32 s_internalCounters{0}[] =", activeSectionLabel);
+         csw.WriteLine("{");
+
+         foreach (List<int> counters in internalCounterLists)
+         {
+            csw.WriteLine("    {0},", string.Join(", ", counters));
+         }
+
+         csw.WriteLine("};");
+         csw.WriteLine();
+         csw.WriteLine("/// Public counter definitions for {0}", activeSectionLabel.ToUpper());
+         csw.WriteLine("static constexpr GPA_PublicCounterDef s_publicCounters{0}[] =", activeSectionLabel);
+         csw.WriteLine("{");
+
+         for (int i = 0; i < counterDefList.Count; i++)
+         {
+            PublicCounterDef c = counterDefList[i];
+            lsw.WriteLine("{0} - {1}", c.Name, c.Desc);
+
+            csw.WriteLine("    {{ \"{0}\", \"{1}\", {2}, {3}, {4}, {5}, {6}, \"{7}\" }},", c.Name, c.Desc, c.Type, c.Usage, c.CounterType, counterOffsets[i], c.GetCounters().Count, c.Comp);
          }
 
+         csw.WriteLine("};");
+         csw.WriteLine();
+         csw.WriteLine("void AutoDefinePublicCounters{0}(GPA_PublicCounters& p)", activeSectionLabel);
+         csw.WriteLine("{");
+         csw.WriteLine("    p.DefinePublicCounters(s_publicCounters{0}, sizeof(s_publicCounters{0}) / sizeof(s_publicCounters{0}[0]), s_internalCounters{0});", activeSectionLabel);
          csw.WriteLine("}");
          csw.WriteLine();
 